@@ -45,9 +45,6 @@ const float geometry_factor = 2.0;
 
 static float last_cartesian[MAX_N_AXIS] = {};
 
-// prototypes for helper functions
-float three_axis_dist(float* point1, float* point2);
-
 void machine_init() {
     // print a startup message to show the kinematics are enable
 
@@ -151,10 +148,12 @@ bool user_defined_homing(uint8_t cycle_mask) {
 
                     pl_data->feed_rate = homing_rate;   // feed or seek rates
                     plan_buffer_line(target, pl_data);  // Bypass mc_line(). Directly plan homing motion.
-                    sys.step_control                  = {};
-                    sys.step_control.executeSysMotion = true;  // Set to execute homing motion and clear existing flags.
-                    st_prep_buffer();                          // Prep and fill segment buffer from newly planned block.
-                    st_wake_up();                              // Initiate motion
+                    sys_update_step_control([](StepControl& control) {
+                        control                  = {};
+                        control.executeSysMotion = true;  // Set to execute homing motion and clear existing flags.
+                    });
+                    st_prep_buffer();  // Prep and fill segment buffer from newly planned block.
+                    st_wake_up();      // Initiate motion
 
                     do {
                         if (approach) {
@@ -244,7 +243,7 @@ bool user_defined_homing(uint8_t cycle_mask) {
         sys_position[axis] = target[axis] * axis_settings[axis]->steps_per_mm->get();
     }
 
-    sys.step_control = {};  // Return step control to normal operation.
+    sys_update_step_control([](StepControl& control) { control = {}; });  // Return step control to normal operation.
 
     gc_sync_position();
     plan_sync_position();
@@ -254,40 +253,25 @@ bool user_defined_homing(uint8_t cycle_mask) {
     return true;
 }
 
-static void transform_cartesian_to_motors(float* motors, float* cartesian) {
+// The transform for mc_kinematics_line()
+static bool transform_cartesian_to_motors(float* cartesian, float* motors, const float* near) {
     motors[X_AXIS] = geometry_factor * cartesian[X_AXIS] + cartesian[Y_AXIS];
     motors[Y_AXIS] = geometry_factor * cartesian[X_AXIS] - cartesian[Y_AXIS];
 
     auto n_axis = number_axis->get();
-    for (uint8_t axis = Z_AXIS; axis <= n_axis; axis++) {
+    for (uint8_t axis = Z_AXIS; axis < n_axis; axis++) {
         motors[axis] = cartesian[axis];
     }
+    return true;
 }
 
 // Inverse Kinematics calculates motor positions from real world cartesian positions
 // position is the old machine position, target the new machine position
-// Breaking into segments is not needed with CoreXY, because it is a linear system.
+// Breaking into segments is not needed with CoreXY, because it is a linear system. Every midpoint is
+// exactly on the line, so mc_kinematics_line() plans it as one segment with a converted feed rate.
 bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
-    float dx, dy, dz;  // distances in each cartesian axis
-
-    // calculate cartesian move distance for each axis
-    dx         = target[X_AXIS] - position[X_AXIS];
-    dy         = target[Y_AXIS] - position[Y_AXIS];
-    dz         = target[Z_AXIS] - position[Z_AXIS];
-    float dist = sqrt((dx * dx) + (dy * dy) + (dz * dz));
-
-    auto n_axis = number_axis->get();
-
-    float motors[n_axis];
-    transform_cartesian_to_motors(motors, target);
-
-    if (!pl_data->motion.rapidMotion) {
-        float last_motors[n_axis];
-        transform_cartesian_to_motors(last_motors, position);
-        pl_data->feed_rate *= (three_axis_dist(motors, last_motors) / dist);
-    }
-
-    return mc_line(motors, pl_data);
+    float motors[MAX_N_AXIS];
+    return mc_kinematics_line(target, pl_data, position, transform_cartesian_to_motors, 0.0, motors);
 }
 
 // motors -> cartesian
@@ -313,11 +297,3 @@ void kinematics_post_homing() {
 }
 
 void user_m30() {}
-
-// ================ Local Helper functions =================
-
-// Determine the unit distance between (2) 3D points
-float three_axis_dist(float* point1, float* point2) {
-    return sqrt(((point1[0] - point2[0]) * (point1[0] - point2[0])) + ((point1[1] - point2[1]) * (point1[1] - point2[1])) +
-                ((point1[2] - point2[2]) * (point1[2] - point2[2])));
-}
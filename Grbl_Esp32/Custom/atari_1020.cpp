@@ -57,8 +57,8 @@ void machine_init() {
                             NULL,                // parameters
                             1,                   // priority
                             &solenoidSyncTaskHandle,
-                            CONFIG_ARDUINO_RUNNING_CORE  // must run the task on same core
-                                                         // core
+                            SUPPORT_TASK_CORE  // must run the task on same core
+                                               // core
     );
     // setup a task that will do the custom homing sequence
     xTaskCreatePinnedToCore(atari_home_task,    // task
@@ -67,8 +67,8 @@ void machine_init() {
                             NULL,               // parameters
                             1,                  // priority
                             &atariHomingTaskHandle,
-                            CONFIG_ARDUINO_RUNNING_CORE  // must run the task on same core
-                                                         // core
+                            SUPPORT_TASK_CORE  // must run the task on same core
+                                               // core
     );
 }
 
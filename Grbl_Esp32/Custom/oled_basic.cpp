@@ -277,7 +277,7 @@ void display_init() {
                             NULL,                 // parameters
                             1,                    // priority
                             &displayUpdateTaskHandle,
-                            CONFIG_ARDUINO_RUNNING_CORE  // must run the task on same core
-                                                         // core
+                            SUPPORT_TASK_CORE  // must run the task on same core
+                                               // core
     );
 }
@@ -19,7 +19,8 @@
 
   To make the moves straight and smooth on a delta, the cartesian moves
   are broken into small segments where the non linearity will not be noticed.
-  This is similar to how Grgl draws arcs.
+  This is similar to how Grgl draws arcs. mc_kinematics_line() keeps each
+  segment within the arc tolerance ($12), up to $Kinematics/SegmentLength.
 
   If you request MPos status it will tell you the position in
   arm angles. The MPos will report in cartesian values using forward kinematics. 
@@ -93,7 +94,6 @@ static float last_cartesian[N_AXIS] = {
 // prototypes for helper functions
 KinematicError delta_calcInverse(float* cartesian, float* angles);
 KinematicError delta_calcAngleYZ(float x0, float y0, float z0, float& theta);
-float          three_axis_dist(float* point1, float* point2);
 void           read_settings();
 
 void machine_init() {
@@ -132,13 +132,20 @@ void machine_init() {
 // #endif
 // }
 
-bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
-    float dx, dy, dz;  // distances in each cartesian axis
-    float motor_angles[3];
+// The transform for mc_kinematics_line(). Axes past the arms pass through unchanged.
+static bool delta_transform(float* cartesian, float* motors, const float* near) {
+    if (delta_calcInverse(cartesian, motors) != KinematicError::NONE) {
+        return false;
+    }
+    auto n_axis = number_axis->get();
+    for (uint8_t axis = Z_AXIS + 1; axis < n_axis; axis++) {
+        motors[axis] = cartesian[axis];
+    }
+    return true;
+}
 
-    float seg_target[3];                    // The target of the current segment
-    float feed_rate  = pl_data->feed_rate;  // save original feed rate
-    bool  show_error = true;                // shows error once
+bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
+    float motor_angles[MAX_N_AXIS];
 
     KinematicError status;
 
@@ -164,58 +171,12 @@ bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* positi
     position[Y_AXIS] += gc_state.coord_offset[Y_AXIS];
     position[Z_AXIS] += gc_state.coord_offset[Z_AXIS];
 
-    // calculate cartesian move distance for each axis
-    dx         = target[X_AXIS] - position[X_AXIS];
-    dy         = target[Y_AXIS] - position[Y_AXIS];
-    dz         = target[Z_AXIS] - position[Z_AXIS];
-    float dist = sqrt((dx * dx) + (dy * dy) + (dz * dz));
-
-    // determine the number of segments we need	... round up so there is at least 1 (except when dist is 0)
-    uint32_t segment_count = ceil(dist / kinematic_segment_len->get());
-
-    float segment_dist = dist / ((float)segment_count);  // distance of each segment...will be used for feedrate conversion
-
-    for (uint32_t segment = 1; segment <= segment_count; segment++) {
-        // determine this segment's target
-        seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment);
-        seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
-        seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment);
-
-        // calculate the delta motor angles
-        KinematicError status = delta_calcInverse(seg_target, motor_angles);
-
-        if (status != KinematicError ::NONE) {
-            if (show_error) {
-                // grbl_msg_sendf(CLIENT_SERIAL,
-                //                MsgLevel::Info,
-                //                "Error:%d, Angs X:%4.3f Y:%4.3f Z:%4.3f",
-                //                status,
-                //                motor_angles[0],
-                //                motor_angles[1],
-                //                motor_angles[2]);
-                show_error = false;
-            }
-            return false;
-        }
-        if (pl_data->motion.rapidMotion) {
-            pl_data->feed_rate = feed_rate;
-        } else {
-            float delta_distance = three_axis_dist(motor_angles, last_angle);
-            pl_data->feed_rate   = (feed_rate * delta_distance / segment_dist);
-        }
-
-        // mc_line() returns false if a jog is cancelled.
-        // In that case we stop sending segments to the planner.
-        if (!mc_line(motor_angles, pl_data)) {
-            return false;
-        }
-
-        // save angles for next distance calc
-        // This is after mc_line() so that we do not update
-        // last_angle if the segment was discarded.
-        memcpy(last_angle, motor_angles, sizeof(motor_angles));
-    }
-    return true;
+    // The segments are as long as the arc tolerance allows, up to the kinematic segment length.
+    // last_angle is only updated with segments that were sent to the planner.
+    memcpy(motor_angles, last_angle, sizeof(last_angle));
+    bool result = mc_kinematics_line(target, pl_data, position, delta_transform, kinematic_segment_len->get(), motor_angles);
+    memcpy(last_angle, motor_angles, sizeof(last_angle));
+    return result;
 }
 
 // this is used used by Grbl soft limits to see if the range of the machine is exceeded.
@@ -349,12 +310,6 @@ KinematicError delta_calcAngleYZ(float x0, float y0, float z0, float& theta) {
     return KinematicError::NONE;
 }
 
-// Determine the unit distance between (2) 3D points
-float three_axis_dist(float* point1, float* point2) {
-    return sqrt(((point1[0] - point2[0]) * (point1[0] - point2[0])) + ((point1[1] - point2[1]) * (point1[1] - point2[1])) +
-                ((point1[2] - point2[2]) * (point1[2] - point2[2])));
-}
-
 // bool kinematics_pre_homing(uint8_t cycle_mask) {  // true = do not continue with normal Grbl homing
 // #ifdef USE_CUSTOM_HOMING
 //     return true;
@@ -74,6 +74,25 @@ void kinematics_post_homing() {
     last_angle = 0;
 }
 
+// The transform for mc_kinematics_line(). Only X and Z have offsets, so the polar conversion is
+// done relative to them and the offsets are added back to the radius and Z.
+static bool polar_transform(float* cartesian, float* motors, const float* near) {
+    float xyz[MAX_N_AXIS];
+    float x_offset = gc_state.coord_system[X_AXIS] + gc_state.coord_offset[X_AXIS];  // offset from machine coordinate system
+    float z_offset = gc_state.coord_system[Z_AXIS] + gc_state.coord_offset[Z_AXIS];  // offset from machine coordinate system
+    auto  n_axis   = number_axis->get();
+    memcpy(xyz, cartesian, n_axis * sizeof(xyz[0]));
+    xyz[X_AXIS] -= x_offset;
+    xyz[Z_AXIS] -= z_offset;
+    calc_polar(xyz, motors, near[POLAR_AXIS]);
+    motors[RADIUS_AXIS] += x_offset;
+    motors[Z_AXIS] += z_offset;
+    for (uint8_t axis = Z_AXIS + 1; axis < n_axis; axis++) {
+        motors[axis] = cartesian[axis];
+    }
+    return true;
+}
+
 /*
  Apply inverse kinematics for a polar system
 
@@ -83,74 +102,21 @@ void kinematics_post_homing() {
 
  Note: It is assumed only the radius axis (X) is homed and only X and Z have offsets
 
-
+ mc_kinematics_line() breaks the line into segments within the arc tolerance ($12), up to
+ SEGMENT_LENGTH long, and scales the feed rate of each by the ratio of the polar and cartesian
+ distances.
 */
 
 bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position) {
-    float    dx, dy, dz;          // distances in each cartesian axis
-    float    p_dx, p_dy, p_dz;    // distances in each polar axis
-    float    dist, polar_dist;    // the distances in both systems...used to determine feed rate
-    uint32_t segment_count;       // number of segments the move will be broken in to.
-    float    seg_target[N_AXIS];  // The target of the current segment
-    float    polar[N_AXIS];       // target location in polar coordinates
-    float    x_offset = gc_state.coord_system[X_AXIS] + gc_state.coord_offset[X_AXIS];  // offset from machine coordinate system
-    float    z_offset = gc_state.coord_system[Z_AXIS] + gc_state.coord_offset[Z_AXIS];  // offset from machine coordinate system
-    //grbl_sendf(CLIENT_SERIAL, "Position: %4.2f %4.2f %4.2f \r\n", position[X_AXIS] - x_offset, position[Y_AXIS], position[Z_AXIS]);
-    //grbl_sendf(CLIENT_SERIAL, "Target: %4.2f %4.2f %4.2f \r\n", target[X_AXIS] - x_offset, target[Y_AXIS], target[Z_AXIS]);
-    // calculate cartesian move distance for each axis
-    dx = target[X_AXIS] - position[X_AXIS];
-    dy = target[Y_AXIS] - position[Y_AXIS];
-    dz = target[Z_AXIS] - position[Z_AXIS];
-    // calculate the total X,Y axis move distance
-    // Z axis is the same in both coord systems, so it is ignored
-    dist = sqrt((dx * dx) + (dy * dy) + (dz * dz));
-    if (pl_data->motion.rapidMotion) {
-        segment_count = 1;  // rapid G0 motion is not used to draw, so skip the segmentation
-    } else {
-        segment_count = ceil(dist / SEGMENT_LENGTH);  // determine the number of segments we need	... round up so there is at least 1
-    }
-    dist /= segment_count;  // segment distance
-    for (uint32_t segment = 1; segment <= segment_count; segment++) {
-        // determine this segment's target
-        seg_target[X_AXIS] = position[X_AXIS] + (dx / float(segment_count) * segment) - x_offset;
-        seg_target[Y_AXIS] = position[Y_AXIS] + (dy / float(segment_count) * segment);
-        seg_target[Z_AXIS] = position[Z_AXIS] + (dz / float(segment_count) * segment) - z_offset;
-        calc_polar(seg_target, polar, last_angle);
-        // begin determining new feed rate
-        // calculate move distance for each axis
-        p_dx                      = polar[RADIUS_AXIS] - last_radius;
-        p_dy                      = polar[POLAR_AXIS] - last_angle;
-        p_dz                      = dz;
-        polar_dist                = sqrt((p_dx * p_dx) + (p_dy * p_dy) + (p_dz * p_dz));  // calculate the total move distance
-        float polar_rate_multiply = 1.0;                                                  // fail safe rate
-        if (polar_dist == 0 || dist == 0) {
-            // prevent 0 feed rate and division by 0
-            polar_rate_multiply = 1.0;  // default to same feed rate
-        } else {
-            // calc a feed rate multiplier
-            polar_rate_multiply = polar_dist / dist;
-            if (polar_rate_multiply < 0.5) {
-                // prevent much slower speed
-                polar_rate_multiply = 0.5;
-            }
-        }
-        pl_data->feed_rate *= polar_rate_multiply;  // apply the distance ratio between coord systems
-        // end determining new feed rate
-        polar[RADIUS_AXIS] += x_offset;
-        polar[Z_AXIS] += z_offset;
-
-        // mc_line() returns false if a jog is cancelled.
-        // In that case we stop sending segments to the planner.
-        if (!mc_line(polar, pl_data)) {
-            return false;
-        }
-
-        //
-        last_radius = polar[RADIUS_AXIS];
-        last_angle  = polar[POLAR_AXIS];
-    }
-    // TO DO don't need a feedrate for rapids
-    return true;
+    float polar[MAX_N_AXIS] = {};  // The polar location of the last segment
+    polar[RADIUS_AXIS]      = last_radius;
+    polar[POLAR_AXIS]       = last_angle;  // The angle is unwrapped near the previous one
+    //grbl_sendf(CLIENT_SERIAL, "Position: %4.2f %4.2f %4.2f \r\n", position[X_AXIS], position[Y_AXIS], position[Z_AXIS]);
+    //grbl_sendf(CLIENT_SERIAL, "Target: %4.2f %4.2f %4.2f \r\n", target[X_AXIS], target[Y_AXIS], target[Z_AXIS]);
+    bool result = mc_kinematics_line(target, pl_data, position, polar_transform, SEGMENT_LENGTH, polar);
+    last_radius = polar[RADIUS_AXIS];
+    last_angle  = polar[POLAR_AXIS];
+    return result;
 }
 
 /*
@@ -20,10 +20,33 @@
 
 #include "src/Grbl.h"
 
+#if SUPPORT_TASK_CORE != CONFIG_ARDUINO_RUNNING_CORE
+// Runs the main loop on SUPPORT_TASK_CORE instead of the Arduino loop task's core. See
+// USE_SEGMENT_PREP_TASK in Config.h.
+static void mainLoopTask(void* pvParameters) {
+    while (true) {
+        run_once();
+    }
+}
+#endif
+
 void setup() {
     grbl_init();
+#if SUPPORT_TASK_CORE != CONFIG_ARDUINO_RUNNING_CORE
+    xTaskCreatePinnedToCore(mainLoopTask,    // task
+                            "mainLoopTask",  // name for task
+                            8192,            // size of task stack, as for the Arduino loop task
+                            NULL,            // parameters
+                            1,               // priority, as for the Arduino loop task
+                            NULL,
+                            SUPPORT_TASK_CORE);
+#endif
 }
 
 void loop() {
+#if SUPPORT_TASK_CORE != CONFIG_ARDUINO_RUNNING_CORE
+    vTaskDelete(NULL);  // The main loop runs in mainLoopTask
+#else
     run_once();
+#endif
 }
@@ -47,7 +47,6 @@ Some features should not be changed. See notes below.
 // that the machine file might choose to undefine.
 
 // Note: HOMING_CYCLES are now settings
-#define SUPPORT_TASK_CORE 1  // Reference: CONFIG_ARDUINO_RUNNING_CORE = 1
 
 // Inverts pin logic of the control command pins based on a mask. This essentially means you can use
 // normally-closed switches on the specified pins, rather than the default normally-open switches.
@@ -61,6 +60,13 @@ Some features should not be changed. See notes below.
 
 #define USE_RMT_STEPS
 
+// With RMT stepping, lets the stepper ISR compute several step events at once and load them into each
+// motor's RMT channel as one timed pulse train, then sleep until the train has been emitted. This cuts
+// the interrupt rate of fast moves by up to RMT_BURST_TICKS times. Only segments without AMASS are sent
+// as bursts, and probing and homing always step one event at a time so they can stop on the switch.
+// #define USE_RMT_STEP_BURSTS  // Default disabled. Uncomment to enable. Requires USE_RMT_STEPS.
+const int RMT_BURST_TICKS = 48;  // Step events per burst. At most 63, the items in one RMT memory block.
+
 // Include the file that loads the machine-specific config file.
 // machine.h must be edited to choose the desired file.
 #include "Machine.h"
@@ -74,6 +80,11 @@ Some features should not be changed. See notes below.
 #        undef USE_RMT_STEPS
 #    endif
 #endif
+#ifndef USE_RMT_STEPS
+#    ifdef USE_RMT_STEP_BURSTS
+#        undef USE_RMT_STEP_BURSTS
+#    endif
+#endif
 
 const int MAX_N_AXIS = 6;
 
@@ -131,6 +142,23 @@ const int MAX_N_AXIS = 6;
 // #define ENABLE_AUTHENTICATION
 //CONFIGURE_EYECATCH_END (DO NOT MODIFY THIS LINE)
 
+// The host simulator (see sim/ in the repo root) builds only the motion core,
+// so it has no radio or network stack to offer.
+#ifdef GRBL_SIM
+#    undef ENABLE_BLUETOOTH
+#    undef ENABLE_WIFI
+#    undef WIFI_OR_BLUETOOTH
+#    undef ENABLE_HTTP
+#    undef ENABLE_OTA
+#    undef ENABLE_TELNET
+#    undef ENABLE_MDNS
+#    undef ENABLE_SSDP
+#    undef ENABLE_NOTIFICATIONS
+#    undef ENABLE_SERIAL2SOCKET_IN
+#    undef ENABLE_SERIAL2SOCKET_OUT
+#    undef ENABLE_CAPTIVE_PORTAL
+#endif
+
 #ifdef ENABLE_AUTHENTICATION
 const char* const DEFAULT_ADMIN_PWD   = "admin";
 const char* const DEFAULT_USER_PWD    = "user";
@@ -334,6 +362,13 @@ namespace SpindleSpeedOverride {
 #define REPORT_FIELD_OVERRIDES           // Default enabled. Comment to disable.
 #define REPORT_FIELD_LINE_NUMBERS        // Default enabled. Comment to disable.
 
+// Counts step segment buffer underruns, the lowest segment buffer depth and the planner buffer fill, and
+// times the stepper interrupt. The $MS command prints them and $MS=RST clears them. Setting bit 2 of
+// $10 (status report mask) also adds them to the status report as "|MS:underruns,segments,latency,isr",
+// with the interrupt latency and duration in microseconds. Together with the Ln: field this shows which
+// g-code lines make a machine stutter. The cost is a few register reads per stepper interrupt.
+#define ENABLE_MOTION_STATS  // Default enabled. Comment to disable.
+
 // Some status report data isn't necessary for realtime, only intermittently, because the values don't
 // change often. The following macros configures how many times a status report needs to be called before
 // the associated data is refreshed and included in the status report. However, if one of these value
@@ -357,6 +392,15 @@ const int REPORT_WCO_REFRESH_IDLE_COUNT = 10;  // (2-255) Must be less than or e
 // certain the step segment buffer is increased/decreased to account for these changes.
 const int ACCELERATION_TICKS_PER_SECOND = 100;
 
+// Enables jerk-limited (S-curve) acceleration and deceleration ramps in the step segment generator.
+// The acceleration rises and falls at no more than the $<axis>/Jerk setting (mm/sec^3) instead of
+// switching on and off, and never exceeds the $12x accelerations. The ramps carry on across planner
+// blocks. They take longer than the planner's ramps, so the segment generator looks ahead over the
+// planner buffer by itself to keep within the junction speed limits and stop at the end of the buffer.
+// This reduces frame ringing and often allows higher accelerations to be used, at some extra cost in
+// segment preparation.
+// #define S_CURVE_ACCELERATION  // Default disabled. Uncomment to enable.
+
 // Sets the maximum step rate allowed to be written as a Grbl setting. This option enables an error
 // check in the settings module to prevent settings values that will exceed this limitation. The maximum
 // step rate is strictly limited by the CPU speed and will change if something other than an AVR running
@@ -431,6 +475,23 @@ const int N_ARC_CORRECTION = 12;  // Integer (1-255)
 // much greater than this. The default setting should capture most, if not all, full arc error situations.
 const double ARC_ANGULAR_TRAVEL_EPSILON = 5E-7;  // Float (radians)
 
+// Plans each G2/G3 arc as a single planner block instead of one block per chord. The segment prep
+// traces the arc itself, cutting it into chords no longer than the arc tolerance ($12) allows, so
+// long or finely toleranced arcs no longer flood the planner buffer. Arcs are still split into
+// line motions on machines with kinematics, and when they move axes outside the arc and helix.
+#define PLANNER_ARCS  // Default enabled. Comment to disable.
+#ifdef USE_KINEMATICS
+#    undef PLANNER_ARCS  // Every motion goes through cartesian_to_motors()
+#endif
+
+// G64 path blending fuses consecutive G1 and arc segments into a single planner block as long as
+// every original vertex stays within the tolerance of the fused line. This removes the junction
+// slow-downs at the vertices of finely tessellated CAM paths. G64 P<tol> sets the tolerance in the
+// current units and G64 without P uses the default below. G61 returns to exact path mode. The
+// maximum number of vertices bounds the work done to check each new segment.
+const double PATH_BLEND_DEFAULT_TOLERANCE = 0.01;  // Float (mm)
+const int    PATH_BLEND_MAX_VERTICES      = 16;    // Integer (1-255)
+
 // Time delay increments performed during a dwell. The default value is set at 50ms, which provides
 // a maximum time delay of roughly 55 minutes, more than enough for most any application. Increasing
 // this delay will increase the maximum dwell time linearly, but also reduces the responsiveness of
@@ -448,12 +509,13 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 
 // STEP_PULSE_DELAY is now a setting...$Stepper/Direction/Delay
 
-// The number of linear motions in the planner buffer to be planned at any give time. The vast
-// majority of RAM that Grbl uses is based on this buffer size. Only increase if there is extra
-// available RAM, like when re-compiling for a Mega2560. Or decrease if the Arduino begins to
-// crash due to the lack of available RAM or if the CPU is having trouble keeping up with planning
-// new incoming motions as they are executed.
-// #define BLOCK_BUFFER_SIZE 16 // Uncomment to override default in planner.h.
+// The number of linear motions in the planner buffer to be planned at any give time. The planner
+// can only reach the programmed feed rate if the combined length of the buffered motions is enough
+// to accelerate to it and decelerate to a stop, so jobs made of many tiny segments (3D surfacing,
+// laser rasters, dense arcs) run faster with a deeper buffer. Each block takes about 70 bytes of
+// RAM, so a deep look-ahead of 128 to 512 blocks fits easily on the ESP32. Planning cost per new
+// block is bounded by the blocks whose speeds actually change, not by the buffer size.
+// #define BLOCK_BUFFER_SIZE 256 // Uncomment to override default in planner.h. 512 maximum.
 
 // Governs the size of the intermediary step segment buffer between the step execution algorithm
 // and the planner blocks. Each segment is set of steps executed at a constant velocity over a
@@ -463,6 +525,34 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 // before having to come back and refill this buffer, currently at ~50msec of step moves.
 // #define SEGMENT_BUFFER_SIZE 6 // Uncomment to override default in stepper.h.
 
+// Keeps sys_position out of the per-step work of the stepper ISR. The steps taken by each axis are
+// worked out from the Bresenham counters and added to sys_position when a segment completes, so the
+// ISR only updates its counters on every step. Readers that need the position in the middle of a
+// segment, like probing, status reports and RC servos, get it exactly from st_get_position().
+#define DEFER_POSITION_UPDATES  // Default enabled. Comment to disable.
+
+// Refills the step segment buffer from a dedicated task pinned to MOTION_TASK_CORE, instead of
+// only from the main loop. The stepper interrupt wakes the task whenever it finishes a segment, so
+// long g-code lines, status reports, SD card reads and WebUI traffic on SUPPORT_TASK_CORE can no
+// longer starve the stepper of segments. The main loop still refills the buffer as before, which
+// is harmless and keeps things running if the task is disabled.
+//
+// The WiFi and Bluetooth stacks run on core 0, where their tasks (up to priority 23) can preempt
+// anything else for as long as the radio needs. So the task gets core 1 to itself, and the main
+// loop and its support tasks move to core 0, see Grbl_Esp32.ino. The stepper interrupt stays on
+// core 1, where stepper_init() runs.
+#define USE_SEGMENT_PREP_TASK  // Default enabled. Comment to disable.
+#define MOTION_TASK_CORE 1     // The core without the radio stacks
+const int SEGMENT_PREP_TASK_PRIORITY  = 19;  // Above the I2S out task (1), which shares the core.
+const int SEGMENT_PREP_TASK_PERIOD_MS = 2;   // Poll period in case no stepper interrupt wakes it.
+
+// Core of the main loop and of the tasks that share its data, like the serial client task
+#ifdef USE_SEGMENT_PREP_TASK
+#    define SUPPORT_TASK_CORE 0  // With the radio stacks, leaving core 1 to motion
+#else
+#    define SUPPORT_TASK_CORE 1  // Reference: CONFIG_ARDUINO_RUNNING_CORE = 1
+#endif
+
 // Line buffer size from the serial input stream to be executed. Also, governs the size of
 // each of the startup blocks, as they are each stored as a string of this size.
 // NOTE: 80 characters is not a problem except for extreme cases, but the line buffer size
@@ -480,9 +570,37 @@ const int DWELL_TIME_STEP = 50;  // Integer (1-255) (milliseconds)
 // 115200 baud will take 5 msec to transmit a typical 55 character report. Worst case reports are
 // around 90-100 characters. As long as the serial TX buffer doesn't get continually maxed, Grbl
 // will continue operating efficiently. Size the TX buffer around the size of a worst-case report.
-// #define RX_BUFFER_SIZE 128 // (1-254) Uncomment to override defaults in serial.h
+// Every client (serial, Bluetooth, WebSocket, telnet and the web input) has a receive buffer of
+// RX_BUFFER_SIZE bytes. The Bf: field of the status report gives the free space of the buffer of
+// the client that asked, counting the bytes its port has received but not yet handed over, so a
+// character counting sender can keep up to RX_BUFFER_SIZE bytes in flight. Each buffer takes
+// RX_BUFFER_SIZE bytes of RAM.
+#define RX_BUFFER_SIZE 2048  // (256-16384)
 // #define TX_BUFFER_SIZE 100 // (1-254)
 
+// The task that receives from the clients sleeps until the serial port has data, so it sees a
+// realtime command within a character time. With the radio off, it also wakes this often to
+// check for restart requests.
+const int CLIENT_IDLE_POLL_MS = 10;
+
+// Reads SD card jobs ahead from a task of their own. The task fills a ring buffer with whole
+// sectors, so readFileLine() takes its lines from memory instead of making a file system call
+// per byte, and the main loop runs the lines that are already buffered back to back instead of
+// one line per pass. Keeps the planner full on jobs with many short segments.
+#define SD_READ_AHEAD                    // Default enabled. Comment to disable.
+const int SD_READ_AHEAD_SIZE    = 4096;  // Ring buffer bytes. A power of two, at least SD_READ_CHUNK_SIZE.
+const int SD_READ_CHUNK_SIZE    = 512;   // Bytes per read, one sector.
+const int SD_READ_TASK_PRIORITY = 2;     // Above the main loop and clientCheckTask (1).
+#ifdef GRBL_SIM
+#    undef SD_READ_AHEAD  // The simulator does not run tasks
+#endif
+
+// Adds the [ESP222] command, which compiles an SD card job into a .gcb file next to it. Lines
+// that only move are stored with their targets and planner data already resolved, and run
+// without being parsed again. [ESP220] runs the compiled file if it is still valid for the
+// source file and the parser state, and the source file if not.
+#define ENABLE_SD_COMPILE  // Default enabled. Comment to disable.
+
 // A simple software debouncing feature for hard limit switches. When enabled, the limit
 // switch interrupt unblock a waiting task which will recheck the limit switch pins after
 // a short delay. Default disabled
@@ -587,6 +705,39 @@ const double PARKING_PULLOUT_INCREMENT = 5.0;    // Spindle pull-out and plunge
 // to ensure the laser doesn't inadvertently remain powered while at a stop and cause a fire.
 #define DISABLE_LASER_DURING_HOLD  // Default enabled. Comment to disable.
 
+// In M4 dynamic laser mode, the laser power follows the speed of the tool. Without this option the
+// power is set once per step segment, which steps the power in a staircase through acceleration
+// ramps and can leave visible bands on fast rasters. With it, the stepper ISR ramps the power from
+// the entry to the exit speed of each segment, every LASER_POWER_STEPS step events. The ISR only
+// looks the PWM duty up in a table of LASER_POWER_LEVELS levels, which the laser spindle fills in
+// advance and refills when the spindle override changes.
+#define LASER_POWER_PER_STEP  // Default enabled. Comment to disable.
+const int LASER_POWER_STEPS  = 4;    // Step events between power updates
+const int LASER_POWER_LEVELS = 256;  // Power levels from off to full power
+
+// Adds the G7 raster scanline command for laser engraving. A G7 block engraves a row of pixels from
+// the current position, as one planner block instead of one G1 block per pixel:
+//   G7 X<pitch> D<pixels>
+// The single axis word gives the axis of the scanline and the signed pixel pitch, in the current
+// units. The D word must be last and holds the pixel intensities, 0 (off) to FF (the S power), as
+// two hex digits each. A run of equal pixels can be written as the intensity, '*' and the run
+// length in two hex digits, like 00*40 for 64 blank pixels. The stepper ISR changes the power as
+// it crosses each pixel, scaled by the speed in M4 like any other motion. Requires laser mode and
+// LASER_POWER_PER_STEP. The pixels wait in a ring buffer of RASTER_BUFFER_SIZE bytes until the ISR
+// has engraved them, so one G7 block can hold at most that many pixels.
+#define LASER_RASTER  // Default enabled. Comment to disable.
+const int RASTER_BUFFER_SIZE = 4096;  // Pixels queued ahead of the stepper ISR. A power of two.
+#if defined(USE_KINEMATICS) || !defined(LASER_POWER_PER_STEP)
+#    undef LASER_RASTER  // The ISR finds the pixels by the step events of a single cartesian line
+#endif
+
+// $Spindle/PWM/Curve calibrates the output of the PWM, laser and 0-10V spindles at run time, with
+// points of rpm (or laser power) and the PWM duty there in percent, like 5000:18,12000:42,24000:100.
+// The output follows straight lines between the points. When the spindle is set up, the curve is
+// sampled into a table of SPINDLE_CURVE_SIZE entries over the $31 to $30 range, so setting an rpm
+// only interpolates between two entries. An empty curve keeps the linear $35 to $36 mapping.
+const int SPINDLE_CURVE_SIZE = 256;  // Table entries from min to max rpm
+
 // Enables a piecewise linear model of the spindle PWM/speed output. Requires a solution by the
 // 'fit_nonlinear_spindle.py' script in the /doc/script folder of the repo. See file comments
 // on how to gather spindle data and run the script to generate a solution.
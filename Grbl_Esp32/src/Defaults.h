@@ -191,6 +191,10 @@
 #    define DEFAULT_SPINDLE_MAX_VALUE 100.0  // $36 Percent of full period (extended set)
 #endif
 
+#ifndef DEFAULT_SPINDLE_PWM_CURVE
+#    define DEFAULT_SPINDLE_PWM_CURVE ""  // rpm:percent points, see SPINDLE_CURVE_SIZE in Config.h
+#endif
+
 #ifndef DEFAULT_SPINDLE_DELAY_SPINUP
 #    define DEFAULT_SPINDLE_DELAY_SPINUP 0
 #endif
@@ -320,6 +324,27 @@
 #    define DEFAULT_C_ACCELERATION 200.0
 #endif
 
+// ============== Axis Jerk =========
+// Default jerks are expressed in mm/sec^3. Only used with S_CURVE_ACCELERATION.
+#ifndef DEFAULT_X_JERK
+#    define DEFAULT_X_JERK 10000.0
+#endif
+#ifndef DEFAULT_Y_JERK
+#    define DEFAULT_Y_JERK 10000.0
+#endif
+#ifndef DEFAULT_Z_JERK
+#    define DEFAULT_Z_JERK 10000.0
+#endif
+#ifndef DEFAULT_A_JERK
+#    define DEFAULT_A_JERK 10000.0
+#endif
+#ifndef DEFAULT_B_JERK
+#    define DEFAULT_B_JERK 10000.0
+#endif
+#ifndef DEFAULT_C_JERK
+#    define DEFAULT_C_JERK 10000.0
+#endif
+
 // ========= AXIS MAX TRAVEL ============
 
 #ifndef DEFAULT_X_MAX_TRAVEL
@@ -61,6 +61,7 @@ std::map<Error, const char*> ErrorNames = {
     { Error::GcodeG43DynamicAxisError, "Gcode G43 dynamic axis error" },
     { Error::GcodeMaxValueExceeded, "Gcode max value exceeded" },
     { Error::PParamMaxExceeded, "P param max exceeded" },
+    { Error::GcodeRasterData, "Gcode raster data error" },
     { Error::FsFailedMount, "Failed to mount device" },
     { Error::FsFailedRead, "Failed to read" },
     { Error::FsFailedOpenDir, "Failed to open directory" },
@@ -40,6 +40,10 @@ static const uint8_t MaxToolNumber = 255;  // Limited by max unsigned 8-bit valu
 parser_state_t gc_state;
 parser_block_t gc_block;
 
+#ifdef ENABLE_SD_COMPILE
+compiled_motion_t* gc_motion_capture = NULL;
+#endif
+
 #define FAIL(status) return (status);
 
 void gc_init() {
@@ -56,8 +60,44 @@ void gc_sync_position() {
     system_convert_array_steps_to_mpos(gc_state.position, sys_position);
 }
 
+// Character classes for collapseGCode(). Characters from 128 up are CcKeep.
+enum CharClass : uint8_t {
+    CcKeep  = 0,  // Copied to the output
+    CcLower = 1,  // Copied in upper case
+    CcSpace = 2,  // Whitespace and '\r', dropped
+    CcDrop  = 3,  // '%', dropped
+    CcOpen  = 4,  // '('
+    CcClose = 5,  // ')'
+    CcSemi  = 6,  // ';'
+};
+
+#define CC_16(c) c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c
+static const uint8_t char_class[128] = {
+    // 0x00 - 0x0f: \t \n \v \f \r are whitespace
+    CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep,
+    CcKeep, CcSpace, CcSpace, CcSpace, CcSpace, CcSpace, CcKeep, CcKeep,
+    // 0x10 - 0x1f
+    CC_16(CcKeep),
+    // 0x20 - 0x2f: space % ( )
+    CcSpace, CcKeep, CcKeep, CcKeep, CcKeep, CcDrop, CcKeep, CcKeep,
+    CcOpen, CcClose, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep,
+    // 0x30 - 0x3f: ;
+    CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep,
+    CcKeep, CcKeep, CcKeep, CcSemi, CcKeep, CcKeep, CcKeep, CcKeep,
+    // 0x40 - 0x5f
+    CC_16(CcKeep),
+    CC_16(CcKeep),
+    // 0x60 - 0x7f: a - z
+    CcKeep, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower,
+    CcLower, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower,
+    CcLower, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower, CcLower,
+    CcLower, CcLower, CcLower, CcKeep, CcKeep, CcKeep, CcKeep, CcKeep,
+};
+#undef CC_16
+
 // Edit GCode line in-place, removing whitespace and comments and
-// converting to uppercase
+// converting to uppercase. Each character is classified with one
+// table lookup instead of the isspace() and toupper() calls.
 void collapseGCode(char* line) {
     // parenPtr, if non-NULL, is the address of the character after (
     char* parenPtr = NULL;
@@ -66,11 +106,18 @@ void collapseGCode(char* line) {
     char* outPtr = line;
     char  c;
     for (char* inPtr = line; (c = *inPtr) != '\0'; inPtr++) {
-        if (isspace(c)) {
-            continue;
-        }
-        switch (c) {
-            case ')':
+        uint8_t cc = uint8_t(c) < 128 ? char_class[uint8_t(c)] : CcKeep;
+        switch (cc) {
+            case CcSpace:
+            case CcDrop:
+                // TODO: Install '%' feature
+                // Program start-end percent sign NOT SUPPORTED.
+                // NOTE: This maybe installed to tell Grbl when a program is running vs manual input,
+                // where, during a program, the system auto-cycle start will continue to execute
+                // everything until the next '%' sign. This will help fix resuming issues with certain
+                // functions that empty the planner buffer to execute its task on-time.
+                break;
+            case CcClose:
                 if (parenPtr) {
                     // Terminate comment by replacing ) with NUL
                     *inPtr = '\0';
@@ -79,31 +126,20 @@ void collapseGCode(char* line) {
                 }
                 // Strip out ) that does not follow a (
                 break;
-            case '(':
+            case CcOpen:
                 // Start the comment at the character after (
                 parenPtr = inPtr + 1;
                 break;
-            case ';':
+            case CcSemi:
                 // NOTE: ';' comment to EOL is a LinuxCNC definition. Not NIST.
 #ifdef REPORT_SEMICOLON_COMMENTS
                 report_gcode_comment(inPtr + 1);
 #endif
                 *outPtr = '\0';
                 return;
-            case '%':
-                // TODO: Install '%' feature
-                // Program start-end percent sign NOT SUPPORTED.
-                // NOTE: This maybe installed to tell Grbl when a program is running vs manual input,
-                // where, during a program, the system auto-cycle start will continue to execute
-                // everything until the next '%' sign. This will help fix resuming issues with certain
-                // functions that empty the planner buffer to execute its task on-time.
-                break;
-            case '\r':
-                // In case one sneaks in
-                break;
             default:
                 if (!parenPtr) {
-                    *outPtr++ = toupper(c);  // make upper case
+                    *outPtr++ = cc == CcLower ? c - 'a' + 'A' : c;  // make upper case
                 }
         }
     }
@@ -115,6 +151,48 @@ void collapseGCode(char* line) {
     *outPtr = '\0';
 }
 
+#ifdef ENABLE_SD_COMPILE
+// Stores the motion of the block for the SD job compiler, before motion control changes pl_data
+static void gc_capture_motion(plan_line_data_t* pl_data, uint8_t axis_0, uint8_t axis_1, uint8_t axis_linear) {
+    compiled_motion_t* motion = gc_motion_capture;
+    switch (gc_state.modal.motion) {
+        case Motion::Seek:
+        case Motion::Linear:
+        case Motion::CwArc:
+        case Motion::CcwArc:
+            break;
+        default:
+            return;  // Probes depend on the machine
+    }
+    motion->motion = gc_state.modal.motion;
+    memcpy(motion->target, gc_block.values.xyz, sizeof(motion->target));
+    memcpy(motion->offset, gc_block.values.ijk, sizeof(motion->offset));
+    memcpy(&motion->pl_data, pl_data, sizeof(motion->pl_data));
+    if (motion->motion == Motion::Seek) {
+        motion->pl_data.motion.rapidMotion = 1;
+    }
+    motion->radius      = gc_block.values.r;
+    motion->line_number = gc_state.line_number;
+    motion->axis_0      = axis_0;
+    motion->axis_1      = axis_1;
+    motion->axis_linear = axis_linear;
+}
+#endif
+
+// The value word each letter from A to Z sets. G and M are command words and are handled before.
+static const uint8_t LetterCommand     = 0xfe;
+static const uint8_t LetterUnsupported = 0xff;
+
+static const uint8_t gc_letter_word[26] = {
+    uint8_t(GCodeWord::A), uint8_t(GCodeWord::B), uint8_t(GCodeWord::C), LetterUnsupported,     // A B C D
+    uint8_t(GCodeWord::E), uint8_t(GCodeWord::F), LetterCommand,         LetterUnsupported,     // E F G H
+    uint8_t(GCodeWord::I), uint8_t(GCodeWord::J), uint8_t(GCodeWord::K), uint8_t(GCodeWord::L), // I J K L
+    LetterCommand,         uint8_t(GCodeWord::N), LetterUnsupported,     uint8_t(GCodeWord::P), // M N O P
+    uint8_t(GCodeWord::Q), uint8_t(GCodeWord::R), uint8_t(GCodeWord::S), uint8_t(GCodeWord::T), // Q R S T
+    LetterUnsupported,     LetterUnsupported,     LetterUnsupported,     uint8_t(GCodeWord::X), // U V W X
+    uint8_t(GCodeWord::Y), uint8_t(GCodeWord::Z),                                                // Y Z
+};
+
 // Executes one line of NUL-terminated G-Code.
 // The line may contain whitespace and comments, which are first removed,
 // and lower case characters, which are converted to upper case.
@@ -134,8 +212,10 @@ Error gc_execute_line(char* line, uint8_t client) {
        executed after successful error-checking. The parser block struct also contains a block
        values struct, word tracking variables, and a non-modal commands tracker for the new
        block. This struct contains all of the necessary information to execute the block. */
-    memset(&gc_block, 0, sizeof(parser_block_t));                  // Initialize the parser block struct.
-    memcpy(&gc_block.modal, &gc_state.modal, sizeof(gc_modal_t));  // Copy current modes
+    memset(&gc_block.values, 0, sizeof(gc_values_t));  // Initialize the parser block struct.
+    gc_block.non_modal_command = NonModal::NoAction;
+    gc_block.coolant           = GCodeCoolant::None;
+    gc_block.modal             = gc_state.modal;  // Copy current modes
     AxisCommand axis_command = AxisCommand::None;
     uint8_t     axis_0, axis_1, axis_linear;
     CoordIndex  coord_select = CoordIndex::G54;  // Tracks G10 P coordinate selection for execution
@@ -149,6 +229,10 @@ Error gc_execute_line(char* line, uint8_t client) {
     auto     n_axis          = number_axis->get();
     float    coord_data[MAX_N_AXIS];  // Used by WCO-related commands
     uint8_t  pValue;                  // Integer value of P word
+#ifdef LASER_RASTER
+    const char* raster_data   = NULL;  // Pixels of the D word of a G7 block
+    uint32_t    raster_pixels = 0;
+#endif
 
     // Determine if the line is a jogging motion or a normal g-code block.
     if (line[0] == '$') {  // NOTE: `$J=` already parsed when passed to this function.
@@ -185,19 +269,32 @@ Error gc_execute_line(char* line, uint8_t client) {
             FAIL(Error::ExpectedCommandLetter);  // [Expected word letter]
         }
         char_counter++;
+#ifdef LASER_RASTER
+        if (letter == 'D') {
+            // G7 pixel data is not a number. It runs to the end of the line.
+            raster_data   = line + char_counter;
+            raster_pixels = raster_count_pixels(raster_data);
+            if (raster_pixels == 0) {
+                FAIL(Error::GcodeRasterData);
+            }
+            break;
+        }
+#endif
         if (!read_float(line, &char_counter, &value)) {
             FAIL(Error::BadNumberFormat);  // [Expected word value]
         }
-        // Convert values to smaller uint8 significand and mantissa values for parsing this word.
-        // NOTE: Mantissa is multiplied by 100 to catch non-integer command values. This is more
-        // accurate than the NIST gcode requirement of x10 when used for commands, but not quite
-        // accurate enough for value words that require integers to within 0.0001. This should be
-        // a good enough compromise and catch most all non-integer errors. To make it compliant,
-        // we would simply need to change the mantissa to int16, but this add compiled flash space.
-        // Maybe update this later.
-        int_value = trunc(value);
-        mantissa  = round(100 * (value - int_value));  // Compute mantissa for Gxx.x commands.
-        // NOTE: Rounding must be used to catch small floating point errors.
+        if (letter == 'G' || letter == 'M') {
+            // Convert values to smaller uint8 significand and mantissa values for parsing this word.
+            // NOTE: Mantissa is multiplied by 100 to catch non-integer command values. This is more
+            // accurate than the NIST gcode requirement of x10 when used for commands, but not quite
+            // accurate enough for value words that require integers to within 0.0001. This should be
+            // a good enough compromise and catch most all non-integer errors. To make it compliant,
+            // we would simply need to change the mantissa to int16, but this add compiled flash space.
+            // Maybe update this later.
+            int_value = trunc(value);
+            mantissa  = round(100 * (value - int_value));  // Compute mantissa for Gxx.x commands.
+            // NOTE: Rounding must be used to catch small floating point errors.
+        }
         // Check if the g-code word is supported or errors due to modal group violations or has
         // been repeated in the g-code block. If ok, update the command or record its value.
         switch (letter) {
@@ -254,6 +351,16 @@ Error gc_execute_line(char* line, uint8_t client) {
                         gc_block.non_modal_command = NonModal::AbsoluteOverride;
                         mg_word_bit                = ModalGroup::MG0;
                         break;
+#ifdef LASER_RASTER
+                    case 7:
+                        if (axis_command != AxisCommand::None) {
+                            FAIL(Error::GcodeAxisCommandConflict);  // [Axis word/command conflict]
+                        }
+                        axis_command               = AxisCommand::NonModal;
+                        gc_block.non_modal_command = NonModal::RasterScan;
+                        mg_word_bit                = ModalGroup::MG0;
+                        break;
+#endif
 
                     // Modal Group G1 - motion commands
                     case 0:  // G0 - linear rapid traverse
@@ -429,8 +536,12 @@ Error gc_execute_line(char* line, uint8_t client) {
                         if (mantissa != 0) {
                             FAIL(Error::GcodeUnsupportedCommand);  // [G61.1 not supported]
                         }
-                        // gc_block.modal.control = ControlMode::ExactPath; // G61
-                        mg_word_bit = ModalGroup::MG13;
+                        gc_block.modal.control = ControlMode::ExactPath;  // G61
+                        mg_word_bit            = ModalGroup::MG13;
+                        break;
+                    case 64:
+                        gc_block.modal.control = ControlMode::Continuous;  // G64
+                        mg_word_bit            = ModalGroup::MG13;
                         break;
                     default:
                         FAIL(Error::GcodeUnsupportedCommand);  // [Unsupported G command]
@@ -563,124 +674,68 @@ Error gc_execute_line(char* line, uint8_t client) {
                 /* Non-Command Words: This initial parsing phase only checks for repeats of the remaining
                legal g-code words and stores their value. Error-checking is performed later since some
                words (I,J,K,L,P,R) have multiple connotations and/or depend on the issued commands. */
-                GCodeWord axis_word_bit;
-                switch (letter) {
-                    case 'A':
-                        if (n_axis > A_AXIS) {
-                            axis_word_bit               = GCodeWord::A;
-                            gc_block.values.xyz[A_AXIS] = value;
-                            axis_words |= bit(A_AXIS);
-                        } else {
-                            FAIL(Error::GcodeUnsupportedCommand);
-                        }
-                        break;
-                    case 'B':
-                        if (n_axis > B_AXIS) {
-                            axis_word_bit               = GCodeWord::B;
-                            gc_block.values.xyz[B_AXIS] = value;
-                            axis_words |= bit(B_AXIS);
-                        } else {
+                if (gc_letter_word[letter - 'A'] == LetterUnsupported) {
+                    FAIL(Error::GcodeUnsupportedCommand);
+                }
+                GCodeWord axis_word_bit = GCodeWord(gc_letter_word[letter - 'A']);
+                switch (axis_word_bit) {
+                    case GCodeWord::X:
+                    case GCodeWord::Y:
+                    case GCodeWord::Z:
+                    case GCodeWord::A:
+                    case GCodeWord::B:
+                    case GCodeWord::C: {
+                        uint8_t axis = uint8_t(axis_word_bit) - uint8_t(GCodeWord::X);
+                        if (axis >= n_axis) {
                             FAIL(Error::GcodeUnsupportedCommand);
                         }
+                        gc_block.values.xyz[axis] = value;
+                        axis_words |= bit(axis);
                         break;
-                    case 'C':
-                        if (n_axis > C_AXIS) {
-                            axis_word_bit               = GCodeWord::C;
-                            gc_block.values.xyz[C_AXIS] = value;
-                            axis_words |= bit(C_AXIS);
-                        } else {
-                            FAIL(Error::GcodeUnsupportedCommand);
-                        }
+                    }
+                    case GCodeWord::I:
+                    case GCodeWord::J:
+                    case GCodeWord::K: {
+                        uint8_t axis              = uint8_t(axis_word_bit) - uint8_t(GCodeWord::I);
+                        gc_block.values.ijk[axis] = value;
+                        ijk_words |= bit(axis);
                         break;
-                    // case 'D': // Not supported
-                    case 'E':
-                        axis_word_bit     = GCodeWord::E;
-                        gc_block.values.e = int_value;
+                    }
+                    case GCodeWord::E:
+                        gc_block.values.e = trunc(value);
                         //grbl_msg_sendf(CLIENT_SERIAL, MSG_LEVEL_INFO, "E %d", gc_block.values.e);
                         break;
-                    case 'F':
-                        axis_word_bit     = GCodeWord::F;
+                    case GCodeWord::F:
                         gc_block.values.f = value;
                         break;
-                    // case 'H': // Not supported
-                    case 'I':
-                        axis_word_bit               = GCodeWord::I;
-                        gc_block.values.ijk[X_AXIS] = value;
-                        ijk_words |= bit(X_AXIS);
-                        break;
-                    case 'J':
-                        axis_word_bit               = GCodeWord::J;
-                        gc_block.values.ijk[Y_AXIS] = value;
-                        ijk_words |= bit(Y_AXIS);
-                        break;
-                    case 'K':
-                        axis_word_bit               = GCodeWord::K;
-                        gc_block.values.ijk[Z_AXIS] = value;
-                        ijk_words |= bit(Z_AXIS);
-                        break;
-                    case 'L':
-                        axis_word_bit     = GCodeWord::L;
-                        gc_block.values.l = int_value;
+                    case GCodeWord::L:
+                        gc_block.values.l = trunc(value);
                         break;
-                    case 'N':
-                        axis_word_bit     = GCodeWord::N;
+                    case GCodeWord::N:
                         gc_block.values.n = trunc(value);
                         break;
-                    case 'P':
-                        axis_word_bit     = GCodeWord::P;
+                    case GCodeWord::P:
                         gc_block.values.p = value;
                         break;
-                    case 'Q':
-                        axis_word_bit     = GCodeWord::Q;
+                    case GCodeWord::Q:
                         gc_block.values.q = value;
                         //grbl_msg_sendf(CLIENT_SERIAL, MSG_LEVEL_INFO, "Q %2.2f", value);
                         break;
-                    case 'R':
-                        axis_word_bit     = GCodeWord::R;
+                    case GCodeWord::R:
                         gc_block.values.r = value;
                         break;
-                    case 'S':
-                        axis_word_bit     = GCodeWord::S;
+                    case GCodeWord::S:
                         gc_block.values.s = value;
                         break;
-                    case 'T':
-                        axis_word_bit = GCodeWord::T;
+                    case GCodeWord::T: {
                         if (value > MaxToolNumber) {
                             FAIL(Error::GcodeMaxValueExceeded);
                         }
-                        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Tool No: %d", int_value);
-                        gc_state.tool = int_value;
-                        break;
-                    case 'X':
-                        if (n_axis > X_AXIS) {
-                            axis_word_bit               = GCodeWord::X;
-                            gc_block.values.xyz[X_AXIS] = value;
-                            axis_words |= bit(X_AXIS);
-
-                        } else {
-                            FAIL(Error::GcodeUnsupportedCommand);
-                        }
-                        break;
-                    case 'Y':
-                        if (n_axis > Y_AXIS) {
-                            axis_word_bit               = GCodeWord::Y;
-                            gc_block.values.xyz[Y_AXIS] = value;
-                            axis_words |= bit(Y_AXIS);
-                        } else {
-                            FAIL(Error::GcodeUnsupportedCommand);
-                        }
-                        break;
-                    case 'Z':
-                        if (n_axis > Z_AXIS) {
-                            axis_word_bit               = GCodeWord::Z;
-                            gc_block.values.xyz[Z_AXIS] = value;
-                            axis_words |= bit(Z_AXIS);
-                        } else {
-                            FAIL(Error::GcodeUnsupportedCommand);
-                        }
+                        uint8_t tool = trunc(value);
+                        grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Tool No: %d", tool);
+                        gc_state.tool = tool;
                         break;
-                    default:
-                        FAIL(Error::GcodeUnsupportedCommand);
+                    }
                 }
                 // NOTE: Variable 'axis_word_bit' is always assigned, if the non-command letter is valid.
                 uint32_t bitmask = bit(axis_word_bit);
@@ -894,7 +949,18 @@ Error gc_execute_line(char* line, uint8_t client) {
             coords[gc_block.modal.coord_select]->get(block_coord_system);
         }
     }
-    // [16. Set path control mode ]: N/A. Only G61. G61.1 and G64 NOT SUPPORTED.
+    // [16. Set path control mode ]: P tolerance is negative (done.) G61.1 NOT SUPPORTED.
+    // NOTE: If G4 or G10 is in the same block, the P word belongs to them and G64 uses the default tolerance.
+    float path_tolerance = PATH_BLEND_DEFAULT_TOLERANCE;
+    if (bit_istrue(command_words, bit(ModalGroup::MG13)) && gc_block.modal.control == ControlMode::Continuous) {
+        if (bit_istrue(value_words, bit(GCodeWord::P)) && gc_block.non_modal_command != NonModal::SetCoordinateData) {
+            path_tolerance = gc_block.values.p;
+            if (gc_block.modal.units == Units::Inches) {
+                path_tolerance *= MM_PER_INCH;
+            }
+            bit_false(value_words, bit(GCodeWord::P));
+        }
+    }
     // [17. Set distance mode ]: N/A. Only G91.1. G90.1 NOT SUPPORTED.
     // [18. Set retract mode ]: NOT SUPPORTED.
     // [19. Remaining non-modal actions ]: Check go to predefined position, set G10, or set axis offsets.
@@ -974,6 +1040,41 @@ Error gc_execute_line(char* line, uint8_t client) {
                 }
             }
             break;
+#ifdef LASER_RASTER
+        case NonModal::RasterScan:
+            // [G7 Errors]: Not in laser mode. D word missing. Not exactly one axis word. Pitch is zero.
+            //   More pixels than the raster buffer holds. Feed rate is undefined.
+            // NOTE: The axis word is the signed pitch of the pixels, so it is incremental in G90 too.
+            if (!spindle->inLaserMode()) {
+                FAIL(Error::GcodeUnsupportedCommand);  // [G7 outside laser mode]
+            }
+            if (raster_data == NULL) {
+                FAIL(Error::GcodeValueWordMissing);  // [D word missing]
+            }
+            if (!axis_words) {
+                FAIL(Error::GcodeNoAxisWords);  // [No axis words]
+            }
+            if (axis_words & (axis_words - 1)) {
+                FAIL(Error::GcodeAxisCommandConflict);  // [More than one axis word]
+            }
+            if (raster_pixels > RASTER_BUFFER_SIZE) {
+                FAIL(Error::GcodeMaxValueExceeded);  // [Scanline exceeds raster buffer]
+            }
+            if (gc_block.values.f == 0.0) {
+                FAIL(Error::GcodeUndefinedFeedRate);  // [Feed rate undefined]
+            }
+            for (idx = 0; idx < n_axis; idx++) {
+                if (bit_istrue(axis_words, bit(idx))) {
+                    if (gc_block.values.xyz[idx] == 0.0) {
+                        FAIL(Error::GcodeInvalidTarget);  // [Zero pitch]
+                    }
+                    gc_block.values.xyz[idx] = gc_state.position[idx] + gc_block.values.xyz[idx] * raster_pixels;
+                } else {
+                    gc_block.values.xyz[idx] = gc_state.position[idx];
+                }
+            }
+            break;
+#endif
         default:
             // At this point, the rest of the explicit axis commands treat the axis values as the traditional
             // target position with the coordinate system offsets, G92 offsets, absolute override, and distance
@@ -1262,6 +1363,11 @@ Error gc_execute_line(char* line, uint8_t client) {
     if (value_words) {
         FAIL(Error::GcodeUnusedWords);  // [Unused words]
     }
+#ifdef LASER_RASTER
+    if (raster_data != NULL && gc_block.non_modal_command != NonModal::RasterScan) {
+        FAIL(Error::GcodeUnusedWords);  // [D word without G7]
+    }
+#endif
     /* -------------------------------------------------------------------------------------
        STEP 4: EXECUTE!!
        Assumes that all error-checking has been completed and no failure modes exist. We just
@@ -1298,14 +1404,15 @@ Error gc_execute_line(char* line, uint8_t client) {
     }
     // If in laser mode, setup laser power based on current and past parser conditions.
     if (spindle->inLaserMode()) {
+        // NOTE: A G7 scanline engraves whatever the motion mode, so it is a laser motion like G1.
         if (!((gc_block.modal.motion == Motion::Linear) || (gc_block.modal.motion == Motion::CwArc) ||
-              (gc_block.modal.motion == Motion::CcwArc))) {
+              (gc_block.modal.motion == Motion::CcwArc) || (gc_block.non_modal_command == NonModal::RasterScan))) {
             gc_parser_flags |= GCParserLaserDisable;
         }
         // Any motion mode with axis words is allowed to be passed from a spindle speed update.
         // NOTE: G1 and G0 without axis words sets axis_command to none. G28/30 are intentionally omitted.
         // TODO: Check sync conditions for M3 enabled motions that don't enter the planner. (zero length).
-        if (axis_words && (axis_command == AxisCommand::MotionMode)) {
+        if (axis_words && (axis_command == AxisCommand::MotionMode || gc_block.non_modal_command == NonModal::RasterScan)) {
             gc_parser_flags |= GCParserLaserIsMotion;
         } else {
             // M3 constant power laser requires planner syncs to update the laser when changing between
@@ -1462,8 +1569,11 @@ Error gc_execute_line(char* line, uint8_t client) {
         memcpy(gc_state.coord_system, block_coord_system, sizeof(gc_state.coord_system));
         system_flag_wco_change();
     }
-    // [16. Set path control mode ]: G61.1/G64 NOT SUPPORTED
-    // gc_state.modal.control = gc_block.modal.control; // NOTE: Always default.
+    // [16. Set path control mode ]: G61.1 NOT SUPPORTED
+    gc_state.modal.control = gc_block.modal.control;
+    if (bit_istrue(command_words, bit(ModalGroup::MG13)) && gc_state.modal.control == ControlMode::Continuous) {
+        gc_state.path_tolerance = path_tolerance;
+    }
     // [17. Set distance mode ]:
     gc_state.modal.distance = gc_block.modal.distance;
     // [18. Set retract mode ]: NOT SUPPORTED
@@ -1484,10 +1594,10 @@ Error gc_execute_line(char* line, uint8_t client) {
             pl_data->motion.rapidMotion = 1;  // Set rapid motion flag.
             if (axis_command != AxisCommand::None) {
                 limitsCheckSoft(gc_block.values.xyz);
-                cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
+                mc_cartesian_line(gc_block.values.xyz, pl_data, gc_state.position);
             }
             limitsCheckSoft(coord_data);
-            cartesian_to_motors(coord_data, pl_data, gc_state.position);
+            mc_cartesian_line(coord_data, pl_data, gc_state.position);
             memcpy(gc_state.position, coord_data, sizeof(gc_state.position));
             break;
         case NonModal::SetHome0:
@@ -1504,6 +1614,12 @@ Error gc_execute_line(char* line, uint8_t client) {
             clear_vector(gc_state.coord_offset);  // Disable G92 offsets by zeroing offset vector.
             system_flag_wco_change();
             break;
+#ifdef LASER_RASTER
+        case NonModal::RasterScan:
+            mc_raster(gc_block.values.xyz, pl_data, raster_data, raster_pixels);
+            memcpy(gc_state.position, gc_block.values.xyz, sizeof(gc_block.values.xyz));
+            break;
+#endif
         default:
             break;
     }
@@ -1513,14 +1629,19 @@ Error gc_execute_line(char* line, uint8_t client) {
     gc_state.modal.motion = gc_block.modal.motion;
     if (gc_state.modal.motion != Motion::None) {
         if (axis_command == AxisCommand::MotionMode) {
+#ifdef ENABLE_SD_COMPILE
+            if (gc_motion_capture) {
+                gc_capture_motion(pl_data, axis_0, axis_1, axis_linear);
+            }
+#endif
             GCUpdatePos gc_update_pos = GCUpdatePos::Target;
             if (gc_state.modal.motion == Motion::Linear) {
                 limitsCheckSoft(gc_block.values.xyz);
-                cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
+                mc_cartesian_line(gc_block.values.xyz, pl_data, gc_state.position);
             } else if (gc_state.modal.motion == Motion::Seek) {
                 pl_data->motion.rapidMotion = 1;  // Set rapid motion flag.
                 limitsCheckSoft(gc_block.values.xyz);
-                cartesian_to_motors(gc_block.values.xyz, pl_data, gc_state.position);
+                mc_cartesian_line(gc_block.values.xyz, pl_data, gc_state.position);
             } else if ((gc_state.modal.motion == Motion::CwArc) || (gc_state.modal.motion == Motion::CcwArc)) {
                 mc_arc(gc_block.values.xyz,
                        pl_data,
@@ -63,6 +63,7 @@ enum class ModalGroup : uint8_t {
 enum class NonModal : uint8_t {
     NoAction              = 0,    // (Default: Must be zero)
     Dwell                 = 4,    // G4 (Do not alter value)
+    RasterScan            = 7,    // G7 (Do not alter value)
     SetCoordinateData     = 10,   // G10 (Do not alter value)
     GoHome0               = 28,   // G28 (Do not alter value)
     SetHome0              = 38,   // G28.1 (Do not alter value)
@@ -134,7 +135,8 @@ enum class CutterCompensation : uint8_t {
 
 // Modal Group G13: Control mode
 enum class ControlMode : uint8_t {
-    ExactPath = 0,  // G61 (Default: Must be zero)
+    ExactPath  = 0,  // G61 (Default: Must be zero)
+    Continuous = 1,  // G64
 };
 
 // Modal Group M7: Spindle control
@@ -269,7 +271,7 @@ typedef struct {
     // CutterCompensation cutter_comp;  // {G40} NOTE: Don't track. Only default supported.
     ToolLengthOffset tool_length;   // {G43.1,G49}
     CoordIndex       coord_select;  // {G54,G55,G56,G57,G58,G59}
-    // uint8_t control;      // {G61} NOTE: Don't track. Only default supported.
+    ControlMode      control;       // {G61,G64}
     ProgramFlow  program_flow;  // {M0,M1,M2,M30}
     CoolantState coolant;       // {M7,M8,M9}
     SpindleState spindle;       // {M3,M4,M5}
@@ -307,6 +309,7 @@ typedef struct {
     float coord_offset[MAX_N_AXIS];  // Retains the G92 coordinate offset (work coordinates) relative to
     // machine zero in mm. Non-persistent. Cleared upon reset and boot.
     float tool_length_offset;  // Tracks tool length offset value when enabled.
+    float path_tolerance;      // G64 path blending tolerance in mm.
 } parser_state_t;
 extern parser_state_t gc_state;
 
@@ -88,6 +88,7 @@ static void reset_variables() {
     sys_rt_exec_accessory_override.value = 0;
     sys_rt_exec_alarm                    = ExecAlarm::None;
     cycle_stop                           = false;
+    jog_spinup_pending                   = false;
     sys_rt_f_override                    = FeedOverride::Default;
     sys_rt_r_override                    = RapidOverride::Default;
     sys_rt_s_override                    = SpindleSpeedOverride::Default;
@@ -100,6 +101,10 @@ static void reset_variables() {
     limits_init();
     probe_init();
     plan_reset();  // Clear block buffer and planner variables
+    mc_reset_blend();
+#ifdef LASER_RASTER
+    raster_reset();
+#endif
     st_reset();    // Clear stepper subsystem variables
     // Sync cleared gcode and planner positions to current system position.
     plan_sync_position();
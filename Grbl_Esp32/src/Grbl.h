@@ -59,6 +59,7 @@ const char* const GRBL_VERSION_BUILD = "20211103";
 #include "Motors/Motors.h"
 #include "Stepper.h"
 #include "Jog.h"
+#include "Raster.h"
 #include "WebUI/InputBuffer.h"
 #include "Settings.h"
 #include "SettingsDefinitions.h"
@@ -70,6 +71,7 @@ const char* const GRBL_VERSION_BUILD = "20211103";
 
 // Do not guard this because it is needed for local files too
 #include "SDCard.h"
+#include "SDCompile.h"
 
 #ifdef ENABLE_BLUETOOTH
 #    include "WebUI/BTConfig.h"
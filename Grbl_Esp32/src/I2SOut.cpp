@@ -368,6 +368,10 @@ static int IRAM_ATTR i2s_fillout_dma_buffer(lldesc_t* dma_desc) {
         // the generation of the buffer is interrupted (the buffer length is shortened slightly)
         // and the pulse generation is postponed until the next buffer is filled.
         //
+        // Step events that are due before the next sample are rendered back to back without retaking
+        // the lock, and the idle time up to the next pulse is filled in a single run, instead of
+        // testing the pulse timer and reloading the port data for every sample.
+        //
         o_dma.rw_pos = 0;
         while (o_dma.rw_pos < (DMA_SAMPLE_COUNT - SAMPLE_SAFE_COUNT)) {
             // no data to read (buffer empty)
@@ -376,12 +380,15 @@ static int IRAM_ATTR i2s_fillout_dma_buffer(lldesc_t* dma_desc) {
                 if (i2s_out_pulser_status == STEPPING) {
                     // fillout future DMA buffer (tail of the DMA buffer chains)
                     if (i2s_out_pulse_func != NULL) {
-                        uint32_t old_rw_pos = o_dma.rw_pos;
-                        I2S_OUT_PULSER_EXIT_CRITICAL();   // Temporarily unlocked status lock as it may be locked in pulse callback.
-                        (*i2s_out_pulse_func)();          // should be pushed into buffer max DMA_SAMPLE_SAFE_COUNT
+                        I2S_OUT_PULSER_EXIT_CRITICAL();  // Temporarily unlocked status lock as it may be locked in pulse callback.
+                        do {
+                            uint32_t old_rw_pos = o_dma.rw_pos;
+                            (*i2s_out_pulse_func)();  // should be pushed into buffer max DMA_SAMPLE_SAFE_COUNT
+                            // Calculate pulse period.
+                            i2s_out_remain_time_until_next_pulse += i2s_out_pulse_period - I2S_OUT_USEC_PER_PULSE * (o_dma.rw_pos - old_rw_pos);
+                        } while (i2s_out_remain_time_until_next_pulse < I2S_OUT_USEC_PER_PULSE && i2s_out_pulser_status == STEPPING &&
+                                 o_dma.rw_pos < (DMA_SAMPLE_COUNT - SAMPLE_SAFE_COUNT));
                         I2S_OUT_PULSER_ENTER_CRITICAL();  // Lock again.
-                        // Calculate pulse period.
-                        i2s_out_remain_time_until_next_pulse += i2s_out_pulse_period - I2S_OUT_USEC_PER_PULSE * (o_dma.rw_pos - old_rw_pos);
                         if (i2s_out_pulser_status == WAITING) {
                             // i2s_out_set_passthrough() has called from the pulse function.
                             // It needs to go into pass-through mode.
@@ -401,9 +408,18 @@ static int IRAM_ATTR i2s_fillout_dma_buffer(lldesc_t* dma_desc) {
                 }
             }
             // no pulse data in push buffer (pulse off or idle or callback is not defined)
-            buf[o_dma.rw_pos++] = atomic_load(&i2s_out_port_data);
+            // Fill up to the next pulse, or to the end of the buffer if no pulse is due.
+            uint32_t n = DMA_SAMPLE_COUNT - SAMPLE_SAFE_COUNT - o_dma.rw_pos;
             if (i2s_out_remain_time_until_next_pulse >= I2S_OUT_USEC_PER_PULSE) {
-                i2s_out_remain_time_until_next_pulse -= I2S_OUT_USEC_PER_PULSE;
+                uint32_t until_pulse = i2s_out_remain_time_until_next_pulse / I2S_OUT_USEC_PER_PULSE;
+                if (n > until_pulse) {
+                    n = until_pulse;
+                }
+                i2s_out_remain_time_until_next_pulse -= n * I2S_OUT_USEC_PER_PULSE;
+            }
+            uint32_t port_data = atomic_load(&i2s_out_port_data);
+            for (uint32_t i = 0; i < n; i++) {
+                buf[o_dma.rw_pos++] = port_data;
             }
         }
         // set filled length to the DMA descriptor
@@ -23,6 +23,8 @@
 
 #include "Grbl.h"
 
+bool jog_spinup_pending;
+
 // Sets up valid jog motion received from g-code parser, checks for soft-limits, and executes the jog.
 // cancelledInflight will be set to true if was not added to parser due to a cancelJog.
 Error jog_execute(plan_line_data_t* pl_data, parser_block_t* gc_block, bool* cancelledInflight) {
@@ -47,8 +49,13 @@ Error jog_execute(plan_line_data_t* pl_data, parser_block_t* gc_block, bool* can
     if (sys.state == State::Idle) {
         if (plan_get_current_block() != NULL) {  // Check if there is a block to execute.
             sys.state = State::Jog;
-            st_prep_buffer();
-            st_wake_up();  // NOTE: Manual start. No state machine required.
+            if (spindle->at_speed()) {
+                st_prep_buffer();
+                st_wake_up();  // NOTE: Manual start. No state machine required.
+            } else {
+                jog_spinup_pending               = true;
+                sys_rt_exec_state.bit.cycleStart = true;
+            }
         }
     }
     return Error::Ok;
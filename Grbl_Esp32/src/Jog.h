@@ -27,6 +27,10 @@
 // System motion line numbers must be zero.
 const int JOG_LINE_NUMBER = 0;
 
+// Set while the planned jog motions wait for the spindle to get up to speed. The cycle start
+// starts them once it is, and a jog cancel drops them.
+extern bool jog_spinup_pending;
+
 // Sets up valid jog motion received from g-code parser, checks for soft-limits, and executes the jog.
 // cancelledInflight will be set to true if was not added to parser due to a cancelJog.
 Error jog_execute(plan_line_data_t* pl_data, parser_block_t* gc_block, bool* cancelledInflight);
@@ -155,10 +155,12 @@ void limits_go_home(uint8_t cycle_mask) {
         // Perform homing cycle. Planner buffer should be empty, as required to initiate the homing cycle.
         pl_data->feed_rate = homing_rate;   // Set current homing rate.
         plan_buffer_line(target, pl_data);  // Bypass mc_line(). Directly plan homing motion.
-        sys.step_control                  = {};
-        sys.step_control.executeSysMotion = true;  // Set to execute homing motion and clear existing flags.
-        st_prep_buffer();                          // Prep and fill segment buffer from newly planned block.
-        st_wake_up();                              // Initiate motion
+        sys_update_step_control([](StepControl& control) {
+            control                  = {};
+            control.executeSysMotion = true;  // Set to execute homing motion and clear existing flags.
+        });
+        st_prep_buffer();  // Prep and fill segment buffer from newly planned block.
+        st_wake_up();      // Initiate motion
         do {
             if (approach) {
                 // Check limit state. Lock out cycle axes when they change.
@@ -250,7 +252,7 @@ void limits_go_home(uint8_t cycle_mask) {
             }
         }
     }
-    sys.step_control = {};                      // Return step control to normal operation.
+    sys_update_step_control([](StepControl& control) { control = {}; });  // Return step control to normal operation.
     motors_set_homing_mode(cycle_mask, false);  // tell motors homing is done
 }
 
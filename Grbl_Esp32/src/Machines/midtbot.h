@@ -28,6 +28,7 @@
 #define MACHINE_NAME "midTbot"
 
 #define CUSTOM_CODE_FILENAME    "../Custom/CoreXY.cpp"
+#define USE_KINEMATICS          // there are kinematic equations for this machine
 
 #define MIDTBOT         // applies the midTbot geometry correction to the CoreXY kinematics 
 
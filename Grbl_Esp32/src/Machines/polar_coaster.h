@@ -30,13 +30,14 @@
 // This causes the custom code file to be included in the build
 // via ../custom_code.cpp
 #define CUSTOM_CODE_FILENAME "Custom/polar_coaster.cpp"
+#define USE_KINEMATICS  // there are kinematic equations for this machine
 
 #define SPINDLE_TYPE SpindleType::NONE
 
 #define RADIUS_AXIS 0
 #define POLAR_AXIS 1
 
-#define SEGMENT_LENGTH 0.5 // segment length in mm
+#define SEGMENT_LENGTH 10.0 // longest segment in mm, shorter to keep within $12
 
 #define X_STEP_PIN              GPIO_NUM_15
 #define Y_STEP_PIN              GPIO_NUM_2
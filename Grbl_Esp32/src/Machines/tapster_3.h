@@ -20,6 +20,7 @@
 #define MACHINE_NAME            "Tapster 3 Delta (Dynamixel)"
 
 #define CUSTOM_CODE_FILENAME "Custom/parallel_delta.cpp"
+#define USE_KINEMATICS      // there are kinematic equations for this machine
 
 #define N_AXIS 3
 
@@ -29,7 +30,7 @@
 #define RADIUS_EFF                  133.5  // radius of end effector side (length of linkages)
 #define LENGTH_FIXED_SIDE           179.437f  // sized of fixed side triangel
 #define LENGTH_EFF_SIDE             86.6025f  // size of end effector side triangle
-#define KINEMATIC_SEGMENT_LENGTH    1.0f            // segment length in mm
+#define KINEMATIC_SEGMENT_LENGTH    10.0f           // longest segment in mm, shorter to keep within $12
 #define MAX_NEGATIVE_ANGLE          -(M_PI / 3.0)   // 60 degrees up
 #define MAX_POSITIVE_ANGLE          (M_PI / 2.0)    // 90 degrees down
 #define ARM_INTERNAL_ANGLE          0.05 // radians 2.866°  // due to mounting angle 
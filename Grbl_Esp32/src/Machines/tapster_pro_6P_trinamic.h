@@ -20,6 +20,7 @@
 
 #define MACHINE_NAME "Tapster Pro Delta 6P Trinamic"
 #define CUSTOM_CODE_FILENAME "Custom/parallel_delta.cpp"
+#define USE_KINEMATICS      // there are kinematic equations for this machine
 /*
 // enable these special machine functions to be called from the main program
 #define USE_KINEMATICS             // there are kinematic equations for this machine
@@ -45,7 +46,7 @@
 #define RADIUS_EFF                  220.0f          // radius of end effector side (length of linkages)
 #define LENGTH_FIXED_SIDE           294.449f        // sized of fixed side triangel
 #define LENGTH_EFF_SIDE             86.6025f        // size of end effector side triangle
-#define KINEMATIC_SEGMENT_LENGTH    1.0f            // segment length in mm
+#define KINEMATIC_SEGMENT_LENGTH    10.0f           // longest segment in mm, shorter to keep within $12
 #define MAX_NEGATIVE_ANGLE          -0.75f          //
 #define MAX_POSITIVE_ANGLE          (M_PI / 2.0)    //
 
@@ -33,6 +33,120 @@
 
 SquaringMode ganged_mode = SquaringMode::Dual;
 
+// G64 path blending state. The last line motion is held back here, in cartesian coordinates, while
+// following motions keep every vertex in between within the path tolerance of a single fused line.
+static bool             blend_pending = false;
+static uint8_t          blend_vertex_count;
+static float            blend_start[MAX_N_AXIS];
+static float            blend_target[MAX_N_AXIS];
+static float            blend_vertex[PATH_BLEND_MAX_VERTICES][MAX_N_AXIS];
+static plan_line_data_t blend_data;
+
+static bool mc_buffer_line(float* target, plan_line_data_t* pl_data, plan_arc_t* arc = NULL);
+
+// Returns true if the line motion can take part in G64 path blending. Rapids, system motions, jogs
+// and inverse time motions are always executed exactly as programmed.
+static bool mc_blend_allowed(plan_line_data_t* pl_data) {
+    return gc_state.modal.control == ControlMode::Continuous && !pl_data->motion.rapidMotion && !pl_data->motion.systemMotion &&
+           !pl_data->motion.inverseTime && !pl_data->is_jog;
+}
+
+// Returns true if the point is within the tolerance of the line segment from start to end.
+static bool mc_blend_within_tolerance(float* start, float* end, float* point, float tolerance) {
+    float   length_sqr = 0.0;
+    float   dot        = 0.0;
+    float   distance_sqr;
+    float   delta;
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        delta = end[idx] - start[idx];
+        length_sqr += delta * delta;
+        dot += delta * (point[idx] - start[idx]);
+    }
+    // Project the point onto the segment, clamped to its end points.
+    float t = 0.0;
+    if (length_sqr > 0.0) {
+        t = constrain(dot / length_sqr, 0.0f, 1.0f);
+    }
+    distance_sqr = 0.0;
+    for (idx = 0; idx < n_axis; idx++) {
+        delta = start[idx] + t * (end[idx] - start[idx]) - point[idx];
+        distance_sqr += delta * delta;
+    }
+    return distance_sqr <= tolerance * tolerance;
+}
+
+// Tries to extend the held back motion to the new target. Fails if the motion conditions differ or
+// if any vertex of the original path would leave the tolerance band around the fused line.
+static bool mc_blend_extend(float* target, plan_line_data_t* pl_data) {
+    if (pl_data->feed_rate != blend_data.feed_rate || pl_data->spindle_speed != blend_data.spindle_speed ||
+        pl_data->spindle != blend_data.spindle || pl_data->coolant.Mist != blend_data.coolant.Mist ||
+        pl_data->coolant.Flood != blend_data.coolant.Flood || pl_data->motion.noFeedOverride != blend_data.motion.noFeedOverride) {
+        return false;
+    }
+    if (blend_vertex_count == PATH_BLEND_MAX_VERTICES) {
+        return false;
+    }
+    float tolerance = gc_state.path_tolerance;
+    if (!mc_blend_within_tolerance(blend_start, target, blend_target, tolerance)) {
+        return false;
+    }
+    uint8_t idx;
+    for (idx = 0; idx < blend_vertex_count; idx++) {
+        if (!mc_blend_within_tolerance(blend_start, target, blend_vertex[idx], tolerance)) {
+            return false;
+        }
+    }
+    auto n_axis = number_axis->get();
+    memcpy(blend_vertex[blend_vertex_count++], blend_target, n_axis * sizeof(float));
+    memcpy(blend_target, target, n_axis * sizeof(float));
+#ifdef USE_LINE_NUMBERS
+    blend_data.line_number = pl_data->line_number;
+#endif
+    return true;
+}
+
+// Sends any motion held back by G64 path blending to the planner. Must be called before anything
+// that waits on, or bypasses, the planner buffer.
+void mc_flush_blend() {
+    if (blend_pending) {
+        blend_pending = false;
+        cartesian_to_motors(blend_target, &blend_data, blend_start);
+    }
+}
+
+// Discards any motion held back by G64 path blending. Called upon system reset.
+void mc_reset_blend() {
+    blend_pending = false;
+}
+
+// Execute a g-code line motion, or an arc chord, from position to target in cartesian coordinates.
+// In G64 path control mode, the motion may be held back and fused with the following motions. It
+// goes to cartesian_to_motors() once that is done, so the path tolerance applies to the tool path
+// and not to motor coordinates on machines with kinematics.
+// returns true if the line was submitted or held back, or false if intentionally dropped.
+bool mc_cartesian_line(float* target, plan_line_data_t* pl_data, float* position) {
+    if (sys.state == State::CheckMode || !mc_blend_allowed(pl_data)) {
+        mc_flush_blend();
+        return cartesian_to_motors(target, pl_data, position);
+    }
+    if (blend_pending && mc_blend_extend(target, pl_data)) {
+        return true;
+    }
+    mc_flush_blend();
+    if (sys.abort) {
+        return false;
+    }
+    auto n_axis = number_axis->get();
+    memcpy(blend_start, position, n_axis * sizeof(float));
+    memcpy(blend_target, target, n_axis * sizeof(float));
+    memcpy(&blend_data, pl_data, sizeof(plan_line_data_t));
+    blend_vertex_count = 0;
+    blend_pending      = true;
+    return true;
+}
+
 // Execute linear motion in absolute millimeter coordinates. Feed rate given in millimeters/second
 // unless invert_feed_rate is true. Then the feed_rate means that the motion should be completed in
 // (1 minute)/feed_rate time.
@@ -42,15 +156,18 @@ SquaringMode ganged_mode = SquaringMode::Dual;
 // in the planner and to let backlash compensation or canned cycle integration simple and direct.
 // returns true if line was submitted to planner, or false if intentionally dropped.
 bool mc_line(float* target, plan_line_data_t* pl_data) {
-    bool submitted_result = false;
-    // store the plan data so it can be cancelled by the protocol system if needed
-    sys_pl_data_inflight = pl_data;
-
     // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
     if (sys.state == State::CheckMode) {
-        sys_pl_data_inflight = NULL;
-        return submitted_result;
+        return false;
     }
+    return mc_buffer_line(target, pl_data);
+}
+
+// Waits for room in the planner buffer and plans the line motion, or the arc if one is given.
+static bool mc_buffer_line(float* target, plan_line_data_t* pl_data, plan_arc_t* arc) {
+    bool submitted_result = false;
+    // store the plan data so it can be cancelled by the protocol system if needed
+    sys_pl_data_inflight = pl_data;
     // NOTE: Backlash compensation may be installed here. It will need direction info to track when
     // to insert a backlash line motion(s) before the intended line motion and will require its own
     // plan_check_full_buffer() and check for system abort loop. Also for position reporting
@@ -81,7 +198,15 @@ bool mc_line(float* target, plan_line_data_t* pl_data) {
     // Plan and queue motion into planner buffer
     // uint8_t plan_status; // Not used in normal operation.
     if (sys_pl_data_inflight == pl_data) {
+#ifdef PLANNER_ARCS
+        if (arc != NULL) {
+            plan_buffer_arc(target, pl_data, arc);
+        } else {
+            plan_buffer_line(target, pl_data);
+        }
+#else
         plan_buffer_line(target, pl_data);
+#endif
         submitted_result = true;
     }
     sys_pl_data_inflight = NULL;
@@ -103,6 +228,174 @@ void __attribute__((weak)) motors_to_cartesian(float* cartesian, float* motors,
 }
 
 void __attribute__((weak)) forward_kinematics(float* position) {}
+
+// The length of the last segment that mc_kinematics_line() found within the tolerance. Consecutive
+// lines usually bend the same way, so the next line starts from it instead of searching again.
+static float kinematics_segment_length = 0.0;
+
+// Plans a line motion on a machine with kinematics. The line is split into segments that each stay
+// within the arc tolerance of the straight cartesian line once transformed to motor space. Each
+// segment is checked at its midpoint, and its length adapts as the path bends more or less, up to
+// max_segment_length (0 for no limit). The transform of a segment end is reused as the start of
+// the next one. On entry, motors is the motor position the line starts near; on return, it is the
+// motor position of the last segment sent to mc_line(). Returns false if a point is unreachable or
+// if mc_line() drops a segment.
+bool mc_kinematics_line(float*                 target,
+                        plan_line_data_t*      pl_data,
+                        float*                 position,
+                        kinematics_transform_t transform,
+                        float                  max_segment_length,
+                        float*                 motors) {
+    float   start_motors[MAX_N_AXIS];
+    float   end_motors[MAX_N_AXIS];
+    float   mid_motors[MAX_N_AXIS];
+    float   point[MAX_N_AXIS];
+    float   distance = 0.0;
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        distance += (target[idx] - position[idx]) * (target[idx] - position[idx]);
+    }
+    distance = sqrtf(distance);
+    if (!transform(position, start_motors, motors)) {
+        return false;
+    }
+    if (distance == 0.0) {
+        return true;
+    }
+    if (max_segment_length <= 0.0 || max_segment_length > distance) {
+        max_segment_length = distance;
+    }
+    // Near a singularity no length would be within the tolerance. Stop searching at this length.
+    float min_segment_length = max_segment_length / 64;
+    float tolerance          = arc_tolerance->get();
+    float feed_rate          = pl_data->feed_rate;
+    float length             = kinematics_segment_length;
+    float done               = 0.0;  // Distance along the line already planned
+    while (true) {
+        if (length <= 0.0 || length > max_segment_length) {
+            length = max_segment_length;
+        }
+        bool  last    = length >= distance - done;
+        float segment = last ? distance - done : length;
+        float end     = (done + segment) / distance;
+        float mid     = (done + segment / 2) / distance;
+        for (idx = 0; idx < n_axis; idx++) {
+            point[idx] = last ? target[idx] : position[idx] + (target[idx] - position[idx]) * end;
+        }
+        if (!transform(point, end_motors, start_motors)) {
+            pl_data->feed_rate = feed_rate;
+            return false;
+        }
+        for (idx = 0; idx < n_axis; idx++) {
+            point[idx] = position[idx] + (target[idx] - position[idx]) * mid;
+        }
+        if (!transform(point, mid_motors, start_motors)) {
+            pl_data->feed_rate = feed_rate;
+            return false;
+        }
+        float motor_distance = 0.0;
+        float error          = 0.0;
+        for (idx = 0; idx < n_axis; idx++) {
+            float delta = end_motors[idx] - start_motors[idx];
+            motor_distance += delta * delta;
+            delta = mid_motors[idx] - (start_motors[idx] + end_motors[idx]) / 2;
+            error += delta * delta;
+        }
+        motor_distance = sqrtf(motor_distance);
+        // The midpoint error is in motor units. Scale it to mm by the motor distance per mm of the segment.
+        error = motor_distance > 0.0 ? sqrtf(error) * segment / motor_distance : 0.0;
+        if (error > tolerance && segment > min_segment_length) {
+            // The error grows with the square of the length. Aim a little inside the tolerance.
+            length = segment * 0.9f * sqrtf(tolerance / error);
+            if (length < min_segment_length) {
+                length = min_segment_length;
+            }
+            continue;
+        }
+        // The planner runs in motor units. Scale the feed rate so the tool moves at the programmed rate.
+        if (pl_data->motion.inverseTime) {
+            pl_data->feed_rate = feed_rate * distance / segment;
+        } else if (!pl_data->motion.rapidMotion && motor_distance > 0.0) {
+            pl_data->feed_rate = feed_rate * motor_distance / segment;
+        }
+        // mc_line() returns false if a jog is cancelled.
+        // In that case we stop sending segments to the planner.
+        if (!mc_line(end_motors, pl_data)) {
+            pl_data->feed_rate = feed_rate;
+            return false;
+        }
+        memcpy(start_motors, end_motors, sizeof(start_motors));
+        memcpy(motors, end_motors, n_axis * sizeof(motors[0]));
+        if (last) {
+            break;
+        }
+        done += segment;
+        kinematics_segment_length = length;
+        if (error < tolerance / 4) {
+            length *= 2;
+        }
+    }
+    pl_data->feed_rate = feed_rate;
+    return true;
+}
+
+#ifdef PLANNER_ARCS
+// Plans the arc as a single planner block, for the segment prep to trace. Returns false, leaving
+// the arc to be split into line motions, if it moves axes other than its plane and helical axes.
+static bool mc_arc_block(float*            target,
+                         plan_line_data_t* pl_data,
+                         float*            position,
+                         float*            offset,
+                         float             angular_travel,
+                         uint8_t           axis_0,
+                         uint8_t           axis_1,
+                         uint8_t           axis_linear) {
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        if (idx != axis_0 && idx != axis_1 && idx != axis_linear && target[idx] != position[idx]) {
+            return false;
+        }
+    }
+    plan_arc_t arc;
+    arc.center[0]      = position[axis_0] + offset[axis_0];
+    arc.center[1]      = position[axis_1] + offset[axis_1];
+    arc.radius[0]      = -offset[axis_0];
+    arc.radius[1]      = -offset[axis_1];
+    arc.angular_travel = angular_travel;
+    arc.linear_start   = position[axis_linear];
+    arc.linear_travel  = target[axis_linear] - position[axis_linear];
+    arc.axis_0         = axis_0;
+    arc.axis_1         = axis_1;
+    arc.axis_linear    = axis_linear;
+
+    // Between its end points, the arc reaches furthest out where it crosses the plane axes through
+    // its center. Check those points, every quarter turn, against the soft limits.
+    float radius      = hypot_f(arc.radius[0], arc.radius[1]);
+    float start_angle = atan2f(arc.radius[1], arc.radius[0]);
+    float quarter     = angular_travel > 0 ? M_PI / 2 : -M_PI / 2;
+    float angle       = (floorf(start_angle / quarter) + 1) * quarter;
+    float extreme[MAX_N_AXIS];
+    memcpy(extreme, position, sizeof(extreme));
+    while (fabsf(angle - start_angle) < fabsf(angular_travel)) {
+        extreme[axis_0]      = arc.center[0] + radius * cosf(angle);
+        extreme[axis_1]      = arc.center[1] + radius * sinf(angle);
+        extreme[axis_linear] = arc.linear_start + arc.linear_travel * (angle - start_angle) / angular_travel;
+        limitsCheckSoft(extreme);
+        angle += quarter;
+    }
+    limitsCheckSoft(target);
+
+    // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
+    if (sys.state != State::CheckMode) {
+        mc_flush_blend();
+        mc_buffer_line(target, pl_data, &arc);
+    }
+    return true;
+}
+#endif
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_X defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, isclockwise boolean. Used
@@ -144,6 +437,11 @@ void mc_arc(float*            target,
             angular_travel += 2 * M_PI;
         }
     }
+#ifdef PLANNER_ARCS
+    if (mc_arc_block(target, pl_data, position, offset, angular_travel, axis_0, axis_1, axis_linear)) {
+        return;
+    }
+#endif
     // NOTE: Segment end points are on the arc, which can lead to the arc diameter being smaller by up to
     // (2x) arc_tolerance. For 99% of users, this is just fine. If a different arc segment fit
     // is desired, i.e. least-squares, midpoint on arc, just change the mm_per_arc_segment calculation.
@@ -216,7 +514,7 @@ void mc_arc(float*            target,
             position[axis_linear] += linear_per_segment;
             pl_data->feed_rate = original_feedrate;  // This restores the feedrate kinematics may have altered
             limitsCheckSoft(position);
-            cartesian_to_motors(position, pl_data, previous_position);
+            mc_cartesian_line(position, pl_data, previous_position);
             previous_position[axis_0]      = position[axis_0];
             previous_position[axis_1]      = position[axis_1];
             previous_position[axis_linear] = position[axis_linear];
@@ -228,9 +526,27 @@ void mc_arc(float*            target,
     }
     // Ensure last segment arrives at target location.
     limitsCheckSoft(target);
-    cartesian_to_motors(target, pl_data, previous_position);
+    mc_cartesian_line(target, pl_data, previous_position);
 }
 
+#ifdef LASER_RASTER
+// Plans the scanline as a single line block. Its pixels go to the raster buffer first, where the
+// stepper ISR picks them up as it steps across them.
+void mc_raster(float* target, plan_line_data_t* pl_data, const char* data, uint32_t pixels) {
+    limitsCheckSoft(target);
+    // If in check gcode mode, prevent motion by blocking planner. Soft limits still work.
+    if (sys.state == State::CheckMode) {
+        return;
+    }
+    mc_flush_blend();
+    if (!raster_queue(data, pixels, &pl_data->raster_start)) {
+        return;  // Bail, if system abort.
+    }
+    pl_data->raster_pixels = pixels;
+    mc_buffer_line(target, pl_data);
+}
+#endif
+
 // Execute dwell in seconds.
 bool mc_dwell(int32_t milliseconds) {
     if (milliseconds <= 0 || sys.state == State::CheckMode) {
@@ -467,9 +783,12 @@ void mc_parking_motion(float* parking_target, plan_line_data_t* pl_data) {
     }
     uint8_t plan_status = plan_buffer_line(parking_target, pl_data);
     if (plan_status) {
-        sys.step_control.executeSysMotion = true;
-        sys.step_control.endMotion        = false;  // Allow parking motion to execute, if feed hold is active.
-        st_parking_setup_buffer();                  // Setup step segment buffer for special parking motion case
+        st_parking_setup_buffer();  // Setup step segment buffer for special parking motion case
+        // Only now let the segment prep task see the parking motion.
+        sys_update_step_control([](StepControl& control) {
+            control.executeSysMotion = true;
+            control.endMotion        = false;  // Allow parking motion to execute, if feed hold is active.
+        });
         st_prep_buffer();
         st_wake_up();
         do {
@@ -480,7 +799,7 @@ void mc_parking_motion(float* parking_target, plan_line_data_t* pl_data) {
         } while (sys.step_control.executeSysMotion);
         st_parking_restore_buffer();  // Restore step segment buffer to normal run state.
     } else {
-        sys.step_control.executeSysMotion = false;
+        sys_update_step_control([](StepControl& control) { control.executeSysMotion = false; });
         protocol_exec_rt_system();
     }
 }
@@ -38,6 +38,30 @@ const int PARKING_MOTION_LINE_NUMBER = 0;
 bool cartesian_to_motors(float* target, plan_line_data_t* pl_data, float* position);
 bool mc_line(float* target, plan_line_data_t* pl_data);  // returns true if line was submitted to planner
 
+// Execute a g-code line motion from position to target in cartesian coordinates. G64 path blending
+// may hold it back to fuse it with the following motions before it goes to cartesian_to_motors().
+bool mc_cartesian_line(float* target, plan_line_data_t* pl_data, float* position);
+
+// Inverse kinematics of a single point for mc_kinematics_line(). near is the motor position of a
+// point close by on the path, for machines with more than one solution, like a polar axis that can
+// reach an angle from either side. Returns false if the point is out of reach.
+typedef bool (*kinematics_transform_t)(float* cartesian, float* motors, const float* near);
+
+// Plans a line motion on a machine with kinematics, in segments that stay within the arc tolerance
+// of the cartesian line. For use by cartesian_to_motors().
+bool mc_kinematics_line(float*                 target,
+                        plan_line_data_t*      pl_data,
+                        float*                 position,
+                        kinematics_transform_t transform,
+                        float                  max_segment_length,
+                        float*                 motors);
+
+// Sends any line motion held back by G64 path blending to the planner.
+void mc_flush_blend();
+
+// Discards any line motion held back by G64 path blending.
+void mc_reset_blend();
+
 // Execute an arc in offset mode format. position == current xyz, target == target xyz,
 // offset == offset from current xyz, axis_XXX defines circle plane in tool space, axis_linear is
 // the direction of helical travel, radius == circle radius, is_clockwise_arc boolean. Used
@@ -52,6 +76,12 @@ void mc_arc(float*            target,
             uint8_t           axis_linear,
             uint8_t           is_clockwise_arc);
 
+#ifdef LASER_RASTER
+// Execute a G7 raster scanline from the current position to target, engraving the pixels given by
+// the data of the D word.
+void mc_raster(float* target, plan_line_data_t* pl_data, const char* data, uint32_t pixels);
+#endif
+
 // Dwell for a specific number of seconds
 bool mc_dwell(int32_t milliseconds);
 
@@ -83,6 +83,18 @@ namespace Motors {
         // states of the step pins are unknown.
         virtual void unstep() {}
 
+        // can_step_burst() returns true if the motor can take a
+        // whole train of step pulses from step_burst().  Motors
+        // that don't use step pulses at all can also return true.
+        virtual bool can_step_burst() { return false; }
+
+        // step_burst() queues the pulses of several consecutive
+        // stepper ISR ticks, period timer ticks apart.  The motor
+        // steps on every tick whose entry in step_bits has its
+        // axis bit set; tick 0 is due now.  It is called from
+        // motors_step_burst() with USE_RMT_STEP_BURSTS.
+        virtual void step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period) {}
+
         // test(), called from init(), checks to see if a motor is
         // responsive, returning true on failure.  Typical
         // implementations also display messages to show the result.
@@ -515,6 +515,37 @@ void motors_step(uint8_t step_mask) {
         }
     }
 }
+// True if every configured motor can take its pulses from motors_step_burst()
+bool motors_can_step_burst() {
+    auto n_axis = number_axis->get();
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        if (!myMotor[axis][0]->can_step_burst() || !myMotor[axis][1]->can_step_burst()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Queue the step pulses of several ISR ticks at once. step_bits holds the step mask of each tick.
+void motors_step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period) {
+    auto    n_axis    = number_axis->get();
+    uint8_t step_mask = 0;
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        step_mask |= step_bits[tick];
+    }
+
+    for (uint8_t axis = X_AXIS; axis < n_axis; axis++) {
+        if (bitnum_istrue(step_mask, axis)) {
+            if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::A)) {
+                myMotor[axis][0]->step_burst(step_bits, ticks, period);
+            }
+            if ((ganged_mode == SquaringMode::Dual) || (ganged_mode == SquaringMode::B)) {
+                myMotor[axis][1]->step_burst(step_bits, ticks, period);
+            }
+        }
+    }
+}
+
 // Turn all stepper pins off
 void motors_unstep() {
     auto n_axis = number_axis->get();
@@ -43,5 +43,7 @@ void    motors_set_disable(bool disable, uint8_t mask = B11111111);  // default
 bool    motors_direction(uint8_t dir_mask);
 void    motors_step(uint8_t step_mask);
 void    motors_unstep();
+bool    motors_can_step_burst();
+void    motors_step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period);
 
 void servoUpdateTask(void* pvParameters);
@@ -7,5 +7,6 @@ namespace Motors {
     public:
         Nullmotor(uint8_t axis_index);
         bool set_homing_mode(bool isHoming) { return false; }
+        bool can_step_burst() override { return true; }
     };
 }
@@ -38,6 +38,9 @@ namespace Motors {
 #endif
         virtual void update() = 0;  // This must be implemented by derived classes
 
+        // Servos follow the machine position rather than step pulses
+        bool can_step_burst() override { return true; }
+
     protected:
         // Start the servo update task.  Each derived subclass instance calls this
         // during init(), which happens after all objects have been constructed.
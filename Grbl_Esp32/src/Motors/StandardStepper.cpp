@@ -87,6 +87,10 @@ namespace Motors {
         rmtItem[0].level1              = !rmtConfig.tx_config.idle_level;
         rmt_config(&rmtConfig);
         rmt_fill_tx_items(rmtConfig.channel, &rmtItem[0], rmtConfig.mem_block_num, 0);
+#    ifdef USE_RMT_STEP_BURSTS
+        _rmt_step_item = rmtItem[0];
+        _burst_loaded  = false;
+#    endif
 
 #else
         pinMode(_step_pin, OUTPUT);
@@ -107,6 +111,13 @@ namespace Motors {
     }
 
     void StandardStepper::step() {
+#ifdef USE_RMT_STEP_BURSTS
+        if (_burst_loaded) {
+            RMTMEM.chan[_rmt_chan_num].data32[0].val = _rmt_step_item.val;
+            RMTMEM.chan[_rmt_chan_num].data32[1].val = 0;
+            _burst_loaded                            = false;
+        }
+#endif
 #ifdef USE_RMT_STEPS
         RMT.conf_ch[_rmt_chan_num].conf1.mem_rd_rst = 1;
         RMT.conf_ch[_rmt_chan_num].conf1.tx_start   = 1;
@@ -115,6 +126,41 @@ namespace Motors {
 #endif  // USE_RMT_STEPS
     }
 
+#ifdef USE_RMT_STEP_BURSTS
+    // Writes the pulse train straight into the channel memory, one item per pulse: the idle time since
+    // the previous pulse, then the pulse. Pulses are placed on the 4 MHz RMT clock relative to the
+    // start of the burst, so rounding does not accumulate. The direction delay shifts the whole train,
+    // as it does a single step.
+    void StandardStepper::step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period) {
+        const uint32_t timerTicksPerRmtTick = ticksPerMicrosecond / 4;
+        const uint8_t  axis_bit             = bit(_axis_index);
+        const uint32_t pulse                = _rmt_step_item.duration1;
+        uint32_t       pulse_end            = 0;
+        int            item                 = 0;
+        for (uint32_t tick = 0; tick < ticks; tick++) {
+            if (!(step_bits[tick] & axis_bit)) {
+                continue;
+            }
+            uint32_t start = _rmt_step_item.duration0 + tick * period / timerTicksPerRmtTick;
+            uint32_t idle  = start > pulse_end ? start - pulse_end : 1;
+
+            rmt_item32_t pulse_item = _rmt_step_item;
+            pulse_item.duration0    = idle;
+            pulse_item.duration1    = pulse;
+            RMTMEM.chan[_rmt_chan_num].data32[item++].val = pulse_item.val;
+            pulse_end += idle + pulse;
+        }
+        if (item == 0) {
+            return;
+        }
+        RMTMEM.chan[_rmt_chan_num].data32[item].val = 0;  // End marker
+        _burst_loaded                                = true;
+
+        RMT.conf_ch[_rmt_chan_num].conf1.mem_rd_rst = 1;
+        RMT.conf_ch[_rmt_chan_num].conf1.tx_start   = 1;
+    }
+#endif
+
     void StandardStepper::unstep() {
 #ifndef USE_RMT_STEPS
         digitalWrite(_step_pin, _invert_step_pin);
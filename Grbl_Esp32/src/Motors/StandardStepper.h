@@ -15,6 +15,10 @@ namespace Motors {
         void set_direction(bool) override;
         void step() override;
         void unstep() override;
+#ifdef USE_RMT_STEP_BURSTS
+        bool can_step_burst() override { return _rmt_chan_num != RMT_CHANNEL_MAX; }
+        void step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period) override;
+#endif
         void read_settings() override;
 
         void init_step_dir_pins();
@@ -24,6 +28,10 @@ namespace Motors {
 
 #ifdef USE_RMT_STEPS
         rmt_channel_t _rmt_chan_num;
+#endif
+#ifdef USE_RMT_STEP_BURSTS
+        rmt_item32_t _rmt_step_item;  // The single pulse that step() sends
+        bool         _burst_loaded;   // The channel memory holds a burst instead of _rmt_step_item
 #endif
         bool    _invert_step_pin;
         bool    _invert_dir_pin;
@@ -35,66 +35,55 @@ const int MAX_INT_DIGITS = 8;  // Maximum number of digits in int32 (and float)
 // be a g-code word on some CNC systems. So, 'E' notation will not be recognized.
 // NOTE: Thanks to Radu-Eosif Mihailescu for identifying the issues with using strtod().
 uint8_t read_float(const char* line, uint8_t* char_counter, float* float_ptr) {
-    const char*   ptr = line + *char_counter;
-    unsigned char c;
-    // Grab first character and increment pointer. No spaces assumed in line.
-    c = *ptr++;
-    // Capture initial positive/minus character
+    const char* ptr = line + *char_counter;
+    // Capture initial positive/minus character. No spaces assumed in line.
     bool isnegative = false;
-    if (c == '-') {
+    if (*ptr == '-') {
         isnegative = true;
-        c          = *ptr++;
-    } else if (c == '+') {
-        c = *ptr++;
-    }
-
-    // Extract number into fast integer. Track decimal in terms of exponent value.
-    uint32_t intval    = 0;
-    int8_t   exp       = 0;
-    uint8_t  ndigit    = 0;
-    bool     isdecimal = false;
-    while (1) {
-        c -= '0';
-        if (c <= 9) {
-            ndigit++;
-            if (ndigit <= MAX_INT_DIGITS) {
-                if (isdecimal) {
-                    exp--;
-                }
-                intval = intval * 10 + c;
-            } else {
-                if (!(isdecimal)) {
-                    exp++;  // Drop overflow digits
-                }
-            }
-        } else if (c == (('.' - '0') & 0xff) && !(isdecimal)) {
-            isdecimal = true;
+        ptr++;
+    } else if (*ptr == '+') {
+        ptr++;
+    }
+
+    // Extract number into fast integer. Track decimal in terms of exponent value. The integer
+    // and fraction digits are read by separate loops, so neither has to test for the decimal point.
+    uint32_t intval = 0;
+    int8_t   exp    = 0;
+    uint8_t  ndigit = 0;
+    uint8_t  digit;
+    while ((digit = uint8_t(*ptr - '0')) <= 9) {
+        if (++ndigit <= MAX_INT_DIGITS) {
+            intval = intval * 10 + digit;
         } else {
-            break;
+            exp++;  // Drop overflow digits
+        }
+        ptr++;
+    }
+    if (*ptr == '.') {
+        ptr++;
+        while ((digit = uint8_t(*ptr - '0')) <= 9) {
+            if (++ndigit <= MAX_INT_DIGITS) {
+                intval = intval * 10 + digit;
+                exp--;
+            }
+            ptr++;
         }
-        c = *ptr++;
     }
     // Return if no digits have been read.
     if (!ndigit) {
         return false;
     }
 
-    // Convert integer into floating point.
-    float fval;
-    fval = (float)intval;
-    // Apply decimal. Should perform no more than two floating point multiplications for the
-    // expected range of E0 to E-4.
-    if (fval != 0) {
-        while (exp <= -2) {
-            fval *= 0.01;
-            exp += 2;
-        }
-        if (exp < 0) {
-            fval *= 0.1;
-        } else if (exp > 0) {
-            do {
-                fval *= 10.0;
-            } while (--exp > 0);
+    // Convert integer into floating point. The fraction digits are applied with one single
+    // precision division, which the FPU does without the double precision library calls that
+    // multiplying by 0.01 and 0.1 took.
+    static const float pow10[MAX_INT_DIGITS + 1] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f };
+    float              fval                      = (float)intval;
+    if (exp < 0) {
+        fval /= pow10[-exp];
+    } else {
+        while (exp-- > 0) {
+            fval *= 10.0f;
         }
     }
     // Assign floating point value with correct sign.
@@ -103,7 +92,7 @@ uint8_t read_float(const char* line, uint8_t* char_counter, float* float_ptr) {
     } else {
         *float_ptr = fval;
     }
-    *char_counter = ptr - line - 1;  // Set char_counter to next statement
+    *char_counter = ptr - line;  // Set char_counter to next statement
     return true;
 }
 
@@ -186,6 +175,21 @@ float limit_rate_by_axis_maximum(float* unit_vec) {
     return limit_value;
 }
 
+#ifdef S_CURVE_ACCELERATION
+float limit_jerk_by_axis_maximum(float* unit_vec) {
+    uint8_t idx;
+    float   limit_value = SOME_LARGE_VALUE;
+    auto    n_axis      = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        if (unit_vec[idx] != 0) {  // Avoid divide by zero.
+            limit_value = MIN(limit_value, fabs(axis_settings[idx]->jerk->get() / unit_vec[idx]));
+        }
+    }
+    // The jerk setting is stored in mm/sec^3 and used in mm/min^3.
+    return limit_value * SEC_PER_MIN_SQ * 60.0;
+}
+#endif
+
 float map_float(float x, float in_min, float in_max, float out_min, float out_max) {  // DrawBot_Badge
     return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
@@ -25,12 +25,17 @@
 
 #include "Grbl.h"
 #include <stdlib.h>  // PSoc Required for labs
+#include <atomic>
 
-static plan_block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
-static uint8_t      block_buffer_tail;                // Index of the block to process now
-static uint8_t      block_buffer_head;                // Index of the next block to be pushed
-static uint8_t      next_buffer_head;                 // Index of the next buffer head
-static uint8_t      block_buffer_planned;             // Index of the optimally planned block
+static plan_block_t          block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
+static std::atomic<uint16_t> block_buffer_tail;                // Index of the block to process now. Moved on by the segment prep.
+static uint16_t              block_buffer_head;                // Index of the next block to be pushed
+static uint16_t              next_buffer_head;                 // Index of the next buffer head
+static uint16_t              block_buffer_planned;             // Index of the optimally planned block. Only the planner moves it.
+
+// Odd while the main program changes the planned speeds or the buffer indices. The segment prep
+// leaves the plan alone then, and the update waits until it does, see st_prep_wait().
+static volatile uint32_t plan_seq;
 
 // Define planner variables
 typedef struct {
@@ -43,7 +48,7 @@ typedef struct {
 static planner_t pl;
 
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
-uint8_t plan_next_block_index(uint8_t block_index) {
+uint16_t plan_next_block_index(uint16_t block_index) {
     block_index++;
     if (block_index == BLOCK_BUFFER_SIZE) {
         block_index = 0;
@@ -52,7 +57,7 @@ uint8_t plan_next_block_index(uint8_t block_index) {
 }
 
 // Returns the index of the previous block in the ring buffer
-static uint8_t plan_prev_block_index(uint8_t block_index) {
+static uint16_t plan_prev_block_index(uint16_t block_index) {
     if (block_index == 0) {
         block_index = BLOCK_BUFFER_SIZE;
     }
@@ -60,6 +65,20 @@ static uint8_t plan_prev_block_index(uint8_t block_index) {
     return block_index;
 }
 
+static void plan_update_begin() {
+    plan_seq++;
+    st_prep_wait();
+}
+
+static void plan_update_end() {
+    std::atomic_thread_fence(std::memory_order_release);
+    plan_seq++;
+}
+
+bool plan_update_pending() {
+    return plan_seq & 1;
+}
+
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
                                     /          \
@@ -109,8 +128,8 @@ static uint8_t plan_prev_block_index(uint8_t block_index) {
   - block_buffer_planned: Points to the first buffer block after the last optimally planned block for normal
       streaming operating conditions. Use for planning optimizations by avoiding recomputing parts of the
       planner buffer that don't change with the addition of a new block, as describe above. In addition,
-      this block can never be less than block_buffer_tail and will always be pushed forward and maintain
-      this requirement when encountered by the plan_discard_current_block() routine during a cycle.
+      this block can never be less than block_buffer_tail. The segment prep moves the tail on without
+      touching it, so planner_recalculate() brings it up to the tail when the tail has passed it.
 
   NOTE: Since the planner only computes on what's in the planner buffer, some motions with lots of short
   line segments, like G2/3 arcs or complex curves, may seem to move slow. This is because there simply isn't
@@ -120,14 +139,24 @@ static uint8_t plan_prev_block_index(uint8_t block_index) {
   will be able to compute higher velocity profiles within the same combined distance. (2) Maximize line
   motion(s) distance per block to a desired tolerance. The more combined distance the planner has to use,
   the faster it can go. (3) Maximize the planner buffer size. This also will increase the combined distance
-  for the planner to compute over. It also increases the number of computations the planner has to perform
-  to compute an optimal plan, so select carefully. The Arduino 328p memory is already maxed out, but future
-  ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
+  for the planner to compute over. The ESP32 has enough memory for a deep look-ahead of several hundred
+  blocks (see BLOCK_BUFFER_SIZE in config.h). Because of the stop-compute pointers above, a deeper buffer
+  does not make each new block more expensive to plan once the plan reaches its nominal speeds. Only the
+  unplanned deceleration ramp at the end of the buffer, i.e. the blocks whose entry speeds actually change,
+  is revisited by the reverse and forward passes.
 
 */
 static void planner_recalculate() {
+    // The segment prep discards executed blocks without moving the planned pointer, so it can be
+    // left behind the buffer tail. Restart from the tail then. The tail holds still during the pass,
+    // as the prep waits for plan updates, so it is read once.
+    uint16_t tail = block_buffer_tail.load(std::memory_order_acquire);
+    if ((uint16_t)(block_buffer_planned - tail + BLOCK_BUFFER_SIZE) % BLOCK_BUFFER_SIZE >=
+        (uint16_t)(block_buffer_head - tail + BLOCK_BUFFER_SIZE) % BLOCK_BUFFER_SIZE) {
+        block_buffer_planned = tail;
+    }
     // Initialize block index to the last block in the planner buffer.
-    uint8_t block_index = plan_prev_block_index(block_buffer_head);
+    uint16_t block_index = plan_prev_block_index(block_buffer_head);
     // Bail. Can't do anything with one only one plan-able block.
     if (block_index == block_buffer_planned) {
         return;
@@ -143,7 +172,7 @@ static void planner_recalculate() {
     block_index              = plan_prev_block_index(block_index);
     if (block_index == block_buffer_planned) {  // Only two plannable blocks in buffer. Reverse pass complete.
         // Check if the first block is the tail. If so, notify stepper to update its current parameters.
-        if (block_index == block_buffer_tail) {
+        if (block_index == tail) {
             st_update_plan_block_parameters();
         }
     } else {  // Three or more plan-able blocks
@@ -152,7 +181,7 @@ static void planner_recalculate() {
             current     = &block_buffer[block_index];
             block_index = plan_prev_block_index(block_index);
             // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
-            if (block_index == block_buffer_tail) {
+            if (block_index == tail) {
                 st_update_plan_block_parameters();
             }
             // Compute maximum entry speed decelerating over the current block from its exit speed.
@@ -201,20 +230,19 @@ void plan_reset() {
 }
 
 void plan_reset_buffer() {
+    plan_update_begin();
     block_buffer_tail    = 0;
     block_buffer_head    = 0;  // Empty = tail
     next_buffer_head     = 1;  // plan_next_block_index(block_buffer_head)
     block_buffer_planned = 0;  // = block_buffer_tail;
+    plan_update_end();
 }
 
+// Called by the segment prep. The planned pointer is left to planner_recalculate().
 void plan_discard_current_block() {
-    if (block_buffer_head != block_buffer_tail) {  // Discard non-empty buffer.
-        uint8_t block_index = plan_next_block_index(block_buffer_tail);
-        // Push block_buffer_planned pointer, if encountered.
-        if (block_buffer_tail == block_buffer_planned) {
-            block_buffer_planned = block_index;
-        }
-        block_buffer_tail = block_index;
+    uint16_t tail = block_buffer_tail.load(std::memory_order_relaxed);
+    if (block_buffer_head != tail) {  // Discard non-empty buffer.
+        block_buffer_tail.store(plan_next_block_index(tail), std::memory_order_release);
     }
 }
 
@@ -225,14 +253,24 @@ plan_block_t* plan_get_system_motion_block() {
 
 // Returns address of first planner block, if available. Called by various main program functions.
 plan_block_t* plan_get_current_block() {
-    if (block_buffer_head == block_buffer_tail) {
+    uint16_t tail = block_buffer_tail;
+    if (block_buffer_head == tail) {
         return NULL;  // Buffer empty
     }
-    return &block_buffer[block_buffer_tail];
+    return &block_buffer[tail];
+}
+
+// Returns address of the planner block after the given one, if available. Called by the segment generator to look ahead.
+plan_block_t* plan_get_next_block(plan_block_t* block) {
+    uint16_t block_index = plan_next_block_index(block - block_buffer);
+    if (block_index == block_buffer_head) {
+        return NULL;
+    }
+    return &block_buffer[block_index];
 }
 
 float plan_get_exec_block_exit_speed_sqr() {
-    uint8_t block_index = plan_next_block_index(block_buffer_tail);
+    uint16_t block_index = plan_next_block_index(block_buffer_tail);
     if (block_index == block_buffer_head) {
         return 0.0f;
     }
@@ -281,7 +319,8 @@ static void plan_compute_profile_parameters(plan_block_t* block, float nominal_s
 
 // Re-calculates buffered motions profile parameters upon a motion-based override change.
 void plan_update_velocity_profile_parameters() {
-    uint8_t       block_index = block_buffer_tail;
+    plan_update_begin();
+    uint16_t      block_index = block_buffer_tail;
     plan_block_t* block;
     float         nominal_speed;
     float         prev_nominal_speed = SOME_LARGE_VALUE;  // Set high for first block nominal speed calculation.
@@ -293,9 +332,61 @@ void plan_update_velocity_profile_parameters() {
         block_index        = plan_next_block_index(block_index);
     }
     pl.previous_nominal_speed = prev_nominal_speed;  // Update prev nominal speed for next incoming block.
+    plan_update_end();
 }
 
-uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
+#ifdef PLANNER_ARCS
+// Sets up an arc block: its length and rate limits, and the direction vectors at the start and the
+// end of the arc, for the junctions with the blocks before and after it.
+static void plan_arc_setup(plan_block_t* block, plan_arc_t* arc, int32_t* position_steps, float* entry_vec, float* exit_vec) {
+    float radius        = sqrtf(arc->radius[0] * arc->radius[0] + arc->radius[1] * arc->radius[1]);
+    float planar_length = fabsf(arc->angular_travel) * radius;
+    arc->length         = sqrtf(planar_length * planar_length + arc->linear_travel * arc->linear_travel);
+    arc->start_steps[0] = position_steps[arc->axis_0];
+    arc->start_steps[1] = position_steps[arc->axis_1];
+    arc->start_steps[2] = position_steps[arc->axis_linear];
+    block->millimeters  = arc->length;
+
+    // The direction of travel is the radius vector turned a quarter turn towards the arc.
+    float planar_share = planar_length / arc->length;
+    float linear_share = arc->linear_travel / arc->length;
+    float turn         = (arc->angular_travel > 0 ? planar_share : -planar_share) / radius;
+    float cos_travel   = cosf(arc->angular_travel);
+    float sin_travel   = sinf(arc->angular_travel);
+    float end_radius_0 = arc->radius[0] * cos_travel - arc->radius[1] * sin_travel;
+    float end_radius_1 = arc->radius[0] * sin_travel + arc->radius[1] * cos_travel;
+    memset(entry_vec, 0, MAX_N_AXIS * sizeof(float));
+    memset(exit_vec, 0, MAX_N_AXIS * sizeof(float));
+    entry_vec[arc->axis_0]      = -turn * arc->radius[1];
+    entry_vec[arc->axis_1]      = turn * arc->radius[0];
+    entry_vec[arc->axis_linear] = linear_share;
+    exit_vec[arc->axis_0]       = -turn * end_radius_1;
+    exit_vec[arc->axis_1]       = turn * end_radius_0;
+    exit_vec[arc->axis_linear]  = linear_share;
+
+    // The direction turns, so either plane axis may have to carry the whole planar speed.
+    float limit_vec[MAX_N_AXIS] = { 0.0 };
+    limit_vec[arc->axis_0]      = planar_share;
+    limit_vec[arc->axis_1]      = planar_share;
+    limit_vec[arc->axis_linear] = linear_share;
+    block->acceleration         = limit_acceleration_by_axis_maximum(limit_vec);
+#    ifdef S_CURVE_ACCELERATION
+    block->jerk = limit_jerk_by_axis_maximum(limit_vec);
+#    endif
+    block->rapid_rate           = limit_rate_by_axis_maximum(limit_vec);
+    // Keep the centripetal acceleration, v^2/r in the plane, within the acceleration limit.
+    float centripetal_rate = sqrtf(block->acceleration * radius) / planar_share;
+    block->rapid_rate      = MIN(block->rapid_rate, centripetal_rate);
+
+    // The longest chord whose middle stays within the arc tolerance of the arc, as distance along it.
+    float tolerance = arc_tolerance->get();
+    float chord     = tolerance < radius ? 2 * sqrtf(tolerance * (2 * radius - tolerance)) : 2 * radius;
+    arc->chord_mm   = chord / planar_share;
+}
+#endif
+
+// Adds a line, or with PLANNER_ARCS an arc, to the buffer. arc is NULL for a line.
+static uint8_t plan_buffer_block(float* target, plan_line_data_t* pl_data, plan_arc_t* arc) {
     // Prepare and initialize new block. Copy relevant pl_data for block execution.
     plan_block_t* block = &block_buffer[block_buffer_head];
     memset(block, 0, sizeof(plan_block_t));  // Zero all block values.
@@ -306,6 +397,10 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
 
 #ifdef USE_LINE_NUMBERS
     block->line_number = pl_data->line_number;
+#endif
+#ifdef LASER_RASTER
+    block->raster_start  = pl_data->raster_start;
+    block->raster_pixels = pl_data->raster_pixels;
 #endif
     // Compute and store initial move distance data.
     int32_t target_steps[MAX_N_AXIS], position_steps[MAX_N_AXIS];
@@ -332,18 +427,34 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
             block->direction_bits |= bit(idx);
         }
     }
-    // Bail if this is a zero-length block. Highly unlikely to occur.
-    if (block->step_event_count == 0) {
-        return PLAN_EMPTY_BLOCK;
-    }
+    float* exit_vec = unit_vec;  // The direction at the end of the block, for the next junction
+#ifdef PLANNER_ARCS
+    float arc_exit_vec[MAX_N_AXIS];
+    if (arc != NULL) {
+        // A full circle has no net travel, so arcs are never empty.
+        block->arc              = *arc;
+        block->motion.arcMotion = 1;
+        plan_arc_setup(block, &block->arc, position_steps, unit_vec, arc_exit_vec);
+        exit_vec = arc_exit_vec;
+    } else
+#endif
+    {
+        // Bail if this is a zero-length block. Highly unlikely to occur.
+        if (block->step_event_count == 0) {
+            return PLAN_EMPTY_BLOCK;
+        }
 
-    // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
-    // down such that no individual axes maximum values are exceeded with respect to the line direction.
-    // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
-    // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
-    block->millimeters  = convert_delta_vector_to_unit_vector(unit_vec);
-    block->acceleration = limit_acceleration_by_axis_maximum(unit_vec);
-    block->rapid_rate   = limit_rate_by_axis_maximum(unit_vec);
+        // Calculate the unit vector of the line move and the block maximum feed rate and acceleration scaled
+        // down such that no individual axes maximum values are exceeded with respect to the line direction.
+        // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
+        // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
+        block->millimeters  = convert_delta_vector_to_unit_vector(unit_vec);
+        block->acceleration = limit_acceleration_by_axis_maximum(unit_vec);
+#ifdef S_CURVE_ACCELERATION
+        block->jerk = limit_jerk_by_axis_maximum(unit_vec);
+#endif
+        block->rapid_rate   = limit_rate_by_axis_maximum(unit_vec);
+    }
     // Store programmed rate.
     if (block->motion.rapidMotion) {
         block->programmed_rate = block->rapid_rate;
@@ -411,17 +522,60 @@ uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
         plan_compute_profile_parameters(block, nominal_speed, pl.previous_nominal_speed);
         pl.previous_nominal_speed = nominal_speed;
         // Update previous path unit_vector and planner position.
-        memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec));  // pl.previous_unit_vec[] = unit_vec[]
+        memcpy(pl.previous_unit_vec, exit_vec, sizeof(unit_vec));  // pl.previous_unit_vec[] = exit_vec[]
         memcpy(pl.position, target_steps, sizeof(target_steps));   // pl.position[] = target_steps[]
         // New block is all set. Update buffer head and next buffer head indices.
+        // NOTE: The buffer may have drained since the empty check above. The block is then the only
+        // one, and keeps its entry speed of zero, the speed the last block ended at.
+        plan_update_begin();
         block_buffer_head = next_buffer_head;
         next_buffer_head  = plan_next_block_index(block_buffer_head);
         // Finish up by recalculating the plan with the new block.
         planner_recalculate();
+        plan_update_end();
     }
     return PLAN_OK;
 }
 
+uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data) {
+    return plan_buffer_block(target, pl_data, NULL);
+}
+
+#ifdef PLANNER_ARCS
+uint8_t plan_buffer_arc(float* target, plan_line_data_t* pl_data, plan_arc_t* arc) {
+    return plan_buffer_block(target, pl_data, arc);
+}
+
+void plan_arc_steps(plan_block_t* block, float mm_remaining, int32_t* steps) {
+    plan_arc_t*   arc     = &block->arc;
+    const uint8_t axes[3] = { arc->axis_0, arc->axis_1, arc->axis_linear };
+    uint8_t       idx;
+    if (mm_remaining >= arc->length) {
+        memcpy(steps, arc->start_steps, sizeof(arc->start_steps));
+        return;
+    }
+    if (mm_remaining <= 0.0) {
+        // Exactly the end point the planner worked out for the block
+        for (idx = 0; idx < 3; idx++) {
+            int32_t travel = block->steps[axes[idx]];
+            steps[idx]     = arc->start_steps[idx] + (bit_istrue(block->direction_bits, bit(axes[idx])) ? -travel : travel);
+        }
+        return;
+    }
+    float done  = 1.0 - mm_remaining / arc->length;
+    float angle = arc->angular_travel * done;
+    float cos_a = cosf(angle);
+    float sin_a = sinf(angle);
+    float position[3];
+    position[0] = arc->center[0] + arc->radius[0] * cos_a - arc->radius[1] * sin_a;
+    position[1] = arc->center[1] + arc->radius[0] * sin_a + arc->radius[1] * cos_a;
+    position[2] = arc->linear_start + arc->linear_travel * done;
+    for (idx = 0; idx < 3; idx++) {
+        steps[idx] = lround(position[idx] * axis_settings[axes[idx]]->steps_per_mm->get());
+    }
+}
+#endif
+
 // Reset the planner position vectors. Called by the system abort/initialization routine.
 void plan_sync_position() {
     // TODO: For motor configurations not in the same coordinate frame as the machine position,
@@ -433,22 +587,32 @@ void plan_sync_position() {
     }
 }
 
+// Returns the planner position of the tool in millimeters. This is the end of the last buffered motion.
+void plan_get_planner_mpos(float* target) {
+    uint8_t idx;
+    auto    n_axis = number_axis->get();
+    for (idx = 0; idx < n_axis; idx++) {
+        target[idx] = pl.position[idx] / axis_settings[idx]->steps_per_mm->get();
+    }
+}
+
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available() {
-    if (block_buffer_head >= block_buffer_tail) {
-        return (BLOCK_BUFFER_SIZE - 1) - (block_buffer_head - block_buffer_tail);
+uint16_t plan_get_block_buffer_available() {
+    uint16_t tail = block_buffer_tail;
+    if (block_buffer_head >= tail) {
+        return (BLOCK_BUFFER_SIZE - 1) - (block_buffer_head - tail);
     } else {
-        return block_buffer_tail - block_buffer_head - 1;
+        return tail - block_buffer_head - 1;
     }
 }
 
 // Returns the number of active blocks are in the planner buffer.
-// NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count() {
-    if (block_buffer_head >= block_buffer_tail) {
-        return block_buffer_head - block_buffer_tail;
+uint16_t plan_get_block_buffer_count() {
+    uint16_t tail = block_buffer_tail;
+    if (block_buffer_head >= tail) {
+        return block_buffer_head - tail;
     } else {
-        return BLOCK_BUFFER_SIZE - (block_buffer_tail - block_buffer_head);
+        return BLOCK_BUFFER_SIZE - (tail - block_buffer_head);
     }
 }
 
@@ -456,7 +620,9 @@ uint8_t plan_get_block_buffer_count() {
 // Called after a steppers have come to a complete stop for a feed hold and the cycle is stopped.
 void plan_cycle_reinitialize() {
     // Re-plan from a complete stop. Reset planner entry speeds and buffer planned pointer.
+    plan_update_begin();
     st_update_plan_block_parameters();
     block_buffer_planned = block_buffer_tail;
     planner_recalculate();
+    plan_update_end();
 }
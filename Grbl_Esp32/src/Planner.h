@@ -32,6 +32,9 @@
 #        define BLOCK_BUFFER_SIZE 16
 #    endif
 #endif
+#if BLOCK_BUFFER_SIZE > 512
+#    error "BLOCK_BUFFER_SIZE is limited to 512 blocks"
+#endif
 
 // Returned status message from planner.
 const int PLAN_OK          = true;
@@ -43,8 +46,24 @@ struct PlMotion {
     uint8_t systemMotion : 1;    // Single motion. Circumvents planner state. Used by home/park.
     uint8_t noFeedOverride : 1;  // Motion does not honor feed override.
     uint8_t inverseTime : 1;     // Interprets feed rate value as inverse time when set.
+    uint8_t arcMotion : 1;       // Block is an arc, traced by the segment prep. Set by plan_buffer_arc().
 };
 
+// The path of an arc block. The segment prep computes the point on it at any distance from the end.
+typedef struct {
+    float   center[2];       // Arc center on axis_0 and axis_1 (mm)
+    float   radius[2];       // Radius vector from the center to the start point (mm)
+    float   angular_travel;  // Angle swept by the arc, counterclockwise positive (radians)
+    float   linear_start;    // Start position of the helical axis (mm)
+    float   linear_travel;   // Travel of the helical axis (mm)
+    float   length;          // Length of the whole arc (mm). Set by the planner.
+    float   chord_mm;        // Longest stretch of the arc that one chord may cover (mm). Set by the planner.
+    int32_t start_steps[3];  // Start position of axis_0, axis_1 and axis_linear (steps). Set by the planner.
+    uint8_t axis_0;          // Arc plane axes
+    uint8_t axis_1;
+    uint8_t axis_linear;
+} plan_arc_t;
+
 // This struct stores a linear movement of a g-code block motion with its critical "nominal" values
 // are as specified in the source g-code.
 typedef struct {
@@ -68,6 +87,9 @@ typedef struct {
     float max_entry_speed_sqr;  // Maximum allowable entry speed based on the minimum of junction limit and
     //   neighboring nominal speeds with overrides in (mm/min)^2
     float acceleration;  // Axis-limit adjusted line acceleration in (mm/min^2). Does not change.
+#ifdef S_CURVE_ACCELERATION
+    float jerk;  // Axis-limit adjusted line jerk in (mm/min^3). Does not change.
+#endif
     float millimeters;   // The remaining distance for this block to be executed in (mm).
     // NOTE: This value may be altered by stepper algorithm during execution.
 
@@ -79,6 +101,15 @@ typedef struct {
     // Stored spindle speed data used by spindle overrides and resuming methods.
     float spindle_speed;  // Block spindle speed. Copied from pl_line_data.
     //#endif
+
+#ifdef PLANNER_ARCS
+    // For arc blocks, the path to trace. steps[] and direction_bits then only give the net travel.
+    plan_arc_t arc;
+#endif
+#ifdef LASER_RASTER
+    uint32_t raster_start;   // Raster buffer position of the first pixel of a G7 scanline
+    uint32_t raster_pixels;  // Pixels of a G7 scanline, 0 for other motions
+#endif
 } plan_block_t;
 
 // Planner data prototype. Must be used when passing new motions to the planner.
@@ -90,6 +121,10 @@ typedef struct {
     CoolantState coolant;        // Coolant state
 #ifdef USE_LINE_NUMBERS
     int32_t line_number;  // Desired line number to report when executing.
+#endif
+#ifdef LASER_RASTER
+    uint32_t raster_start;   // Pixels of a G7 scanline in the raster buffer. Set by mc_raster().
+    uint32_t raster_pixels;
 #endif
     bool         is_jog;         // true if this was generated due to a jog command
 } plan_line_data_t;
@@ -103,6 +138,15 @@ void plan_reset_buffer();  // Reset buffer only.
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
 uint8_t plan_buffer_line(float* target, plan_line_data_t* pl_data);
 
+#ifdef PLANNER_ARCS
+// Add an arc to the buffer as a single block. target[MAX_N_AXIS] is the end point in millimeters and
+// arc the path to it, which must start at the current planner position. Only the arc axes may move.
+uint8_t plan_buffer_arc(float* target, plan_line_data_t* pl_data, plan_arc_t* arc);
+
+// Gets the position in steps of the arc axes of an arc block, mm_remaining from the end of the arc.
+void plan_arc_steps(plan_block_t* block, float mm_remaining, int32_t* steps);
+#endif
+
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
 void plan_discard_current_block();
@@ -113,12 +157,18 @@ plan_block_t* plan_get_system_motion_block();
 // Gets the current block. Returns NULL if buffer empty
 plan_block_t* plan_get_current_block();
 
+// Gets the block queued after the given one. Returns NULL if it is the last one.
+plan_block_t* plan_get_next_block(plan_block_t* block);
+
 // Called periodically by step segment buffer. Mostly used internally by planner.
-uint8_t plan_next_block_index(uint8_t block_index);
+uint16_t plan_next_block_index(uint16_t block_index);
 
 // Called by step segment buffer when computing executing block velocity profile.
 float plan_get_exec_block_exit_speed_sqr();
 
+// True while the main program is changing the plan. The segment prep leaves the plan alone then.
+bool plan_update_pending();
+
 // Called by main program during planner calculations and step segment buffer during initialization.
 float plan_compute_profile_nominal_speed(plan_block_t* block);
 
@@ -132,13 +182,13 @@ void plan_sync_position();
 void plan_cycle_reinitialize();
 
 // Returns the number of available blocks are in the planner buffer.
-uint8_t plan_get_block_buffer_available();
+uint16_t plan_get_block_buffer_available();
 
 // Returns the number of active blocks are in the planner buffer.
-// NOTE: Deprecated. Not used unless classic status reports are enabled in config.h
-uint8_t plan_get_block_buffer_count();
+uint16_t plan_get_block_buffer_count();
 
 // Returns the status of the block ring buffer. True, if buffer is full.
 uint8_t plan_check_full_buffer();
 
+// Returns the planner position of the tool in millimeters.
 void plan_get_planner_mpos(float* target);
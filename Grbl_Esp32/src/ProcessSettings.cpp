@@ -314,6 +314,56 @@ Error restore_settings(const char* value, WebUI::AuthenticationLevel auth_level,
     return Error::Ok;
 }
 
+#ifdef ENABLE_MOTION_STATS
+Error motion_stats(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
+    if (!value) {
+        report_motion_stats(out->client());
+        return Error::Ok;
+    }
+    if (strcasecmp(value, "RST") == 0) {
+        st_stats_reset();
+        return Error::Ok;
+    }
+    return Error::InvalidStatement;
+}
+#endif
+
+// $RI=<ms> pushes a status report to this client every ms milliseconds, $RI=<ms>,<mm> pushes one
+// at most every ms milliseconds when the state changes or the machine moves more than mm, and
+// $RI=0 stops them. $RI shows the current setting. Intervals below STATUS_INTERVAL_MIN_MS are refused.
+Error report_interval(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
+    uint32_t interval_ms;
+    float    threshold;
+    if (!value) {
+        if (!report_status_subscription(out->client(), &interval_ms, &threshold)) {
+            interval_ms = 0;
+            threshold   = 0;
+        }
+        grbl_sendf(out->client(), "$RI=%d,%.3f\r\n", interval_ms, threshold);
+        return Error::Ok;
+    }
+    char* endptr;
+    interval_ms = strtoul(value, &endptr, 10);
+    threshold   = 0;
+    if (endptr == value) {
+        return Error::BadNumberFormat;
+    }
+    if (*endptr == ',') {
+        const char* mm = endptr + 1;
+        threshold      = strtof(mm, &endptr);
+        if (endptr == mm || threshold < 0) {
+            return Error::BadNumberFormat;
+        }
+    }
+    if (*endptr) {
+        return Error::BadNumberFormat;
+    }
+    if (interval_ms && interval_ms < STATUS_INTERVAL_MIN_MS) {
+        return Error::NumberRange;
+    }
+    return report_status_subscribe(out->client(), interval_ms, threshold) ? Error::Ok : Error::InvalidStatement;
+}
+
 Error showState(const char* value, WebUI::AuthenticationLevel auth_level, WebUI::ESPResponseStream* out) {
     grbl_sendf(out->client(), "State 0x%x\r\n", sys.state);
     return Error::Ok;
@@ -441,6 +491,7 @@ void make_grbl_commands() {
     new GrblCommand("A", "Alarms/List", listAlarms, anyState);
     new GrblCommand("E", "Errors/List", listErrors, anyState);
     new GrblCommand("G", "GCode/Modes", report_gcode, anyState);
+    new GrblCommand("RI", "Report/Interval", report_interval, anyState);
     new GrblCommand("C", "GCode/Check", toggle_check_mode, anyState);
     new GrblCommand("X", "Alarm/Disable", disable_alarm_lock, anyState);
     new GrblCommand("NVX", "Settings/Erase", Setting::eraseNVS, idleOrAlarm, WA);
@@ -448,6 +499,9 @@ void make_grbl_commands() {
     new GrblCommand("#", "GCode/Offsets", report_ngc, idleOrAlarm);
     new GrblCommand("H", "Home", home_all, idleOrAlarm);
     new GrblCommand("MD", "Motor/Disable", motor_disable, idleOrAlarm);
+#ifdef ENABLE_MOTION_STATS
+    new GrblCommand("MS", "Motion/Stats", motion_stats, anyState);
+#endif
 
 #ifdef HOMING_SINGLE_AXIS_COMMANDS
     new GrblCommand("HX", "Home/X", home_x, idleOrAlarm);
@@ -32,48 +32,6 @@ static uint8_t line_flags           = 0;
 static uint8_t char_counter         = 0;
 static uint8_t comment_char_counter = 0;
 
-typedef struct {
-    char buffer[LINE_BUFFER_SIZE];
-    int  len;
-    int  line_number;
-} client_line_t;
-client_line_t client_lines[CLIENT_COUNT];
-
-static void empty_line(uint8_t client) {
-    client_line_t* cl = &client_lines[client];
-    cl->len           = 0;
-    cl->buffer[0]     = '\0';
-}
-static void empty_lines() {
-    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
-        empty_line(client);
-    }
-}
-
-Error add_char_to_line(char c, uint8_t client) {
-    client_line_t* cl = &client_lines[client];
-    // Simple editing for interactive input
-    if (c == '\b') {
-        // Backspace erases
-        if (cl->len) {
-            --cl->len;
-            cl->buffer[cl->len] = '\0';
-        }
-        return Error::Ok;
-    }
-    if (cl->len == (LINE_BUFFER_SIZE - 1)) {
-        return Error::Overflow;
-    }
-    if (c == '\r' || c == '\n') {
-        cl->len = 0;
-        cl->line_number++;
-        return Error::Eol;
-    }
-    cl->buffer[cl->len++] = c;
-    cl->buffer[cl->len]   = '\0';
-    return Error::Ok;
-}
-
 Error execute_line(char* line, uint8_t client, WebUI::AuthenticationLevel auth_level) {
     Error result = Error::Ok;
     // Empty or comment line. For syncing purposes.
@@ -82,6 +40,7 @@ Error execute_line(char* line, uint8_t client, WebUI::AuthenticationLevel auth_l
     }
     // Grbl '$' or WebUI '[ESPxxx]' system command
     if (line[0] == '$' || line[0] == '[') {
+        mc_flush_blend();  // System commands expect all g-code motions to be in the planner.
         return system_execute_line(line, client, auth_level);
     }
     // Everything else is gcode. Block if in alarm or jog mode.
@@ -104,7 +63,6 @@ bool can_park() {
 */
 void protocol_main_loop() {
     client_reset_read_buffer(CLIENT_ALL);
-    empty_lines();
     //uint8_t client = CLIENT_SERIAL; // default client
     // Perform some machine checks to make sure everything is good to go.
 #ifdef CHECK_LIMITS_AT_INIT
@@ -135,10 +93,18 @@ void protocol_main_loop() {
     // Primary loop! Upon a system abort, this exits back to main() to reset the system.
     // This is also where Grbl idles while waiting for something to do.
     // ---------------------------------------------------------------------------------
-    int c;
     for (;;) {
 #ifdef ENABLE_SD_CARD
-        if (SD_ready_next) {
+        while (SD_ready_next) {
+#    ifdef ENABLE_SD_COMPILE
+            sd_run_compiled_motions();
+            if (sys.abort) {
+                return;  // Bail to calling function upon system abort
+            }
+            if (!SD_ready_next) {
+                break;  // The job ended
+            }
+#    endif
             char fileLine[255];
             if (readFileLine(fileLine, 255)) {
                 SD_ready_next = false;
@@ -149,44 +115,50 @@ void protocol_main_loop() {
                 grbl_notifyf("SD print done", "%s print is successful", temp);
                 closeFile();  // close file and clear SD ready/running flags
             }
+#    ifdef SD_READ_AHEAD
+            // Run the lines that are already buffered back to back. The other clients are locked
+            // out during a job, so only the realtime commands need servicing between them.
+            protocol_execute_realtime();  // Runtime command check point.
+            if (sys.abort) {
+                return;  // Bail to calling function upon system abort
+            }
+            if (!sd_line_ready()) {
+                break;
+            }
+#    else
+            break;
+#    endif
         }
 #endif
-        // Receive one line of incoming serial data, as the data becomes available.
-        // Filtering, if necessary, is done later in gc_execute_line(), so the
-        // filtering is the same with serial and file input.
-        uint8_t client = CLIENT_SERIAL;
-        char*   line;
-        for (client = 0; client < CLIENT_COUNT; client++) {
-            while ((c = client_read(client)) != -1) {
-                Error res = add_char_to_line(c, client);
-                switch (res) {
-                    case Error::Ok:
-                        break;
-                    case Error::Eol:
-                        protocol_execute_realtime();  // Runtime command check point.
-                        if (sys.abort) {
-                            return;  // Bail to calling function upon system abort
-                        }
-                        line = client_lines[client].buffer;
+        // Execute the lines each client has sent, as the data becomes available. clientCheckTask()
+        // has framed them, so a whole line is taken at once. Filtering, if necessary, is done
+        // later in gc_execute_line(), so the filtering is the same with serial and file input.
+        char  line[LINE_BUFFER_SIZE];
+        Error res;
+        for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+            while ((res = client_read_line(client, line)) != Error::Ok) {
+                if (res == Error::Overflow) {
+                    report_status_message(Error::Overflow, client);
+                    continue;
+                }
+                protocol_execute_realtime();  // Runtime command check point.
+                if (sys.abort) {
+                    return;  // Bail to calling function upon system abort
+                }
 #ifdef REPORT_ECHO_RAW_LINE_RECEIVED
-                        report_echo_line_received(line, client);
+                report_echo_line_received(line, client);
 #endif
-                        // auth_level can be upgraded by supplying a password on the command line
-                        report_status_message(execute_line(line, client, WebUI::AuthenticationLevel::LEVEL_GUEST), client);
-                        empty_line(client);
-                        break;
-                    case Error::Overflow:
-                        report_status_message(Error::Overflow, client);
-                        empty_line(client);
-                        break;
-                    default:
-                        break;
-                }
-            }  // while serial read
+                // auth_level can be upgraded by supplying a password on the command line
+                report_status_message(execute_line(line, client, WebUI::AuthenticationLevel::LEVEL_GUEST), client);
+            }  // while lines
         }      // for clients
         // If there are no more characters in the serial read buffer to be processed and executed,
         // this indicates that g-code streaming has either filled the planner buffer or has
-        // completed. In either case, auto-cycle start, if enabled, any queued moves.
+        // completed. In either case, auto-cycle start, if enabled, any queued moves. A motion held
+        // back by G64 path blending is sent once the planner is about to run out of motions.
+        if (plan_get_block_buffer_count() < 2) {
+            mc_flush_blend();
+        }
         protocol_auto_cycle_start();
         protocol_execute_realtime();  // Runtime command check point.
         if (sys.abort) {
@@ -203,8 +175,10 @@ void protocol_main_loop() {
 }
 
 // Block until all buffered steps are executed or in a cycle state. Works with feed hold
-// during a synchronize call, if it should happen. Also, waits for clean cycle end.
+// during a synchronize call, if it should happen. Also, waits for clean cycle end and for
+// the spindle to be up to speed. Settings may sync before a spindle is selected.
 void protocol_buffer_synchronize() {
+    mc_flush_blend();
     // If system is queued, ensure cycle resumes if the auto start flag is present.
     protocol_auto_cycle_start();
     do {
@@ -212,7 +186,7 @@ void protocol_buffer_synchronize() {
         if (sys.abort) {
             return;  // Check for system abort
         }
-    } while (plan_get_current_block() || (sys.state == State::Cycle));
+    } while (plan_get_current_block() || (sys.state == State::Cycle) || (spindle && !spindle->at_speed()));
 }
 
 // Auto-cycle start triggers when there is a motion ready to execute and if the main program is not
@@ -266,10 +240,12 @@ void protocol_exec_rt_system() {
                 // the user and a GUI time to do what is needed before resetting, like killing the
                 // incoming stream. The same could be said about soft limits. While the position is not
                 // lost, continued streaming could cause a serious crash if by chance it gets executed.
+                report_push_status();
             } while (!sys_rt_exec_state.bit.reset);
         }
         sys_rt_exec_alarm = ExecAlarm::None;
     }
+    report_push_status();  // To the clients that asked for reports with $RI
     ExecState rt_exec_state;
     rt_exec_state.value = sys_rt_exec_state.value;  // Copy volatile sys_rt_exec_state.
     if (rt_exec_state.value != 0 || cycle_stop) {   // Test if any bits are on
@@ -291,13 +267,19 @@ void protocol_exec_rt_system() {
                 // If in CYCLE or JOG states, immediately initiate a motion HOLD.
                 if (sys.state == State::Cycle || sys.state == State::Jog) {
                     if (!(sys.suspend.bit.motionCancel || sys.suspend.bit.jogCancel)) {  // Block, if already holding.
+                        sys_update_step_control([](StepControl& control) {
+                            control             = {};
+                            control.executeHold = true;  // Initiate suspend state with active flag.
+                        });
                         st_update_plan_block_parameters();  // Notify stepper module to recompute for hold deceleration.
-                        sys.step_control             = {};
-                        sys.step_control.executeHold = true;  // Initiate suspend state with active flag.
                         if (sys.state == State::Jog) {        // Jog cancelled upon any hold event, except for sleeping.
                             if (!rt_exec_state.bit.sleep) {
                                 sys.suspend.bit.jogCancel = true;
                             }
+                            if (jog_spinup_pending) {  // Nothing has moved, so the hold is complete
+                                jog_spinup_pending = false;
+                                cycle_stop         = true;
+                            }
                         }
                     }
                 }
@@ -339,11 +321,13 @@ void protocol_exec_rt_system() {
 #ifdef PARKING_ENABLE
                                 // Set hold and reset appropriate control flags to restart parking sequence.
                                 if (sys.step_control.executeSysMotion) {
+                                    sys_update_step_control([](StepControl& control) {
+                                        control                  = {};
+                                        control.executeHold      = true;
+                                        control.executeSysMotion = true;
+                                    });
                                     st_update_plan_block_parameters();  // Notify stepper module to recompute for hold deceleration.
-                                    sys.step_control                  = {};
-                                    sys.step_control.executeHold      = true;
-                                    sys.step_control.executeSysMotion = true;
-                                    sys.suspend.bit.holdComplete      = false;
+                                    sys.suspend.bit.holdComplete = false;
                                 }  // else NO_MOTION is active.
 #endif
                                 sys.suspend.bit.retractComplete = false;
@@ -373,6 +357,7 @@ void protocol_exec_rt_system() {
         }
         // Execute a cycle start by starting the stepper interrupt to begin executing the blocks in queue.
         if (rt_exec_state.bit.cycleStart) {
+            bool spinup_pending = false;
             // Block if called at same time as the hold commands: feed hold, motion cancel, and safety door.
             // Ensures auto-cycle-start doesn't resume a hold without an explicit user-input.
             if (!(rt_exec_state.bit.feedHold || rt_exec_state.bit.motionCancel || rt_exec_state.bit.safetyDoor)) {
@@ -389,18 +374,32 @@ void protocol_exec_rt_system() {
                         sys.suspend.bit.initiateRestore = true;
                     }
                 }
+                // Start jog motions that waited for the spindle
+                if (sys.state == State::Jog && jog_spinup_pending) {
+                    if (spindle->at_speed()) {
+                        jog_spinup_pending = false;
+                        st_prep_buffer();
+                        st_wake_up();
+                    } else {
+                        spinup_pending = true;
+                    }
+                }
                 // Cycle start only when IDLE or when a hold is complete and ready to resume.
                 if (sys.state == State::Idle || (sys.state == State::Hold && sys.suspend.bit.holdComplete)) {
                     if (sys.state == State::Hold && sys.spindle_stop_ovr.value) {
                         sys.spindle_stop_ovr.bit.restoreCycle = true;  // Set to restore in suspend routine and cycle start after.
                     } else {
                         // Start cycle only if queued motions exist in planner buffer and the motion is not canceled.
-                        sys.step_control = {};  // Restore step control to normal operation
+                        sys_update_step_control([](StepControl& control) { control = {}; });  // Restore step control to normal operation
                         if (plan_get_current_block() && !sys.suspend.bit.motionCancel) {
-                            sys.suspend.value = 0;  // Break suspend state.
-                            sys.state         = State::Cycle;
-                            st_prep_buffer();  // Initialize step segment buffer before beginning cycle.
-                            st_wake_up();
+                            if (spindle->at_speed()) {
+                                sys.suspend.value = 0;  // Break suspend state.
+                                sys.state         = State::Cycle;
+                                st_prep_buffer();  // Initialize step segment buffer before beginning cycle.
+                                st_wake_up();
+                            } else {
+                                spinup_pending = true;  // Keep the cycle start until the spindle is up to speed
+                            }
                         } else {                    // Otherwise, do nothing. Set and resume IDLE state.
                             sys.suspend.value = 0;  // Break suspend state.
                             sys.state         = State::Idle;
@@ -408,7 +407,7 @@ void protocol_exec_rt_system() {
                     }
                 }
             }
-            sys_rt_exec_state.bit.cycleStart = false;
+            sys_rt_exec_state.bit.cycleStart = spinup_pending;
         }
         if (cycle_stop) {
             // Reinitializes the cycle plan and stepper system after a feed hold for a resume. Called by
@@ -424,15 +423,18 @@ void protocol_exec_rt_system() {
                 if (sys.step_control.executeHold) {
                     sys.suspend.bit.holdComplete = true;
                 }
-                sys.step_control.executeHold      = false;
-                sys.step_control.executeSysMotion = false;
+                sys_update_step_control([](StepControl& control) {
+                    control.executeHold      = false;
+                    control.executeSysMotion = false;
+                });
             } else {
                 // Motion complete. Includes CYCLE/JOG/HOMING states and jog cancel/motion cancel/soft limit events.
                 // NOTE: Motion and jog cancel both immediately return to idle after the hold completes.
                 if (sys.suspend.bit.jogCancel) {  // For jog cancel, flush buffers and sync positions.
-                    sys.step_control = {};
                     plan_reset();
                     st_reset();
+                    // Clears endMotion last, so that the segment prep task can't refill from the flushed buffers.
+                    sys_update_step_control([](StepControl& control) { control = {}; });
                     gc_sync_position();
                     plan_sync_position();
                 }
@@ -459,9 +461,9 @@ void protocol_exec_rt_system() {
 
     // NOTE: Unlike motion overrides, spindle overrides do not require a planner reinitialization.
     if (sys_rt_s_override != sys.spindle_speed_ovr) {
-        sys.step_control.updateSpindleRpm = true;
-        sys.spindle_speed_ovr             = sys_rt_s_override;
-        sys.report_ovr_counter            = 0;  // Set to report change immediately
+        sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = true; });
+        sys.spindle_speed_ovr  = sys_rt_s_override;
+        sys.report_ovr_counter = 0;  // Set to report change immediately
         // If spinlde is on, tell it the rpm has been overridden
         if (gc_state.modal.spindle != SpindleState::Disable) {
             spindle->set_rpm(gc_state.spindle_speed);
@@ -670,11 +672,11 @@ static void protocol_exec_rt_suspend() {
                             if (!sys.suspend.bit.restartRetract) {
                                 if (spindle->inLaserMode()) {
                                     // When in laser mode, ignore spindle spin-up delay. Set to turn on laser when cycle starts.
-                                    sys.step_control.updateSpindleRpm = true;
+                                    sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = true; });
                                 } else {
                                     spindle->set_state(restore_spindle, (uint32_t)restore_spindle_speed);
-                                    // restore delay is done in the spindle class
-                                    //delay_sec(int32_t(1000.0 * spindle_delay_spinup->get()), DwellMode::SysSuspend);
+                                    // Wait for the spin-up before the plunge. Stops waiting if the door reopens.
+                                    while (!spindle->at_speed() && delay_msec(DWELL_TIME_STEP, DwellMode::SysSuspend)) {}
                                 }
                             }
                         }
@@ -727,7 +729,7 @@ static void protocol_exec_rt_suspend() {
                             report_feedback_message(Message::SpindleRestore);
                             if (spindle->inLaserMode()) {
                                 // When in laser mode, ignore spindle spin-up delay. Set to turn on laser when cycle starts.
-                                sys.step_control.updateSpindleRpm = true;
+                                sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = true; });
                             } else {
                                 spindle->set_state(restore_spindle, (uint32_t)restore_spindle_speed);
                             }
@@ -742,7 +744,7 @@ static void protocol_exec_rt_suspend() {
                     // NOTE: sys.step_control.updateSpindleRpm is automatically reset upon resume in step generator.
                     if (sys.step_control.updateSpindleRpm) {
                         spindle->set_state(restore_spindle, (uint32_t)restore_spindle_speed);
-                        sys.step_control.updateSpindleRpm = false;
+                        sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = false; });
                     }
                 }
             }
@@ -0,0 +1,104 @@
+/*
+  Raster.cpp - G7 laser raster scanlines
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+
+#ifdef LASER_RASTER
+static_assert((RASTER_BUFFER_SIZE & (RASTER_BUFFER_SIZE - 1)) == 0, "RASTER_BUFFER_SIZE must be a power of two");
+
+uint8_t                  raster_buffer[RASTER_BUFFER_SIZE];
+volatile uint32_t        raster_tail;  // Pixels the stepper ISR is done with
+static volatile uint32_t raster_head;  // Pixels queued by raster_queue()
+
+// Returns the value of a hex digit, or -1 if c is not one. The parser has made letters upper case.
+static int hex_digit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// Reads the two hex digits at data. Returns -1 if they aren't.
+static int hex_byte(const char* data) {
+    int high = hex_digit(data[0]);
+    if (high < 0) {
+        return -1;
+    }
+    int low = hex_digit(data[1]);
+    if (low < 0) {
+        return -1;
+    }
+    return (high << 4) | low;
+}
+
+// Decodes the data of a G7 D word: pixels of two hex digits, each of them optionally followed by
+// '*' and a run length of two hex digits. With store set, writes the pixels to the buffer from
+// position head on. Returns the number of pixels, 0 if the data is malformed.
+static uint32_t raster_decode(const char* data, uint32_t head, bool store) {
+    uint32_t pixels = 0;
+    while (*data != '\0') {
+        int value = hex_byte(data);
+        if (value < 0) {
+            return 0;
+        }
+        data += 2;
+        int count = 1;
+        if (*data == '*') {
+            count = hex_byte(data + 1);
+            if (count <= 0) {
+                return 0;
+            }
+            data += 3;
+        }
+        if (store) {
+            for (int i = 0; i < count; i++) {
+                raster_buffer[(head + pixels + i) & (RASTER_BUFFER_SIZE - 1)] = value;
+            }
+        }
+        pixels += count;
+    }
+    return pixels;
+}
+
+uint32_t raster_count_pixels(const char* data) {
+    return raster_decode(data, 0, false);
+}
+
+bool raster_queue(const char* data, uint32_t pixels, uint32_t* start) {
+    // Remain in this loop until the stepper ISR has engraved enough of the queued pixels. Like a full
+    // planner buffer, this means we are well ahead of the machine.
+    while (RASTER_BUFFER_SIZE - (raster_head - raster_tail) < pixels) {
+        protocol_execute_realtime();  // Check for any run-time commands
+        if (sys.abort) {
+            return false;
+        }
+        protocol_auto_cycle_start();
+    }
+    *start = raster_head;
+    raster_decode(data, raster_head, true);
+    raster_head += pixels;
+    return true;
+}
+
+void raster_reset() {
+    raster_tail = raster_head;
+}
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+/*
+  Raster.h - G7 laser raster scanlines
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+
+#ifdef LASER_RASTER
+// The pixels of the planned G7 blocks, see LASER_RASTER in Config.h. Positions in the buffer are
+// running pixel counts, so the index is the position modulo RASTER_BUFFER_SIZE. The stepper ISR
+// advances the tail as it finishes with the pixels.
+extern uint8_t           raster_buffer[RASTER_BUFFER_SIZE];
+extern volatile uint32_t raster_tail;
+
+// Returns the number of pixels in the data of a G7 D word, or 0 if the data is malformed.
+uint32_t raster_count_pixels(const char* data);
+
+// Waits for room and decodes the pixels of the data into the buffer. Returns false on abort. Sets
+// start to the buffer position of the first pixel.
+bool raster_queue(const char* data, uint32_t pixels, uint32_t* start);
+
+// Discards all queued pixels. Called upon system reset, with the planner and stepper.
+void raster_reset();
+
+inline uint8_t raster_pixel(uint32_t position) {
+    return raster_buffer[position & (RASTER_BUFFER_SIZE - 1)];
+}
+#endif
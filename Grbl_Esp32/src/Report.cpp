@@ -48,11 +48,11 @@
 
 #include "Grbl.h"
 #include <map>
+#include <atomic>
 
 #ifdef REPORT_HEAP
 EspClass esp;
 #endif
-const int DEFAULTBUFFERSIZE = 64;
 
 void grbl_send(uint8_t client, const char* text) {
     client_write(client, text);
@@ -69,7 +69,7 @@ void grbl_sendf(uint8_t client, const char* format, ...) {
     va_list copy;
     va_start(arg, format);
     va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
+    size_t len = vsnprintf(NULL, 0, format, copy);
     va_end(copy);
     if (len >= sizeof(loc_buf)) {
         temp = new char[len + 1];
@@ -102,7 +102,7 @@ void grbl_msg_sendf(uint8_t client, MsgLevel level, const char* format, ...) {
     va_list copy;
     va_start(arg, format);
     va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
+    size_t len = vsnprintf(NULL, 0, format, copy);
     va_end(copy);
     if (len >= sizeof(loc_buf)) {
         temp = new char[len + 1];
@@ -132,7 +132,7 @@ void grbl_notifyf(const char* title, const char* format, ...) {
     va_list copy;
     va_start(arg, format);
     va_copy(copy, arg);
-    size_t len = vsnprintf(NULL, 0, format, arg);
+    size_t len = vsnprintf(NULL, 0, format, copy);
     va_end(copy);
     if (len >= sizeof(loc_buf)) {
         temp = new char[len + 1];
@@ -148,29 +148,105 @@ void grbl_notifyf(const char* title, const char* format, ...) {
     }
 }
 
-static const int coordStringLen = 20;
-static const int axesStringLen  = coordStringLen * MAX_N_AXIS;
+static const int coordStringLen   = 20;
+static const int axesStringLen    = coordStringLen * MAX_N_AXIS;
+static const int statusReportSize = 256 + 128;  // 128 for the SD file name
 
-// formats axis values into a string and returns that string in rpt
-// NOTE: rpt should have at least size: axesStringLen
-static void report_util_axis_values(float* axis_value, char* rpt) {
-    uint8_t     idx;
-    char        axisVal[coordStringLen];
-    float       unit_conv = 1.0;      // unit conversion multiplier..default is mm
-    const char* format    = "%4.3f";  // Default - report mm to 3 decimal places
-    rpt[0]                = '\0';
+// The report_append_* functions write a value at p and return the new end of the text. They let
+// a report be built in one pass, without strcat() rescanning it or sprintf() parsing a format.
+// None of them terminate the text.
+static char* report_append(char* p, const char* text) {
+    while (*text) {
+        *p++ = *text++;
+    }
+    return p;
+}
+
+static char* report_append_uint(char* p, uint32_t value) {
+    char digits[10];
+    int  n = 0;
+    do {
+        digits[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value);
+    while (n) {
+        *p++ = digits[--n];
+    }
+    return p;
+}
+
+// Appends value with 0 to 4 decimals, the same text as printf("%.*f"). The float is split into its
+// integer mantissa and binary exponent, so the decimal scaling and the rounding, half to even like
+// printf, are exact integer arithmetic.
+static char* report_append_float(char* p, float value, int decimals) {
+    static const uint32_t scale[] = { 1, 10, 100, 1000, 10000 };
+    if (!(fabsf(value) < 1e9f)) {
+        // Too large for the integer path, or not a number
+        int len = snprintf(p, coordStringLen - 1, "%.*f", decimals, value);
+        return p + (len < coordStringLen - 2 ? len : coordStringLen - 2);
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    if (bits >> 31) {
+        *p++ = '-';
+    }
+    int      exponent = (bits >> 23) & 0xff;
+    uint64_t scaled   = bits & 0x7fffff;
+    if (exponent) {
+        scaled |= 0x800000;
+    } else {
+        exponent = 1;  // Subnormal
+    }
+    // value is scaled * 2^(exponent - 150)
+    scaled *= scale[decimals];
+    int shift = 150 - exponent;
+    if (shift <= 0) {
+        scaled <<= -shift;
+    } else if (shift < 64) {
+        uint64_t rest = scaled & ((uint64_t(1) << shift) - 1);
+        uint64_t half = uint64_t(1) << (shift - 1);
+        scaled >>= shift;
+        if (rest > half || (rest == half && (scaled & 1))) {
+            scaled++;
+        }
+    } else {
+        scaled = 0;
+    }
+    p = report_append_uint(p, uint32_t(scaled / scale[decimals]));
+    if (decimals) {
+        uint32_t fraction = uint32_t(scaled % scale[decimals]);
+        *p++              = '.';
+        for (int i = decimals - 1; i >= 0; i--) {
+            p[i] = '0' + fraction % 10;
+            fraction /= 10;
+        }
+        p += decimals;
+    }
+    return p;
+}
+
+// Appends the axis values, comma separated, in the report units
+static char* report_append_axis_values(char* p, const float* axis_value) {
+    float unit_conv = 1.0;  // unit conversion multiplier..default is mm
+    int   decimals  = 3;    // Default - report mm to 3 decimal places
     if (report_inches->get()) {
         unit_conv = 1.0 / MM_PER_INCH;
-        format    = "%4.4f";  // Report inches to 4 decimal places
+        decimals  = 4;  // Report inches to 4 decimal places
     }
     auto n_axis = number_axis->get();
-    for (idx = 0; idx < n_axis; idx++) {
-        snprintf(axisVal, coordStringLen - 1, format, axis_value[idx] * unit_conv);
-        strcat(rpt, axisVal);
-        if (idx < (number_axis->get() - 1)) {
-            strcat(rpt, ",");
+    for (uint8_t idx = 0; idx < n_axis; idx++) {
+        if (idx) {
+            *p++ = ',';
         }
+        p = report_append_float(p, axis_value[idx] * unit_conv, decimals);
     }
+    return p;
+}
+
+// formats axis values into a string and returns that string in rpt
+// NOTE: rpt should have at least size: axesStringLen
+static void report_util_axis_values(float* axis_value, char* rpt) {
+    *report_append_axis_values(rpt, axis_value) = '\0';
 }
 
 // This version returns the axis values as a String
@@ -343,7 +419,7 @@ void report_ngc_parameters(uint8_t client) {
 // Print current gcode parser mode state
 void report_gcode_modes(uint8_t client) {
     char        temp[20];
-    char        modes_rpt[75];
+    char        modes_rpt[80];
     const char* mode = "";
     strcpy(modes_rpt, "[GC:");
 
@@ -414,6 +490,10 @@ void report_gcode_modes(uint8_t client) {
     }
     strcat(modes_rpt, mode);
 
+    if (gc_state.modal.control == ControlMode::Continuous) {
+        strcat(modes_rpt, " G64");
+    }
+
 #if 0
     switch (gc_state.modal.arc_distance) {
         case ArcDistance::Absolute: mode = " G90.1"; break;
@@ -564,6 +644,23 @@ void report_build_info(const char* line, uint8_t client) {
 #endif
 }
 
+#ifdef ENABLE_MOTION_STATS
+// Prints the motion performance counters. Times are in microseconds.
+void report_motion_stats(uint8_t client) {
+    grbl_sendf(client, "[MS:Underruns:%d,LastLine:%d]\r\n", st_stats.underruns, st_stats.underrun_line);
+    grbl_sendf(client, "[MS:MinSegments:%d/%d]\r\n", st_stats.min_segments, SEGMENT_BUFFER_SIZE);
+    grbl_sendf(client, "[MS:PlannerDepth/%d:", BLOCK_BUFFER_SIZE);
+    for (int bin = 0; bin < PLANNER_DEPTH_BINS; bin++) {
+        grbl_sendf(client, bin ? ",%d" : "%d", st_stats.planner_depth[bin]);
+    }
+    grbl_send(client, "]\r\n");
+    grbl_sendf(client,
+               "[MS:IsrLatency:%.2f,IsrTime:%.2f]\r\n",
+               (float)st_stats.max_isr_latency / ticksPerMicrosecond,
+               (float)st_stats.max_isr_time / ticksPerMicrosecond);
+}
+#endif
+
 // Prints the character string line Grbl has received from the user, which has been pre-parsed,
 // and has been sent into protocol_execute_line() routine to be executed by Grbl.
 void report_echo_line_received(char* line, uint8_t client) {
@@ -575,48 +672,134 @@ void report_echo_line_received(char* line, uint8_t client) {
 // float wco            = returns the work coordinate offset
 // bool wpos            = true for work position compensation
 
+#ifdef REPORT_FIELD_WORK_COORD_OFFSET
+// Appends the WCO field. The offsets rarely change between reports, so the text is kept and only
+// rebuilt when they, or the report units, do.
+static char* report_append_wco(char* p, bool use_cache) {
+    static float   shown_wco[MAX_N_AXIS];
+    static uint8_t shown_n_axis = 0;  // Nothing cached yet
+    static bool    shown_inches;
+    static char    text[axesStringLen];
+    static int     text_len;
+
+    float* wco = get_wco();
+    p          = report_append(p, "|WCO:");
+    if (!use_cache) {
+        return report_append_axis_values(p, wco);
+    }
+    uint8_t n_axis = number_axis->get();
+    bool    inches = report_inches->get();
+    if (n_axis != shown_n_axis || inches != shown_inches || memcmp(wco, shown_wco, n_axis * sizeof(float))) {
+        memcpy(shown_wco, wco, n_axis * sizeof(float));
+        shown_n_axis = n_axis;
+        shown_inches = inches;
+        text_len     = report_append_axis_values(text, wco) - text;
+    }
+    memcpy(p, text, text_len);
+    return p + text_len;
+}
+#endif
+
+#ifdef REPORT_FIELD_OVERRIDES
+// Appends the Ov and A fields, keeping their text until one of the values shown changes
+static char* report_append_overrides(char* p, bool use_cache) {
+    static uint32_t shown_key = 0;  // Never a valid key, since overrides are at least 1%
+    static char     text[40];
+    static int      text_len;
+
+    SpindleState sp_state      = spindle->get_state();
+    CoolantState coolant_state = coolant_get_state();
+
+    uint32_t key = sys.f_override | (sys.r_override << 8) | (sys.spindle_speed_ovr << 16) | (uint32_t(sp_state) << 24);
+    key |= (coolant_state.Flood << 28) | (coolant_state.Mist << 29);
+    if (use_cache && key == shown_key) {
+        memcpy(p, text, text_len);
+        return p + text_len;
+    }
+
+    char* start = p;
+    p           = report_append(p, "|Ov:");
+    p           = report_append_uint(p, sys.f_override);
+    *p++        = ',';
+    p           = report_append_uint(p, sys.r_override);
+    *p++        = ',';
+    p           = report_append_uint(p, sys.spindle_speed_ovr);
+    if (sp_state != SpindleState::Disable || coolant_state.Mist || coolant_state.Flood) {
+        p = report_append(p, "|A:");
+        switch (sp_state) {
+            case SpindleState::Disable:
+                break;
+            case SpindleState::Cw:
+                *p++ = 'S';
+                break;
+            case SpindleState::Ccw:
+                *p++ = 'C';
+                break;
+        }
+
+        auto coolant = coolant_state;
+        if (coolant.Flood) {
+            *p++ = 'F';
+        }
+#    ifdef COOLANT_MIST_PIN  // TODO Deal with M8 - Flood
+        if (coolant.Mist) {
+            *p++ = 'M';
+        }
+#    endif
+    }
+    if (use_cache) {
+        text_len = p - start;
+        memcpy(text, start, text_len);
+        shown_key = key;
+    }
+    return p;
+}
+#endif
+
+#ifdef REPORT_FIELD_BUFFER_STATE
+// Appends the Bf field, the free planner blocks and the free space in the client's receive buffer
+static char* report_append_bf(char* p, uint8_t client) {
+    p    = report_append(p, "|Bf:");
+    p    = report_append_uint(p, plan_get_block_buffer_available());
+    *p++ = ',';
+    return report_append_uint(p, client_get_rx_buffer_available(client));
+}
+#endif
+
+// Guards the cached report fields. Status reports are sent by both the protocol loop and the
+// client task, and a report that finds the cache in use formats every field itself.
+static std::atomic<bool> status_cache_busy;
+
 // Prints real-time data. This function grabs a real-time snapshot of the stepper subprogram
 // and the actual location of the CNC machine. Users may change the following function to their
 // specific needs, but the desired real-time data report must be as short as possible. This is
 // requires as it minimizes the computational overhead and allows grbl to keep running smoothly,
 // especially during g-code programs with fast, short line segments and high frequency reports (5-20Hz).
-void report_realtime_status(uint8_t client) {
-    char status[200];
-    char temp[MAX_N_AXIS * 20];
+// Builds the report for client and returns its end. If it has a Bf field, *bf_field and *bf_end
+// are set to where that is, so the report can be sent to other clients with theirs.
+static char* report_build_status(char* status, uint8_t client, char** bf_field, char** bf_end) {
+    char* p         = status;
+    bool  expected  = false;
+    bool  use_cache = status_cache_busy.compare_exchange_strong(expected, true);
 
-    strcpy(status, "<");
-    strcat(status, report_state_text());
+    *p++ = '<';
+    p    = report_append(p, report_state_text());
 
     // Report position
     float* print_position = system_get_mpos();
     if (bit_istrue(status_mask->get(), RtStatus::Position)) {
-        strcat(status, "|MPos:");
+        p = report_append(p, "|MPos:");
     } else {
-        strcat(status, "|WPos:");
+        p = report_append(p, "|WPos:");
         mpos_to_wpos(print_position);
     }
-    report_util_axis_values(print_position, temp);
-    strcat(status, temp);
+    p = report_append_axis_values(p, print_position);
     // Returns planner and serial read buffer states.
 #ifdef REPORT_FIELD_BUFFER_STATE
     if (bit_istrue(status_mask->get(), RtStatus::Buffer)) {
-        int bufsize = DEFAULTBUFFERSIZE;
-#    if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
-        if (client == CLIENT_TELNET) {
-            bufsize = WebUI::telnet_server.get_rx_buffer_available();
-        }
-#    endif  //ENABLE_WIFI && ENABLE_TELNET
-#    if defined(ENABLE_BLUETOOTH)
-        if (client == CLIENT_BT) {
-            //TODO FIXME
-            bufsize = 512 - WebUI::SerialBT.available();
-        }
-#    endif  //ENABLE_BLUETOOTH
-        if (client == CLIENT_SERIAL) {
-            bufsize = client_get_rx_buffer_available(CLIENT_SERIAL);
-        }
-        sprintf(temp, "|Bf:%d,%d", plan_get_block_buffer_available(), bufsize);
-        strcat(status, temp);
+        *bf_field = p;
+        p         = report_append_bf(p, client);
+        *bf_end   = p;
     }
 #endif
 #ifdef USE_LINE_NUMBERS
@@ -626,75 +809,64 @@ void report_realtime_status(uint8_t client) {
     if (cur_block != NULL) {
         uint32_t ln = cur_block->line_number;
         if (ln > 0) {
-            sprintf(temp, "|Ln:%d", ln);
-            strcat(status, temp);
+            p = report_append(p, "|Ln:");
+            p = report_append_uint(p, ln);
         }
     }
 #    endif
 #endif
     // Report realtime feed speed
 #ifdef REPORT_FIELD_CURRENT_FEED_SPEED
+    p = report_append(p, "|FS:");
     if (report_inches->get()) {
-        sprintf(temp, "|FS:%.1f,%d", st_get_realtime_rate() / MM_PER_INCH, sys.spindle_speed);
+        p = report_append_float(p, st_get_realtime_rate() / MM_PER_INCH, 1);
     } else {
-        sprintf(temp, "|FS:%.0f,%d", st_get_realtime_rate(), sys.spindle_speed);
+        p = report_append_float(p, st_get_realtime_rate(), 0);
     }
-    strcat(status, temp);
+    *p++ = ',';
+    p    = report_append_uint(p, sys.spindle_speed);
 #endif
 #ifdef REPORT_FIELD_PIN_STATE
     AxisMask    lim_pin_state  = limits_get_state();
     ControlPins ctrl_pin_state = system_control_get_state();
     bool        prb_pin_state  = probe_get_state();
     if (lim_pin_state || ctrl_pin_state.value || prb_pin_state) {
-        strcat(status, "|Pn:");
+        p = report_append(p, "|Pn:");
         if (prb_pin_state) {
-            strcat(status, "P");
+            *p++ = 'P';
         }
         if (lim_pin_state) {
             auto n_axis = number_axis->get();
-            if (n_axis >= 1 && bit_istrue(lim_pin_state, bit(X_AXIS))) {
-                strcat(status, "X");
-            }
-            if (n_axis >= 2 && bit_istrue(lim_pin_state, bit(Y_AXIS))) {
-                strcat(status, "Y");
-            }
-            if (n_axis >= 3 && bit_istrue(lim_pin_state, bit(Z_AXIS))) {
-                strcat(status, "Z");
-            }
-            if (n_axis >= 4 && bit_istrue(lim_pin_state, bit(A_AXIS))) {
-                strcat(status, "A");
-            }
-            if (n_axis >= 5 && bit_istrue(lim_pin_state, bit(B_AXIS))) {
-                strcat(status, "B");
-            }
-            if (n_axis >= 6 && bit_istrue(lim_pin_state, bit(C_AXIS))) {
-                strcat(status, "C");
+            for (uint8_t idx = 0; idx < n_axis; idx++) {
+                if (bit_istrue(lim_pin_state, bit(idx))) {
+                    *p++ = report_get_axis_letter(idx);
+                }
             }
         }
         if (ctrl_pin_state.value) {
             if (ctrl_pin_state.bit.safetyDoor) {
-                strcat(status, "D");
+                *p++ = 'D';
             }
             if (ctrl_pin_state.bit.reset) {
-                strcat(status, "R");
+                *p++ = 'R';
             }
             if (ctrl_pin_state.bit.feedHold) {
-                strcat(status, "H");
+                *p++ = 'H';
             }
             if (ctrl_pin_state.bit.cycleStart) {
-                strcat(status, "S");
+                *p++ = 'S';
             }
             if (ctrl_pin_state.bit.macro0) {
-                strcat(status, "0");
+                *p++ = '0';
             }
             if (ctrl_pin_state.bit.macro1) {
-                strcat(status, "1");
+                *p++ = '1';
             }
             if (ctrl_pin_state.bit.macro2) {
-                strcat(status, "2");
+                *p++ = '2';
             }
             if (ctrl_pin_state.bit.macro3) {
-                strcat(status, "3");
+                *p++ = '3';
             }
         }
     }
@@ -717,9 +889,7 @@ void report_realtime_status(uint8_t client) {
         if (sys.report_ovr_counter == 0) {
             sys.report_ovr_counter = 1;  // Set override on next report.
         }
-        strcat(status, "|WCO:");
-        report_util_axis_values(get_wco(), temp);
-        strcat(status, temp);
+        p = report_append_wco(p, use_cache);
     }
 #endif
 #ifdef REPORT_FIELD_OVERRIDES
@@ -737,52 +907,166 @@ void report_realtime_status(uint8_t client) {
                 sys.report_ovr_counter = (REPORT_OVR_REFRESH_IDLE_COUNT - 1);
                 break;
         }
-
-        sprintf(temp, "|Ov:%d,%d,%d", sys.f_override, sys.r_override, sys.spindle_speed_ovr);
-        strcat(status, temp);
-        SpindleState sp_state      = spindle->get_state();
-        CoolantState coolant_state = coolant_get_state();
-        if (sp_state != SpindleState::Disable || coolant_state.Mist || coolant_state.Flood) {
-            strcat(status, "|A:");
-            switch (sp_state) {
-                case SpindleState::Disable:
-                    break;
-                case SpindleState::Cw:
-                    strcat(status, "S");
-                    break;
-                case SpindleState::Ccw:
-                    strcat(status, "C");
-                    break;
-            }
-
-            auto coolant = coolant_state;
-            if (coolant.Flood) {
-                strcat(status, "F");
-            }
-#    ifdef COOLANT_MIST_PIN  // TODO Deal with M8 - Flood
-            if (coolant.Mist) {
-                strcat(status, "M");
-            }
-#    endif
-        }
+        p = report_append_overrides(p, use_cache);
+    }
+#endif
+    if (use_cache) {
+        status_cache_busy.store(false);
+    }
+#ifdef ENABLE_MOTION_STATS
+    if (bit_istrue(status_mask->get(), RtStatus::MotionStats)) {
+        p += sprintf(p,
+                     "|MS:%d,%d,%.2f,%.2f",
+                     st_stats.underruns,
+                     st_stats.min_segments,
+                     (float)st_stats.max_isr_latency / ticksPerMicrosecond,
+                     (float)st_stats.max_isr_time / ticksPerMicrosecond);
     }
 #endif
 #ifdef ENABLE_SD_CARD
     if (get_sd_state(false) == SDState::BusyPrinting) {
-        sprintf(temp, "|SD:%4.2f,", sd_report_perc_complete());
-        strcat(status, temp);
-        sd_get_current_filename(temp);
-        strcat(status, temp);
+        p    = report_append(p, "|SD:");
+        p    = report_append_float(p, sd_report_perc_complete(), 2);
+        *p++ = ',';
+        sd_get_current_filename(p);
+        p += strlen(p);
     }
 #endif
 #ifdef REPORT_HEAP
-    sprintf(temp, "|Heap:%d", esp.getHeapSize());
-    strcat(status, temp);
+    p = report_append(p, "|Heap:");
+    p = report_append_uint(p, esp.getHeapSize());
 #endif
-    strcat(status, ">\r\n");
+    strcpy(p, ">\r\n");
+    return p + 3;
+}
+
+// Prints a status report
+void report_realtime_status(uint8_t client) {
+    char  status[statusReportSize];
+    char* bf_field = NULL;
+    char* bf_end;
+    report_build_status(status, client, &bf_field, &bf_end);
     grbl_send(client, status);
 }
 
+// Sends a report built by report_build_status() to another client, with that client's Bf field
+static void report_resend_status(const char* status, const char* end, const char* bf_field, const char* bf_end, uint8_t client) {
+    if (bf_field == NULL) {
+        grbl_send(client, status);
+        return;
+    }
+    char  report[statusReportSize];
+    char* p = report;
+    memcpy(p, status, bf_field - status);
+    p += bf_field - status;
+    p = report_append_bf(p, client);
+    memcpy(p, bf_end, end - bf_end + 1);  // With the terminator
+    grbl_send(client, report);
+}
+
+// A client that has asked with $RI for status reports to be pushed to it
+typedef struct {
+    uint32_t interval_ms;   // 0 if the client is not subscribed
+    float    threshold;     // Position change in mm that triggers a report, or 0 to report every interval
+    uint32_t last_ms;       // When the last report was pushed
+    char     last_state[10];
+    float    last_mpos[MAX_N_AXIS];
+} status_subscription_t;
+
+static status_subscription_t status_subscriptions[CLIENT_COUNT];
+static std::atomic<uint8_t>  n_status_subscriptions(0);  // Also ended from the Bluetooth task
+
+bool report_status_subscribe(uint8_t client, uint32_t interval_ms, float threshold) {
+    if (client >= CLIENT_COUNT || client == CLIENT_INPUT) {
+        return false;  // No connection to push reports on
+    }
+#if !defined(ENABLE_WIFI) || !defined(ENABLE_HTTP) || !defined(ENABLE_SERIAL2SOCKET_OUT)
+    if (client == CLIENT_WEBUI) {
+        return false;
+    }
+#endif
+    if (interval_ms && interval_ms < STATUS_INTERVAL_MIN_MS) {
+        return false;
+    }
+    status_subscription_t* sub = &status_subscriptions[client];
+    if (sub->interval_ms) {
+        n_status_subscriptions--;
+    }
+    sub->interval_ms   = interval_ms;
+    sub->threshold     = threshold;
+    sub->last_ms       = millis() - interval_ms;  // Due now
+    sub->last_state[0] = '\0';
+    if (interval_ms) {
+        n_status_subscriptions++;
+    }
+    return true;
+}
+
+void report_status_unsubscribe(uint8_t client) {
+    if (client < CLIENT_COUNT && status_subscriptions[client].interval_ms) {
+        status_subscriptions[client].interval_ms = 0;
+        n_status_subscriptions--;
+    }
+}
+
+bool report_status_subscription(uint8_t client, uint32_t* interval_ms, float* threshold) {
+    if (client >= CLIENT_COUNT || status_subscriptions[client].interval_ms == 0) {
+        return false;
+    }
+    *interval_ms = status_subscriptions[client].interval_ms;
+    *threshold   = status_subscriptions[client].threshold;
+    return true;
+}
+
+// Pushes a status report to each subscribed client that is due for one. The report is built once,
+// for the first of them, and copied to the others with their own Bf field.
+void report_push_status() {
+    if (n_status_subscriptions == 0) {
+        return;
+    }
+    uint32_t now = millis();
+    uint8_t  due[CLIENT_COUNT];
+    uint8_t  n_due = 0;
+    float*   mpos  = NULL;
+    char*    state = NULL;
+    for (uint8_t client = 0; client < CLIENT_COUNT; client++) {
+        status_subscription_t* sub = &status_subscriptions[client];
+        if (sub->interval_ms == 0 || now - sub->last_ms < sub->interval_ms) {
+            continue;
+        }
+        if (sub->threshold > 0) {
+            // Only report a change in state or a move beyond the threshold
+            if (mpos == NULL) {
+                mpos  = system_get_mpos();
+                state = report_state_text();
+            }
+            bool changed = strcmp(state, sub->last_state) != 0;
+            auto n_axis  = number_axis->get();
+            for (uint8_t idx = 0; idx < n_axis && !changed; idx++) {
+                changed = fabsf(mpos[idx] - sub->last_mpos[idx]) > sub->threshold;
+            }
+            if (!changed) {
+                continue;
+            }
+            strcpy(sub->last_state, state);
+            memcpy(sub->last_mpos, mpos, sizeof(sub->last_mpos));
+        }
+        sub->last_ms = now;
+        due[n_due++] = client;
+    }
+    if (n_due == 0) {
+        return;
+    }
+    char  status[statusReportSize];
+    char* bf_field = NULL;
+    char* bf_end;
+    char* end = report_build_status(status, due[0], &bf_field, &bf_end);
+    grbl_send(due[0], status);
+    for (uint8_t i = 1; i < n_due; i++) {
+        report_resend_status(status, end, bf_field, bf_end, due[i]);
+    }
+}
+
 void report_realtime_steps() {
     uint8_t idx;
     auto    n_axis = number_axis->get();
@@ -22,8 +22,9 @@
 
 // Define status reporting boolean enable bit flags in status_report_mask
 enum RtStatus {
-    Position = bit(0),
-    Buffer   = bit(1),
+    Position    = bit(0),
+    Buffer      = bit(1),
+    MotionStats = bit(2),
 };
 
 const char* errorString(Error errorNumber);
@@ -95,6 +96,23 @@ void report_echo_line_received(char* line, uint8_t client);
 // Prints realtime status report
 void report_realtime_status(uint8_t client);
 
+// The shortest interval a client can subscribe with, 50 reports a second
+const uint32_t STATUS_INTERVAL_MIN_MS = 20;
+
+// Subscribes client to status reports pushed every interval_ms, or, with a threshold, pushed at most
+// that often and only when the state changes or the machine moves more than threshold mm. An
+// interval of 0 ends the subscription. Returns false if reports cannot be pushed to the client, or
+// if the interval is below STATUS_INTERVAL_MIN_MS.
+bool report_status_subscribe(uint8_t client, uint32_t interval_ms, float threshold);
+bool report_status_subscription(uint8_t client, uint32_t* interval_ms, float* threshold);
+
+// Ends the subscription of a client whose connection has closed, so the next one to connect
+// does not get reports it has not asked for
+void report_status_unsubscribe(uint8_t client);
+
+// Pushes status reports to the subscribed clients that are due for one
+void report_push_status();
+
 // Prints recorded probe position
 void report_probe_parameters(uint8_t client);
 
@@ -111,6 +129,9 @@ void report_execute_startup_message(const char* line, Error status_code, uint8_t
 // Prints build info and user info
 void report_build_info(const char* line, uint8_t client);
 
+// Prints the segment buffer and stepper interrupt counters
+void report_motion_stats(uint8_t client);
+
 void report_gcode_comment(char* comment);
 
 #ifdef DEBUG
@@ -23,12 +23,92 @@
 #    include "SDCard.h"
 
 File                       myFile;
-bool                       SD_ready_next = false;  // Grbl has processed a line and is waiting for another
-uint8_t                    SD_client     = CLIENT_SERIAL;
-WebUI::AuthenticationLevel SD_auth_level = WebUI::AuthenticationLevel::LEVEL_GUEST;
+bool                       SD_ready_next   = false;  // Grbl has processed a line and is waiting for another
+bool                       SD_compiled_job = false;  // The open file is a compiled job, see SDCompile.h
+uint8_t                    SD_client       = CLIENT_SERIAL;
+WebUI::AuthenticationLevel SD_auth_level   = WebUI::AuthenticationLevel::LEVEL_GUEST;
 uint32_t                   sd_current_line_number;     // stores the most recent line number read from the SD
 static char                comment[LINE_BUFFER_SIZE];  // Line to be executed. Zero-terminated.
 
+#    ifdef SD_READ_AHEAD
+// sdReadTask() fills the ring from the open file and readFileLine() empties it. The head and tail
+// are running byte counts, so the ring index is the count modulo SD_READ_AHEAD_SIZE.
+static_assert((SD_READ_AHEAD_SIZE & (SD_READ_AHEAD_SIZE - 1)) == 0, "SD_READ_AHEAD_SIZE must be a power of two");
+static_assert(SD_READ_AHEAD_SIZE >= SD_READ_CHUNK_SIZE && (SD_READ_CHUNK_SIZE & (SD_READ_CHUNK_SIZE - 1)) == 0,
+              "SD_READ_CHUNK_SIZE must be a power of two, at most SD_READ_AHEAD_SIZE");
+static uint8_t           sd_ring[SD_READ_AHEAD_SIZE];
+static volatile uint32_t sd_ring_head;    // Bytes read from the file by sdReadTask()
+static volatile uint32_t sd_ring_tail;    // Bytes taken by readFileLine()
+static volatile uint32_t sd_lines_read;   // Newlines read by sdReadTask()
+static volatile uint32_t sd_lines_taken;  // Newlines taken by readFileLine()
+static volatile bool     sd_read_eof;     // sdReadTask() has read the whole file
+static uint32_t          sd_file_size;
+static SemaphoreHandle_t sdFileMutex      = NULL;  // Keeps closeFile() from closing the file under a read
+static TaskHandle_t      sdReadTaskHandle = NULL;
+
+static void sdReadTask(void* pvParameters) {
+    while (true) {
+        bool more = false;
+        xSemaphoreTake(sdFileMutex, portMAX_DELAY);
+        if (myFile && !sd_read_eof && SD_READ_AHEAD_SIZE - (sd_ring_head - sd_ring_tail) >= SD_READ_CHUNK_SIZE) {
+            // The head only advances by whole chunks until the end of the file, so a chunk never wraps.
+            uint8_t* chunk = &sd_ring[sd_ring_head % SD_READ_AHEAD_SIZE];
+            int      len   = myFile.read(chunk, SD_READ_CHUNK_SIZE);
+            if (len < 0) {
+                len = 0;
+            }
+            uint32_t lines = 0;
+            for (int i = 0; i < len; i++) {
+                lines += chunk[i] == '\n';
+            }
+            sd_ring_head += len;
+            sd_lines_read += lines;
+            // Set last, so a reader that sees the end of the file also sees all of its bytes.
+            sd_read_eof = len < SD_READ_CHUNK_SIZE;
+            more        = !sd_read_eof;
+        }
+        xSemaphoreGive(sdFileMutex);
+        if (!more) {
+            // Sleep until readFileLine() frees some space or openFile() starts a new file
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+}
+
+// Starts reading the newly opened file into an empty ring
+static void sd_read_ahead_start() {
+    sd_ring_head   = 0;
+    sd_ring_tail   = 0;
+    sd_lines_read  = 0;
+    sd_lines_taken = 0;
+    sd_read_eof    = false;
+    sd_file_size   = myFile.size();
+    xTaskNotifyGive(sdReadTaskHandle);
+}
+
+// Waits for the ring to hold at least one byte. Returns false at the end of the file.
+static bool sd_ring_wait() {
+    while (true) {
+        bool eof = sd_read_eof;
+        if (sd_ring_tail != sd_ring_head) {
+            return true;
+        }
+        if (eof) {
+            return false;
+        }
+        // The card is behind. Wait for sdReadTask() to catch up.
+        xTaskNotifyGive(sdReadTaskHandle);
+        vTaskDelay(1);
+    }
+}
+
+// True if readFileLine() can return the next line without waiting for the card
+boolean sd_line_ready() {
+    bool eof = sd_read_eof;
+    return sd_lines_read != sd_lines_taken || (eof && sd_ring_tail != sd_ring_head);
+}
+#    endif
+
 // attempt to mount the SD card
 /*bool sd_mount()
 {
@@ -64,13 +144,34 @@ void listDir(fs::FS& fs, const char* dirname, uint8_t levels, uint8_t client) {
 }
 
 boolean openFile(fs::FS& fs, const char* path) {
+#    ifdef SD_READ_AHEAD
+    if (sdFileMutex == NULL) {
+        sdFileMutex = xSemaphoreCreateMutex();
+        xTaskCreatePinnedToCore(sdReadTask,          // task
+                                "sdReadTask",        // name for task
+                                4096,                // size of task stack
+                                NULL,                // parameters
+                                SD_READ_TASK_PRIORITY,
+                                &sdReadTaskHandle,
+                                SUPPORT_TASK_CORE  // run with the main loop, leaving the other core to motion
+        );
+    }
+    xSemaphoreTake(sdFileMutex, portMAX_DELAY);
     myFile = fs.open(path);
+    if (myFile) {
+        sd_read_ahead_start();
+    }
+    xSemaphoreGive(sdFileMutex);
+#    else
+    myFile = fs.open(path);
+#    endif
     if (!myFile) {
         //report_status_message(Error::FsFailedRead, CLIENT_SERIAL);
         return false;
     }
     set_sd_state(SDState::BusyPrinting);
     SD_ready_next          = false;  // this will get set to true when Grbl issues "ok" message
+    SD_compiled_job        = false;
     sd_current_line_number = 0;
     return true;
 }
@@ -81,8 +182,15 @@ boolean closeFile() {
     }
     set_sd_state(SDState::Idle);
     SD_ready_next          = false;
+    SD_compiled_job        = false;
     sd_current_line_number = 0;
+#    ifdef SD_READ_AHEAD
+    xSemaphoreTake(sdFileMutex, portMAX_DELAY);
+    myFile.close();
+    xSemaphoreGive(sdFileMutex);
+#    else
     myFile.close();
+#    endif
     SD.end();
     return true;
 }
@@ -101,18 +209,72 @@ boolean readFileLine(char* line, int maxlen) {
     }
     sd_current_line_number += 1;
     int len = 0;
-    while (myFile.available()) {
-        if (len >= maxlen) {
+#    ifdef SD_READ_AHEAD
+    while (sd_ring_wait()) {
+        char c = sd_ring[sd_ring_tail % SD_READ_AHEAD_SIZE];
+        sd_ring_tail++;
+        if (c == '\n') {
+            sd_lines_taken++;
+            break;
+        }
+        if (len >= maxlen - 1) {
             return false;
         }
+        line[len++] = c;
+    }
+    // Let sdReadTask() refill the space
+    xTaskNotifyGive(sdReadTaskHandle);
+    bool eof  = sd_read_eof;
+    line[len] = '\0';
+    return len || sd_ring_tail != sd_ring_head || !eof;
+#    else
+    while (myFile.available()) {
         char c = myFile.read();
         if (c == '\n') {
             break;
         }
+        if (len >= maxlen - 1) {
+            return false;
+        }
         line[len++] = c;
     }
     line[len] = '\0';
     return len || myFile.available();
+#    endif
+}
+
+// Returns the next byte of the file without taking it, or -1 at the end of the file
+int peekFile() {
+    if (!myFile) {
+        return -1;
+    }
+#    ifdef SD_READ_AHEAD
+    return sd_ring_wait() ? sd_ring[sd_ring_tail % SD_READ_AHEAD_SIZE] : -1;
+#    else
+    return myFile.peek();
+#    endif
+}
+
+// Reads len bytes of binary data. Returns false if the file ends first.
+boolean readFileBytes(uint8_t* data, int len) {
+    if (!myFile) {
+        return false;
+    }
+#    ifdef SD_READ_AHEAD
+    for (int i = 0; i < len; i++) {
+        if (!sd_ring_wait()) {
+            return false;
+        }
+        data[i] = sd_ring[sd_ring_tail % SD_READ_AHEAD_SIZE];
+        sd_ring_tail++;
+        // Keep sd_line_ready() counting text lines only
+        sd_lines_taken += data[i] == '\n';
+    }
+    xTaskNotifyGive(sdReadTaskHandle);
+    return true;
+#    else
+    return myFile.read(data, len) == (int)len;
+#    endif
 }
 
 // return a percentage complete 50.5 = 50.5%
@@ -120,7 +282,12 @@ float sd_report_perc_complete() {
     if (!myFile) {
         return 0.0;
     }
+#    ifdef SD_READ_AHEAD
+    // The file position is ahead by the buffered bytes; count what the parser has taken
+    return (float)sd_ring_tail / (float)sd_file_size * 100.0f;
+#    else
     return (float)myFile.position() / (float)myFile.size() * 100.0f;
+#    endif
 }
 
 uint32_t sd_get_current_line_number() {
@@ -32,9 +32,11 @@ enum class SDState : uint8_t {
     BusyParsing   = 4,
 };
 
-extern bool                       SD_ready_next;  // Grbl has processed a line and is waiting for another
+extern bool                       SD_ready_next;    // Grbl has processed a line and is waiting for another
+extern bool                       SD_compiled_job;  // The open file is a compiled job, see SDCompile.h
 extern uint8_t                    SD_client;
 extern WebUI::AuthenticationLevel SD_auth_level;
+extern uint32_t                   sd_current_line_number;
 
 //bool sd_mount();
 SDState  get_sd_state(bool refresh);
@@ -43,6 +45,9 @@ void     listDir(fs::FS& fs, const char* dirname, uint8_t levels, uint8_t client
 boolean  openFile(fs::FS& fs, const char* path);
 boolean  closeFile();
 boolean  readFileLine(char* line, int len);
+int      peekFile();
+boolean  readFileBytes(uint8_t* data, int len);
+boolean  sd_line_ready();
 void     readFile(fs::FS& fs, const char* path);
 float    sd_report_perc_complete();
 uint32_t sd_get_current_line_number();
@@ -0,0 +1,602 @@
+/*
+  SDCompile.cpp - Pre-parsed SD card jobs
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Config.h"
+#if defined(ENABLE_SD_CARD) && defined(ENABLE_SD_COMPILE)
+#    include "SDCompile.h"
+
+/*
+  The compiler runs the file through the parser in check mode, so every line is validated and the
+  parser state follows the file, and stores the motion of each line that does nothing but move as
+  a record. A job file is a header followed by entries, each of which is either a text line ending
+  in '\n' or a MotionRecord byte followed by a compiled_motion_t.
+
+  The records hold the parser's results, so they are only valid if the job starts in the parser
+  state the compiler started in. The compiler keeps track of the parser state each record depends
+  on that the file has not set itself, and of the axes whose position is not known yet. A motion
+  line that needs an unknown position stays text. The header holds a hash of the state the records
+  depend on, and a job whose hash does not match the current state runs from the source file as
+  text instead.
+
+  Lines that would have effects outside the parser in check mode, like settings, $ commands, G10,
+  M6 and M62, end compilation; they and the rest of the file are stored as text.
+*/
+
+static const char    CompiledJobExtension[] = ".gcb";
+static const char    CompiledJobMagic[4]    = { 'G', 'C', 'B', '1' };
+static const uint8_t MotionRecord           = 0x01;  // Starts a motion record
+static const int     CompileLineSize        = 255;   // The line buffer size in protocol_main_loop()
+
+typedef struct {
+    char     magic[4];
+    uint16_t record_size;  // sizeof(compiled_motion_t), which depends on the build
+    uint16_t state_mask;   // StateDependency bits the records depend on
+    uint32_t state_hash;
+    uint32_t source_size;
+    uint32_t source_hash;
+    uint32_t payload_size;  // Bytes after the header
+    uint32_t payload_hash;
+} compiled_header_t;
+
+// Parts of the parser state that motion records can depend on
+enum StateDependency : uint16_t {
+    StateUnits        = bit(0),
+    StateDistance     = bit(1),
+    StatePlane        = bit(2),
+    StateFeedMode     = bit(3),
+    StateCoordSystem  = bit(4),
+    StateCoordOffset  = bit(5),
+    StateToolLength   = bit(6),
+    StateFeedRate     = bit(7),
+    StateSpindle      = bit(8),
+    StateSpindleSpeed = bit(9),
+    StateCoolant      = bit(10),
+    StateMotion       = bit(11),
+    StateAll          = bit(12) - 1,
+};
+
+// What the words of a line do
+typedef struct {
+    bool     safe;            // Has no effects outside the parser state in check mode
+    bool     motion_only;     // Only G0-G3, N, F, axis and arc words
+    bool     go_home;         // G28 or G30
+    bool     set_offset;      // G92
+    bool     machine_coords;  // G53
+    uint8_t  axes;            // Axis words
+    uint16_t defines;         // StateDependency bits the line sets regardless of the state before it
+} line_words_t;
+
+static const uint32_t FnvOffsetBasis = 2166136261;
+
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t len) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (len--) {
+        hash = (hash ^ *p++) * 16777619;
+    }
+    return hash;
+}
+
+// Hashes the parts of state selected by mask, along with the settings the parser always uses
+static uint32_t state_hash(const parser_state_t* state, uint16_t mask) {
+    uint32_t hash   = FnvOffsetBasis;
+    uint8_t  n_axis = number_axis->get();
+    bool     laser  = laser_mode->get();
+    hash            = fnv1a(hash, &n_axis, sizeof(n_axis));
+    hash            = fnv1a(hash, &laser, sizeof(laser));
+    for (CoordIndex i = CoordIndex::Begin; i < CoordIndex::End; ++i) {
+        hash = fnv1a(hash, coords[i]->get(), sizeof(float) * n_axis);
+    }
+    hash = fnv1a(hash, &mask, sizeof(mask));
+    if (mask & StateUnits) {
+        hash = fnv1a(hash, &state->modal.units, sizeof(state->modal.units));
+    }
+    if (mask & StateDistance) {
+        hash = fnv1a(hash, &state->modal.distance, sizeof(state->modal.distance));
+    }
+    if (mask & StatePlane) {
+        hash = fnv1a(hash, &state->modal.plane_select, sizeof(state->modal.plane_select));
+    }
+    if (mask & StateFeedMode) {
+        hash = fnv1a(hash, &state->modal.feed_rate, sizeof(state->modal.feed_rate));
+    }
+    if (mask & StateCoordSystem) {
+        hash = fnv1a(hash, &state->modal.coord_select, sizeof(state->modal.coord_select));
+    }
+    if (mask & StateCoordOffset) {
+        hash = fnv1a(hash, state->coord_offset, sizeof(float) * n_axis);
+    }
+    if (mask & StateToolLength) {
+        hash = fnv1a(hash, &state->tool_length_offset, sizeof(state->tool_length_offset));
+    }
+    if (mask & StateFeedRate) {
+        hash = fnv1a(hash, &state->feed_rate, sizeof(state->feed_rate));
+    }
+    if (mask & StateSpindle) {
+        hash = fnv1a(hash, &state->modal.spindle, sizeof(state->modal.spindle));
+    }
+    if (mask & StateSpindleSpeed) {
+        hash = fnv1a(hash, &state->spindle_speed, sizeof(state->spindle_speed));
+    }
+    if (mask & StateCoolant) {
+        hash = fnv1a(hash, &state->modal.coolant, sizeof(state->modal.coolant));
+    }
+    if (mask & StateMotion) {
+        hash = fnv1a(hash, &state->modal.motion, sizeof(state->modal.motion));
+    }
+    return hash;
+}
+
+// Hashes the rest of an open file. Returns the number of bytes read.
+static uint32_t file_hash(File& file, uint32_t* hash) {
+    uint8_t  buf[512];
+    uint32_t size = 0;
+    int      len;
+    *hash = FnvOffsetBasis;
+    while ((len = file.read(buf, sizeof(buf))) > 0) {
+        *hash = fnv1a(*hash, buf, len);
+        size += len;
+    }
+    return size;
+}
+
+static String compiled_path(const char* path) {
+    String out = path;
+    int    dot = out.lastIndexOf('.');
+    if (dot > out.lastIndexOf('/')) {
+        out = out.substring(0, dot);
+    }
+    return out + CompiledJobExtension;
+}
+
+// Reads lines from the source file a sector at a time, the way readFileLine() splits them,
+// and hashes the file as it goes. Returns the line length, -1 at the end of the file, or -2
+// if the line does not fit.
+typedef struct {
+    File     file;
+    uint8_t  buf[512];
+    int      len;
+    int      pos;
+    uint32_t hash;
+} line_reader_t;
+
+static int read_line(line_reader_t* r, char* line, int maxlen) {
+    int  len = 0;
+    bool any = false;
+    while (true) {
+        if (r->pos == r->len) {
+            r->len = r->file.read(r->buf, sizeof(r->buf));
+            r->pos = 0;
+            if (r->len <= 0) {
+                r->len = 0;
+                break;
+            }
+            r->hash = fnv1a(r->hash, r->buf, r->len);
+        }
+        char c = r->buf[r->pos++];
+        any    = true;
+        if (c == '\n') {
+            break;
+        }
+        if (len >= maxlen - 1) {
+            return -2;
+        }
+        line[len++] = c;
+    }
+    line[len] = '\0';
+    return any ? len : -1;
+}
+
+// Copies line to out without whitespace and comments, in upper case, the way collapseGCode()
+// does but without reporting the comments. Returns true if the line has a comment that
+// collapseGCode() would report.
+static bool strip_line(const char* line, char* out) {
+    bool in_comment = false;
+    bool reported   = false;
+    char c;
+    for (; (c = *line) != '\0'; line++) {
+        if (in_comment) {
+            in_comment = c != ')';
+        } else if (c == '(') {
+            in_comment = true;
+            reported   = true;
+        } else if (c == ';') {
+#    ifdef REPORT_SEMICOLON_COMMENTS
+            reported = true;
+#    endif
+            break;
+        } else if (!isspace(c) && c != ')' && c != '%' && c != '\r') {
+            *out++ = toupper(c);
+        }
+    }
+    *out = '\0';
+    return reported;
+}
+
+static line_words_t scan_words(const char* line) {
+    line_words_t words = {};
+    words.safe         = line[0] != '$' && line[0] != '[';
+    words.motion_only  = words.safe;
+    uint8_t pos        = 0;
+    while (words.safe && line[pos] != '\0') {
+        char  letter = line[pos++];
+        float value;
+        if (!read_float(line, &pos, &value)) {
+            // The parser will reject the line before doing anything
+            words.motion_only = false;
+            break;
+        }
+        int code = lroundf(value * 10);  // G92.1 is 921
+        switch (letter) {
+            case 'G':
+                switch (code) {
+                    case 0:
+                    case 10:
+                    case 20:
+                    case 30:
+                    case 800:
+                        words.defines |= StateMotion;
+                        break;
+                    case 40:
+                    case 400:
+                    case 610:
+                    case 640:
+                    case 911:
+                        break;
+                    case 170:
+                    case 180:
+                    case 190:
+                        words.defines |= StatePlane;
+                        break;
+                    case 200:
+                    case 210:
+                        words.defines |= StateUnits;
+                        break;
+                    case 280:
+                    case 300:
+                        words.go_home = true;
+                        break;
+                    case 431:
+                    case 490:
+                        words.defines |= StateToolLength;
+                        break;
+                    case 530:
+                        words.machine_coords = true;
+                        break;
+                    case 540:
+                    case 550:
+                    case 560:
+                    case 570:
+                    case 580:
+                    case 590:
+                        words.defines |= StateCoordSystem;
+                        break;
+                    case 900:
+                    case 910:
+                        words.defines |= StateDistance;
+                        break;
+                    case 920:
+                        words.set_offset = true;
+                        break;
+                    case 921:
+                        words.defines |= StateCoordOffset;
+                        break;
+                    case 930:
+                    case 940:
+                        words.defines |= StateFeedMode;
+                        break;
+                    default:
+                        words.safe = false;  // G10, G28.1, G38.x and the like
+                        break;
+                }
+                if (code > 30) {
+                    words.motion_only = false;
+                }
+                break;
+            case 'M':
+                switch (code) {
+                    case 0:
+                    case 10:
+                    case 70:
+                    case 80:
+                        break;
+                    case 30:
+                    case 40:
+                    case 50:
+                        words.defines |= StateSpindle;
+                        break;
+                    case 90:
+                        words.defines |= StateCoolant;
+                        break;
+                    default:
+                        words.safe = false;  // M2, M30, M6, M62 and the like
+                        break;
+                }
+                words.motion_only = false;
+                break;
+            case 'F':
+                words.defines |= StateFeedRate;
+                break;
+            case 'S':
+                words.defines |= StateSpindleSpeed;
+                words.motion_only = false;
+                break;
+            case 'P':
+            case 'T':
+                words.motion_only = false;
+                break;
+            case 'N':
+            case 'I':
+            case 'J':
+            case 'K':
+            case 'R':
+                break;
+            case 'X':
+                words.axes |= bit(X_AXIS);
+                break;
+            case 'Y':
+                words.axes |= bit(Y_AXIS);
+                break;
+            case 'Z':
+                words.axes |= bit(Z_AXIS);
+                break;
+            case 'A':
+                words.axes |= bit(A_AXIS);
+                break;
+            case 'B':
+                words.axes |= bit(B_AXIS);
+                break;
+            case 'C':
+                words.axes |= bit(C_AXIS);
+                break;
+            default:
+                words.safe = false;
+                break;
+        }
+    }
+    return words;
+}
+
+Error sd_compile_file(fs::FS& fs, const char* path, uint8_t client) {
+    String out_path = compiled_path(path);
+    if (out_path == path) {
+        grbl_sendf(client, "[MSG:%s is already compiled]\r\n", path);
+        return Error::InvalidValue;
+    }
+    line_reader_t reader = {};
+    reader.file          = fs.open(path);
+    reader.hash          = FnvOffsetBasis;
+    if (!reader.file) {
+        return Error::FsFailedOpenFile;
+    }
+    File out = fs.open(out_path.c_str(), FILE_WRITE);
+    if (!out) {
+        reader.file.close();
+        return Error::FsFailedOpenFile;
+    }
+    set_sd_state(SDState::BusyParsing);
+
+    compiled_header_t header = {};
+    memcpy(header.magic, CompiledJobMagic, sizeof(header.magic));
+    header.record_size = sizeof(compiled_motion_t);
+    header.source_size = reader.file.size();
+    out.write((uint8_t*)&header, sizeof(header));
+
+    // The parser state at the start, which is restored at the end
+    parser_state_t start_state = gc_state;
+    State          start_sys   = sys.state;
+    sys.state                  = State::CheckMode;
+
+    uint8_t           all_axes  = bit(number_axis->get()) - 1;
+    uint8_t           known     = 0;  // Axes whose position does not depend on the start position
+    uint16_t          defined   = 0;  // StateDependency bits set by the file so far
+    uint32_t          hash      = FnvOffsetBasis;
+    uint32_t          size      = 0;
+    uint32_t          line_no   = 0;
+    bool              compiling = true;
+    Error             status    = Error::Ok;
+    char              line[CompileLineSize];
+    char              parse_line[CompileLineSize];
+    compiled_motion_t motion;
+    int               len;
+
+    while ((len = read_line(&reader, line, CompileLineSize)) >= 0) {
+        line_no++;
+        bool         comment = strip_line(line, parse_line);
+        line_words_t words   = scan_words(parse_line);
+        // A G92 on an axis with an unknown position sets an offset that depends on the start position
+        if (!words.safe || (words.set_offset && (words.axes & ~known))) {
+            compiling = false;
+        }
+        bool record = false;
+        if (compiling && parse_line[0] != '\0') {
+            memset(&motion, 0, sizeof(motion));
+            motion.motion     = Motion::None;
+            gc_motion_capture = &motion;
+            status            = gc_execute_line(parse_line, client);
+            gc_motion_capture = NULL;
+            if (sys.abort) {
+                status = sys.soft_limit ? Error::SoftLimitError : Error::IdleError;
+                break;
+            }
+            if (status == Error::GcodeUnsupportedCommand) {
+                // The job tolerates these, so leave it to report them
+                status = Error::Ok;
+            } else if (status != Error::Ok) {
+                break;
+            } else {
+                uint8_t absolute = words.axes;
+                if (!words.machine_coords && gc_state.modal.distance != Distance::Absolute) {
+                    absolute = 0;
+                }
+                if ((absolute & ~known) && !words.machine_coords && !(defined & StateDistance)) {
+                    header.state_mask |= StateDistance;
+                }
+                // An arc's center offset and radius check come from the start position, so its record
+                // would be wrong when that position is unknown, even if the target is absolute.
+                uint8_t fixed = (motion.motion == Motion::CwArc || motion.motion == Motion::CcwArc) ? known : (known | absolute);
+                if (words.motion_only && motion.motion != Motion::None && !comment && (fixed & all_axes) == all_axes) {
+                    header.state_mask |= StateAll & ~defined;
+                    record = true;
+                }
+                if (words.go_home) {
+                    known = all_axes;
+                } else if (!words.set_offset) {
+                    known |= absolute;
+                }
+                defined |= words.defines;
+            }
+        }
+        if (record) {
+            out.write(&MotionRecord, 1);
+            out.write((uint8_t*)&motion, sizeof(motion));
+            hash = fnv1a(hash, &MotionRecord, 1);
+            hash = fnv1a(hash, &motion, sizeof(motion));
+            size += 1 + sizeof(motion);
+        } else {
+            // A line can not start with the record marker; whitespace is ignored by the parser
+            if (line[0] == MotionRecord) {
+                line[0] = ' ';
+            }
+            line[len++] = '\n';
+            out.write((uint8_t*)line, len);
+            hash = fnv1a(hash, line, len);
+            size += len;
+        }
+    }
+    if (len == -2) {
+        status = Error::LineLengthExceeded;
+    }
+    reader.file.close();
+    if (!sys.abort) {
+        gc_state  = start_state;
+        sys.state = start_sys;
+    }
+
+    if (status == Error::Ok) {
+        header.state_hash   = state_hash(&start_state, header.state_mask);
+        header.source_hash  = reader.hash;
+        header.payload_size = size;
+        header.payload_hash = hash;
+        out.seek(0);
+        out.write((uint8_t*)&header, sizeof(header));
+        if (out.size() != sizeof(header) + size) {
+            status = Error::FsFailedRead;
+        }
+    }
+    out.close();
+    if (status == Error::Ok) {
+        grbl_sendf(client, "[MSG:Compiled %s to %s]\r\n", path, out_path.c_str());
+    } else {
+        grbl_sendf(client, "[MSG:Compiling %s failed at line %d]\r\n", path, line_no);
+        fs.remove(out_path.c_str());
+    }
+    set_sd_state(SDState::Idle);
+    return status;
+}
+
+bool sd_open_compiled(fs::FS& fs, const char* path) {
+    String out_path = compiled_path(path);
+    if (out_path == path) {
+        return false;
+    }
+    File job = fs.open(out_path.c_str());
+    if (!job) {
+        return false;  // Not compiled
+    }
+    const char*       stale  = NULL;
+    compiled_header_t header = {};
+    uint32_t          hash;
+    if (job.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        memcmp(header.magic, CompiledJobMagic, sizeof(header.magic)) != 0 || header.record_size != sizeof(compiled_motion_t)) {
+        stale = "it is from another build";
+    } else if (file_hash(job, &hash) != header.payload_size || hash != header.payload_hash) {
+        stale = "its checksum is wrong";
+    } else if (header.state_hash != state_hash(&gc_state, header.state_mask)) {
+        stale = "the parser state has changed";
+    } else {
+        File source = fs.open(path);
+        if (!source || source.size() != header.source_size || file_hash(source, &hash) != header.source_size ||
+            hash != header.source_hash) {
+            stale = "the source has changed";
+        }
+        source.close();
+    }
+    job.close();
+    if (stale) {
+        grbl_msg_sendf(CLIENT_ALL, MsgLevel::Info, "Not using %s, %s", out_path.c_str(), stale);
+        return false;
+    }
+    if (!openFile(fs, out_path.c_str())) {
+        return false;
+    }
+    if (!readFileBytes((uint8_t*)&header, sizeof(header))) {
+        closeFile();
+        return false;
+    }
+    SD_compiled_job = true;
+    return true;
+}
+
+static void execute_motion(compiled_motion_t* motion) {
+    // Leave the parser state as gc_execute_line() would for the text of the line
+    gc_state.modal.motion = motion->motion;
+    gc_state.feed_rate    = motion->pl_data.feed_rate;
+    gc_state.line_number  = motion->line_number;
+    plan_line_data_t pl_data;
+    memcpy(&pl_data, &motion->pl_data, sizeof(pl_data));  // mc_arc() changes it
+    if (motion->motion == Motion::CwArc || motion->motion == Motion::CcwArc) {
+        mc_arc(motion->target,
+               &pl_data,
+               gc_state.position,
+               motion->offset,
+               motion->radius,
+               motion->axis_0,
+               motion->axis_1,
+               motion->axis_linear,
+               motion->motion == Motion::CwArc);
+    } else {
+        limitsCheckSoft(motion->target);
+        mc_cartesian_line(motion->target, &pl_data, gc_state.position);
+    }
+    memcpy(gc_state.position, motion->target, sizeof(motion->target));
+}
+
+void sd_run_compiled_motions() {
+    if (!SD_compiled_job) {
+        return;
+    }
+    compiled_motion_t motion;
+    while (peekFile() == MotionRecord) {
+        uint8_t marker;
+        if (!readFileBytes(&marker, 1) || !readFileBytes((uint8_t*)&motion, sizeof(motion))) {
+            return;  // Truncated; readFileLine() ends the job
+        }
+        sd_current_line_number += 1;
+        // Refuse motion the way execute_line() does
+        if (sys.state == State::Alarm || sys.state == State::Jog) {
+            report_status_message(Error::SystemGcLock, SD_client);
+            return;
+        }
+        execute_motion(&motion);
+        protocol_execute_realtime();  // Runtime command check point.
+        if (sys.abort || !SD_compiled_job) {
+            return;
+        }
+    }
+}
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+  SDCompile.h - Pre-parsed SD card jobs
+  Part of Grbl_ESP32
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Grbl.h"
+#include <FS.h>
+
+// A compiled job holds the lines of a g-code file in one of two forms. Lines that only move the
+// machine are stored as binary motion records, already resolved by the parser, and are sent to
+// motion control without being parsed again. All other lines are stored as text and run through
+// the parser as usual.
+
+// The motion of a G0, G1, G2 or G3 block, as the parser hands it to motion control. The target
+// is in absolute machine coordinates in mm.
+typedef struct {
+    float            target[MAX_N_AXIS];
+    float            offset[3];  // Arc center offset from the start point
+    float            radius;     // Arc radius
+    plan_line_data_t pl_data;
+    int32_t          line_number;
+    Motion           motion;
+    uint8_t          axis_0;  // Arc plane axes
+    uint8_t          axis_1;
+    uint8_t          axis_linear;
+} compiled_motion_t;
+
+// When set, gc_execute_line() stores the motion of the block here.
+extern compiled_motion_t* gc_motion_capture;
+
+// Compiles path into a file of the same name with the extension .gcb
+Error sd_compile_file(fs::FS& fs, const char* path, uint8_t client);
+
+// Opens the compiled version of path as the SD job, if it is up to date for the source file
+// and the current parser state. Returns false, leaving the job to run as text, if not.
+bool sd_open_compiled(fs::FS& fs, const char* path);
+
+// Executes the motion records at the current position of a compiled job, up to the next text line.
+void sd_run_compiled_motions();
@@ -48,14 +48,15 @@
 
   To allow the realtime commands to be randomly mixed in the stream of data, we
   read all clients as fast as possible. The realtime commands are acted upon and the other charcters are
-  placed into a client_buffer[client].
+  framed into lines. Complete lines are queued in client_rx[client].
 
-  The main protocol loop reads from client_buffer[]
+  The main protocol loop takes whole lines from client_rx[] with client_read_line()
 
 
 */
 
 #include "Grbl.h"
+#include <atomic>
 
 // Define this to use the Arduino serial (UART) driver instead
 // of the one in Uart.cpp, which uses the ESP-IDF UART driver.
@@ -63,20 +64,143 @@
 // testing is complete.
 // #define REVERT_TO_ARDUINO_SERIAL
 
-portMUX_TYPE myMutex = portMUX_INITIALIZER_UNLOCKED;
-
 static TaskHandle_t clientCheckTaskHandle = 0;
 
-WebUI::InputBuffer client_buffer[CLIENT_COUNT];  // create a buffer for each client
+// The lines received from a client. clientCheckTask() frames the characters into line[] and
+// queues each complete line in the ring, NUL-terminated, for the protocol loop. There is one
+// writer and one reader, so neither needs a lock: the writer only advances head and the reader
+// only advances tail. Both are running byte counts; the ring index is the count modulo
+// RX_BUFFER_SIZE. A line that does not fit in line[] is queued as the single byte LineOverflow.
+static_assert((RX_BUFFER_SIZE & (RX_BUFFER_SIZE - 1)) == 0, "RX_BUFFER_SIZE must be a power of two");
+typedef struct {
+    char              ring[RX_BUFFER_SIZE];
+    volatile uint32_t head;         // Bytes queued by clientCheckTask()
+    volatile uint32_t tail;         // Bytes taken by client_read_line()
+    volatile uint32_t resets;       // Requests from client_reset_read_buffer() to drop line[]
+    uint32_t          resets_done;  // The requests clientCheckTask() has acted upon
+    char              line[LINE_BUFFER_SIZE];  // The line being received
+    int               len;
+} client_rx_t;
+static client_rx_t client_rx[CLIENT_COUNT];
+
+const char LineOverflow = char(0x80);  // Never received as part of a line; 0x80 and up are realtime commands
+
+// Bytes of the client's receive buffer in use, queued or in the line being received
+static int client_rx_used(client_rx_t* rx) {
+    return rx->head - rx->tail + rx->len;
+}
+
+// Queues len bytes at the head of the ring. The caller has checked that they fit.
+static void client_rx_queue(client_rx_t* rx, const char* data, int len) {
+    uint32_t head = rx->head;
+    for (int i = 0; i < len; i++) {
+        rx->ring[(head + i) % RX_BUFFER_SIZE] = data[i];
+    }
+    // The bytes must be in the ring before the reader sees the new head
+    std::atomic_thread_fence(std::memory_order_release);
+    rx->head = head + len;
+}
 
-// Returns the number of bytes available in a client buffer.
-uint8_t client_get_rx_buffer_available(uint8_t client) {
+// Frames a character received from a client, other than a realtime command, into lines.
+// Called by clientCheckTask() only, when the receive buffer has room for one more byte.
+void client_receive_char(uint8_t client, uint8_t data) {
+    client_rx_t* rx = &client_rx[client];
+    if (rx->resets_done != rx->resets) {
+        rx->resets_done = rx->resets;
+        rx->len         = 0;
+    }
+    // Simple editing for interactive input
+    if (data == '\b') {
+        // Backspace erases
+        if (rx->len) {
+            --rx->len;
+        }
+        return;
+    }
+    if (data == '\0') {
+        return;  // Would end the line early
+    }
+    if (rx->len == (LINE_BUFFER_SIZE - 1)) {
+        client_rx_queue(rx, &LineOverflow, 1);
+        rx->len = 0;
+        return;
+    }
+    if (data == '\r' || data == '\n') {
+        rx->line[rx->len] = '\0';
+        client_rx_queue(rx, rx->line, rx->len + 1);
+        rx->len = 0;
+        return;
+    }
+    rx->line[rx->len++] = data;
+}
+
+// Copies the next line received from the client to line. Returns Error::Eol if there was one,
+// Error::Overflow if the next line was too long and has been dropped, and Error::Ok if no
+// complete line has been received. Called by the protocol loop only.
+Error client_read_line(uint8_t client, char* line) {
+    client_rx_t* rx   = &client_rx[client];
+    uint32_t     tail = rx->tail;
+    if (tail == rx->head) {
+        return Error::Ok;
+    }
+    // Read the bytes only after seeing the head that covers them
+    std::atomic_thread_fence(std::memory_order_acquire);
+    Error result = Error::Eol;
+    if (rx->ring[tail % RX_BUFFER_SIZE] == LineOverflow) {
+        tail++;
+        result = Error::Overflow;
+    } else {
+        char c;
+        while ((c = rx->ring[tail++ % RX_BUFFER_SIZE]) != '\0') {
+            *line++ = c;
+        }
+        *line = '\0';
+    }
+    // Finish reading before clientCheckTask() may reuse the space
+    std::atomic_thread_fence(std::memory_order_release);
+    rx->tail = tail;
+    return result;
+}
+
+// Returns the number of bytes the client can send before its receive buffer is full. Bytes
+// that its port has received, but clientCheckTask() has not yet moved to the buffer, count
+// as used, so a sender that counts characters never has more than RX_BUFFER_SIZE in flight.
+int client_get_rx_buffer_available(uint8_t client) {
+    if (client >= CLIENT_COUNT) {
+        client = CLIENT_SERIAL;  // Reports to all clients give the serial port's
+    }
+    int pending = 0;
+    switch (client) {
+        case CLIENT_SERIAL:
 #ifdef REVERT_TO_ARDUINO_SERIAL
-    return 128 - Serial.available();
+            pending = Serial.available();
 #else
-    return 128 - Uart0.available();
+            pending = Uart0.available();
+#endif
+            break;
+#ifdef ENABLE_BLUETOOTH
+        case CLIENT_BT:
+            pending = WebUI::SerialBT.hasClient() ? WebUI::SerialBT.available() : 0;
+            break;
+#endif
+#if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_IN)
+        case CLIENT_WEBUI:
+            pending = WebUI::Serial2Socket.available();
+            break;
 #endif
-    //    return client_buffer[client].availableforwrite();
+#if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
+        case CLIENT_TELNET:
+            pending = WebUI::telnet_server.available();
+            break;
+#endif
+        case CLIENT_INPUT:
+            pending = WebUI::inputBuffer.available();
+            break;
+        default:
+            break;
+    }
+    int available = RX_BUFFER_SIZE - client_rx_used(&client_rx[client]) - pending;
+    return available > 0 ? available : 0;
 }
 
 void heapCheckTask(void* pvParameters) {
@@ -108,6 +232,7 @@ void client_init() {
     Serial.write("\r\n");  // create some white space after ESP32 boot info
 #else
     Uart0.setPins(1, 3);  // Tx 1, Rx 3 - standard hardware pins
+    Uart0.enableRxEvents();
     Uart0.begin(BAUD_RATE, Uart::Data::Bits8, Uart::Stop::Bits1, Uart::Parity::None);
 
     client_reset_read_buffer(CLIENT_ALL);
@@ -131,20 +256,20 @@ void client_init() {
 static uint8_t getClientChar(uint8_t* data) {
     int res;
 #ifdef REVERT_TO_ARDUINO_SERIAL
-    if (client_buffer[CLIENT_SERIAL].availableforwrite() && (res = Serial.read()) != -1) {
+    if (client_rx_used(&client_rx[CLIENT_SERIAL]) < RX_BUFFER_SIZE && (res = Serial.read()) != -1) {
 #else
-    if (client_buffer[CLIENT_SERIAL].availableforwrite() && (res = Uart0.read()) != -1) {
+    if (client_rx_used(&client_rx[CLIENT_SERIAL]) < RX_BUFFER_SIZE && (res = Uart0.read()) != -1) {
 #endif
         *data = res;
         return CLIENT_SERIAL;
     }
-    if (WebUI::inputBuffer.available()) {
+    if (client_rx_used(&client_rx[CLIENT_INPUT]) < RX_BUFFER_SIZE && WebUI::inputBuffer.available()) {
         *data = WebUI::inputBuffer.read();
         return CLIENT_INPUT;
     }
     //currently is wifi or BT but better to prepare both can be live
 #ifdef ENABLE_BLUETOOTH
-    if (WebUI::SerialBT.hasClient()) {
+    if (client_rx_used(&client_rx[CLIENT_BT]) < RX_BUFFER_SIZE && WebUI::SerialBT.hasClient()) {
         if ((res = WebUI::SerialBT.read()) != -1) {
             *data = res;
             return CLIENT_BT;
@@ -152,13 +277,13 @@ static uint8_t getClientChar(uint8_t* data) {
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_IN)
-    if (WebUI::Serial2Socket.available()) {
+    if (client_rx_used(&client_rx[CLIENT_WEBUI]) < RX_BUFFER_SIZE && WebUI::Serial2Socket.available()) {
         *data = WebUI::Serial2Socket.read();
         return CLIENT_WEBUI;
     }
 #endif
 #if defined(ENABLE_WIFI) && defined(ENABLE_TELNET)
-    if (WebUI::telnet_server.available()) {
+    if (client_rx_used(&client_rx[CLIENT_TELNET]) < RX_BUFFER_SIZE && WebUI::telnet_server.available()) {
         *data = WebUI::telnet_server.read();
         return CLIENT_TELNET;
     }
@@ -166,6 +291,30 @@ static uint8_t getClientChar(uint8_t* data) {
     return CLIENT_ALL;
 }
 
+// Sleeps until the serial port receives data. Bluetooth, telnet and the web servers have to be
+// polled, so while a radio is on the wait ends after a tick, as it always did. Otherwise the
+// serial port wakes the task, within a character time of a realtime command, and the task only
+// wakes on its own every CLIENT_IDLE_POLL_MS for its housekeeping.
+static void client_wait_for_input() {
+    TickType_t timeout = CLIENT_IDLE_POLL_MS / portTICK_RATE_MS;
+#ifdef WIFI_OR_BLUETOOTH
+    if (WebUI::wifi_radio_mode->get() != ESP_RADIO_OFF) {
+        timeout = 1;
+    }
+#endif
+#ifdef REVERT_TO_ARDUINO_SERIAL
+    vTaskDelay(1 / portTICK_RATE_MS);  // Yield to other tasks
+#else
+    if (client_rx_used(&client_rx[CLIENT_SERIAL]) >= RX_BUFFER_SIZE) {
+        // getClientChar() leaves the port's bytes alone while its line buffer is full, so the port
+        // would wake us again at once. Poll until the protocol has taken a line.
+        vTaskDelay(1);
+        return;
+    }
+    Uart0.waitForRx(timeout);
+#endif
+}
+
 // this task runs and checks for data on all interfaces
 // REaltime stuff is acted upon, then characters are added to the appropriate buffer
 void clientCheckTask(void* pvParameters) {
@@ -182,9 +331,7 @@ void clientCheckTask(void* pvParameters) {
 #if defined(ENABLE_SD_CARD)
                 if (get_sd_state(false) < SDState::Busy) {
 #endif  //ENABLE_SD_CARD
-                    vTaskEnterCritical(&myMutex);
-                    client_buffer[client].write(data);
-                    vTaskExitCritical(&myMutex);
+                    client_receive_char(client, data);
 #if defined(ENABLE_SD_CARD)
                 } else {
                     if (data == '\r' || data == '\n') {
@@ -205,7 +352,7 @@ void clientCheckTask(void* pvParameters) {
 #if defined(ENABLE_WIFI) && defined(ENABLE_HTTP) && defined(ENABLE_SERIAL2SOCKET_IN)
         WebUI::Serial2Socket.handle_flush();
 #endif
-        vTaskDelay(1 / portTICK_RATE_MS);  // Yield to other tasks
+        client_wait_for_input();
 
         static UBaseType_t uxHighWaterMark = 0;
 #ifdef DEBUG_TASK_STACK
@@ -214,22 +361,18 @@ void clientCheckTask(void* pvParameters) {
     }
 }
 
+// Drops the lines received from the client. Called by the protocol loop, so it only empties the
+// queue; clientCheckTask() drops the line it is receiving before it adds the next character.
 void client_reset_read_buffer(uint8_t client) {
     for (uint8_t client_num = 0; client_num < CLIENT_COUNT; client_num++) {
         if (client == client_num || client == CLIENT_ALL) {
-            client_buffer[client_num].begin();
+            client_rx_t* rx = &client_rx[client_num];
+            rx->tail        = rx->head;
+            rx->resets++;
         }
     }
 }
 
-// Fetches the first byte in the client read buffer. Called by protocol loop.
-int client_read(uint8_t client) {
-    vTaskEnterCritical(&myMutex);
-    int data = client_buffer[client].read();
-    vTaskExitCritical(&myMutex);
-    return data;
-}
-
 // checks to see if a character is a realtime character
 bool is_realtime_command(uint8_t data) {
     if (data >= 0x80) {
@@ -22,9 +22,6 @@
 
 #include "stdint.h"
 
-#ifndef RX_BUFFER_SIZE
-#    define RX_BUFFER_SIZE 256
-#endif
 #ifndef TX_BUFFER_SIZE
 #    ifdef USE_LINE_NUMBERS
 #        define TX_BUFFER_SIZE 112
@@ -38,8 +35,11 @@ void clientCheckTask(void* pvParameters);
 
 void client_write(uint8_t client, const char* text);
 
-// Fetches the first byte in the serial read buffer. Called by main program.
-int client_read(uint8_t client);
+// Frames a received character into lines. Called by clientCheckTask().
+void client_receive_char(uint8_t client, uint8_t data);
+
+// Fetches the next complete line the client has sent. Called by main program.
+Error client_read_line(uint8_t client, char* line);
 
 // See if the character is an action command like feedhold or jogging. If so, do the action and return true
 uint8_t check_action_command(uint8_t data);
@@ -47,8 +47,8 @@ uint8_t check_action_command(uint8_t data);
 void client_init();
 void client_reset_read_buffer(uint8_t client);
 
-// Returns the number of bytes available in the RX serial buffer.
-uint8_t client_get_rx_buffer_available(uint8_t client);
+// Returns the number of bytes the client can send before its receive buffer is full.
+int client_get_rx_buffer_available(uint8_t client);
 
 void execute_realtime_command(Cmd command, uint8_t client);
 bool is_realtime_command(uint8_t data);
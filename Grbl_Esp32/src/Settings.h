@@ -435,6 +435,9 @@ public:
     FloatSetting* steps_per_mm;
     FloatSetting* max_rate;
     FloatSetting* acceleration;
+#ifdef S_CURVE_ACCELERATION
+    FloatSetting* jerk;
+#endif
     FloatSetting* max_travel;
     FloatSetting* run_current;
     FloatSetting* hold_current;
@@ -55,10 +55,11 @@ extern FlagSetting*  spindle_enbl_off_with_zero_speed;
 extern FlagSetting*  spindle_enable_invert;
 extern FlagSetting*  spindle_output_invert;
 
-extern FloatSetting* spindle_pwm_off_value;
-extern FloatSetting* spindle_pwm_min_value;
-extern FloatSetting* spindle_pwm_max_value;
-extern IntSetting*   spindle_pwm_bit_precision;
+extern FloatSetting*  spindle_pwm_off_value;
+extern FloatSetting*  spindle_pwm_min_value;
+extern FloatSetting*  spindle_pwm_max_value;
+extern IntSetting*    spindle_pwm_bit_precision;
+extern StringSetting* spindle_pwm_curve;
 
 extern EnumSetting* spindle_type;
 
@@ -97,11 +97,7 @@ namespace Spindles {
         sys.spindle_speed = rpm;
 
         // determine the pwm value
-        if (rpm == 0) {
-            pwm_value = _pwm_off_value;
-        } else {
-            pwm_value = map_uint32_t(rpm, _min_rpm, _max_rpm, _pwm_min_value, _pwm_max_value);
-        }
+        pwm_value = rpm_to_duty(rpm);
 
         set_output(pwm_value);
         return rpm;
@@ -84,8 +84,34 @@ namespace Spindles {
         _piecewide_linear = false;
 
         _pwm_chan_num = 0;  // Channel 0 is reserved for spindle use
+
+        _curve.compile(spindle_pwm_curve->get(), _min_rpm, _max_rpm, _pwm_period);
+
+#ifdef LASER_POWER_PER_STEP
+        _power_ovr = 0;  // Refill the power levels for the new settings
+#endif
+    }
+
+#ifdef LASER_POWER_PER_STEP
+    uint32_t Laser::power_levels() {
+        if (_output_pin == UNDEFINED_PIN || _max_rpm == 0) {
+            return 0;
+        }
+        if (_power_ovr != sys.spindle_speed_ovr) {
+            _power_ovr = sys.spindle_speed_ovr;
+            for (uint32_t level = 0; level < LASER_POWER_LEVELS; level++) {
+                _power_duty[level] = rpm_to_duty(limit_rpm(_max_rpm * level / (LASER_POWER_LEVELS - 1)));
+            }
+        }
+        return _max_rpm;
     }
 
+    // Called from the stepper ISR, so it only writes the precomputed output
+    void Laser::set_power_level(uint32_t level) {
+        set_output(_power_duty[level]);
+    }
+#endif
+
     void Laser::deinit() {
         stop();
 #ifdef LASER_OUTPUT_PIN
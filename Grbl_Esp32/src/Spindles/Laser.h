@@ -39,6 +39,17 @@ namespace Spindles {
         void get_pins_and_settings() override;
         void deinit() override;
 
+#ifdef LASER_POWER_PER_STEP
+        uint32_t power_levels() override;
+        void     set_power_level(uint32_t level) override;
+#endif
+
         virtual ~Laser() {}
+
+#ifdef LASER_POWER_PER_STEP
+    private:
+        uint32_t _power_duty[LASER_POWER_LEVELS];  // PWM output of each power level
+        uint8_t  _power_ovr;                       // Spindle override _power_duty is for, 0 when not filled
+#endif
     };
 }
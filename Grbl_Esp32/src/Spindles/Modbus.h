@@ -0,0 +1,34 @@
+#pragma once
+
+/*
+    Modbus.h
+
+    The Modbus RTU framing used by the VFD spindles.
+
+    Part of Grbl_ESP32
+
+    Grbl is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Grbl is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "../Grbl.h"
+
+namespace Spindles {
+    namespace Modbus {
+        // The CRC16 of the first msg_len bytes of buf. It is sent low byte first after the message.
+        uint16_t crc16(const uint8_t* buf, int msg_len);
+
+        // Reads a response of at most length bytes from uart. Waits up to timeout ticks for it to start,
+        // and ends it at a silence of gap ticks, the way Modbus RTU delimits frames, so a short answer
+        // such as an exception response doesn't hold the line for the whole timeout. Returns the bytes
+        // read.
+        uint16_t read_frame(Uart& uart, uint8_t* buffer, uint16_t length, TickType_t timeout, TickType_t gap);
+    }
+}
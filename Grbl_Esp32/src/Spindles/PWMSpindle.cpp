@@ -117,6 +117,8 @@ namespace Spindles {
 
         _spinup_delay   = spindle_delay_spinup->get() * 1000.0;
         _spindown_delay = spindle_delay_spindown->get() * 1000.0;
+
+        _curve.compile(spindle_pwm_curve->get(), _min_rpm, _max_rpm, _pwm_period);
     }
 
     uint32_t PWM::set_rpm(uint32_t rpm) {
@@ -126,15 +128,7 @@ namespace Spindles {
             return rpm;
         }
 
-        // apply override
-        rpm = rpm * sys.spindle_speed_ovr / 100;  // Scale by spindle speed override value (uint8_t percent)
-
-        // apply limits
-        if ((_min_rpm >= _max_rpm) || (rpm >= _max_rpm)) {
-            rpm = _max_rpm;
-        } else if (rpm != 0 && rpm <= _min_rpm) {
-            rpm = _min_rpm;
-        }
+        rpm = limit_rpm(rpm);
 
         sys.spindle_speed = rpm;
 
@@ -144,11 +138,7 @@ namespace Spindles {
             grbl_msg_sendf(CLIENT_ALL, MsgLevel::Info, "Warning: Linear fit not implemented yet.");
 
         } else {
-            if (rpm == 0) {
-                pwm_value = _pwm_off_value;
-            } else {
-                pwm_value = map_uint32_t(rpm, _min_rpm, _max_rpm, _pwm_min_value, _pwm_max_value);
-            }
+            pwm_value = rpm_to_duty(rpm);
         }
 
         set_enable_pin(gc_state.modal.spindle != SpindleState::Disable);
@@ -157,6 +147,31 @@ namespace Spindles {
         return 0;
     }
 
+    // Applies the spindle speed override and the rpm limits
+    uint32_t PWM::limit_rpm(uint32_t rpm) {
+        // apply override
+        rpm = rpm * sys.spindle_speed_ovr / 100;  // Scale by spindle speed override value (uint8_t percent)
+
+        // apply limits
+        if ((_min_rpm >= _max_rpm) || (rpm >= _max_rpm)) {
+            rpm = _max_rpm;
+        } else if (rpm != 0 && rpm <= _min_rpm) {
+            rpm = _min_rpm;
+        }
+        return rpm;
+    }
+
+    // The PWM output for an rpm within the limits, from the curve if there is one
+    uint32_t PWM::rpm_to_duty(uint32_t rpm) {
+        if (rpm == 0) {
+            return _pwm_off_value;
+        }
+        if (_curve.active()) {
+            return _curve.duty(rpm);
+        }
+        return map_uint32_t(rpm, _min_rpm, _max_rpm, _pwm_min_value, _pwm_max_value);
+    }
+
     void PWM::set_state(SpindleState state, uint32_t rpm) {
         if (sys.abort) {
             return;  // Block during abort.
@@ -166,14 +181,14 @@ namespace Spindles {
             sys.spindle_speed = 0;
             stop();
             if (use_delays && (_current_state != state)) {
-                delay(_spindown_delay);
+                spin_delay(_spindown_delay);
             }
         } else {
             set_dir_pin(state == SpindleState::Cw);
             set_rpm(rpm);
             set_enable_pin(state != SpindleState::Disable);  // must be done after setting rpm for enable features to work
             if (use_delays && (_current_state != state)) {
-                delay(_spinup_delay);
+                spin_delay(_spinup_delay);
             }
         }
 
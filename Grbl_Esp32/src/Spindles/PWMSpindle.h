@@ -22,6 +22,7 @@
 
 */
 #include "Spindle.h"
+#include "SpindleCurve.h"
 
 namespace Spindles {
     // This adds support for PWM
@@ -60,6 +61,7 @@ namespace Spindles {
         bool     _piecewide_linear;
         bool     _off_with_zero_speed;
         bool     _invert_pwm;
+        Curve    _curve;  // $Spindle/PWM/Curve, replaces the linear output when set
         //uint32_t _pwm_gradient; // Precalulated value to speed up rpm to PWM conversions.
 
         virtual void set_dir_pin(bool Clockwise);
@@ -69,5 +71,7 @@ namespace Spindles {
 
         virtual void get_pins_and_settings();
         uint8_t      calc_pwm_precision(uint32_t freq);
+        uint32_t     limit_rpm(uint32_t rpm);
+        uint32_t     rpm_to_duty(uint32_t rpm);
     };
 }
@@ -104,6 +104,12 @@ namespace Spindles {
         return false;  // default for basic spindle is false
     }
 
+    uint32_t Spindle::power_levels() {
+        return 0;  // the power is only set by set_rpm()
+    }
+
+    void Spindle::set_power_level(uint32_t level) {}
+
     void Spindle::sync(SpindleState state, uint32_t rpm) {
         if (sys.state == State::CheckMode) {
             return;
@@ -113,6 +119,15 @@ namespace Spindles {
     }
 
     void Spindle::deinit() { stop(); }
+
+    bool Spindle::at_speed() {
+        return millis() - _spin_start >= _spin_time;
+    }
+
+    void Spindle::spin_delay(uint32_t milliseconds) {
+        _spin_start = millis();
+        _spin_time  = milliseconds;
+    }
 }
 
 Spindles::Spindle* spindle;
@@ -70,6 +70,18 @@ namespace Spindles {
         virtual void         sync(SpindleState state, uint32_t rpm);
         virtual void         deinit();
 
+        // Spin-up and spin-down don't block. set_state() only starts them, and at_speed() tells when
+        // they are over. Cycle start holds the planned motions until then, and so does
+        // protocol_buffer_synchronize() for the commands that wait for the machine.
+        virtual bool at_speed();
+
+        // Laser power per step, see LASER_POWER_PER_STEP. power_levels() prepares the outputs of
+        // LASER_POWER_LEVELS levels from 0 to the maximum rpm, after the spindle override, and
+        // returns that maximum, or 0 if the spindle can't do it. It is not called from the ISR.
+        // set_power_level() writes the output of a level and is safe to call from the ISR.
+        virtual uint32_t power_levels();
+        virtual void     set_power_level(uint32_t level);
+
         virtual ~Spindle() {}
 
         bool                  is_reversable;
@@ -79,6 +91,12 @@ namespace Spindles {
         uint32_t              _spindown_delay;
 
         static void select();
+
+    protected:
+        void spin_delay(uint32_t milliseconds);  // Starts a spin-up or spin-down of fixed length
+
+        uint32_t _spin_start = 0;  // millis() at the start of the last spin-up or spin-down
+        uint32_t _spin_time  = 0;  // Its length in milliseconds
     };
 
 }
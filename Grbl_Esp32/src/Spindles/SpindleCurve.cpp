@@ -0,0 +1,110 @@
+/*
+    SpindleCurve.cpp
+
+    A calibration of the spindle output, set by $Spindle/PWM/Curve.
+
+    Part of Grbl_ESP32
+
+    Grbl is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Grbl is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "SpindleCurve.h"
+
+namespace Spindles {
+    static bool is_separator(char c) { return c == ',' || c == ' '; }
+
+    int Curve::parse(const char* text, float* rpm, float* percent) {
+        int n = 0;
+        while (true) {
+            while (is_separator(*text)) {
+                text++;
+            }
+            if (*text == '\0') {
+                break;
+            }
+            if (n == MAX_POINTS) {
+                return -1;
+            }
+            char* end;
+            rpm[n] = strtof(text, &end);
+            if (end == text || *end != ':') {
+                return -1;
+            }
+            text       = end + 1;
+            percent[n] = strtof(text, &end);
+            if (end == text || !(is_separator(*end) || *end == '\0')) {
+                return -1;
+            }
+            text = end;
+            // The rpm must increase from point to point
+            if (rpm[n] < 0 || (n > 0 && rpm[n] <= rpm[n - 1]) || percent[n] < 0 || percent[n] > 100) {
+                return -1;
+            }
+            n++;
+        }
+        return n == 1 ? -1 : n;  // A single point is not a curve
+    }
+
+    void Curve::compile(const char* text, uint32_t min_rpm, uint32_t max_rpm, uint32_t period) {
+        float rpm[MAX_POINTS];
+        float percent[MAX_POINTS];
+        int   n = parse(text, rpm, percent);
+
+        if (n <= 0 || max_rpm <= min_rpm) {
+            delete[] _table;
+            _table = nullptr;
+            return;
+        }
+
+        if (_table == nullptr) {
+            _table = new uint32_t[SPINDLE_CURVE_SIZE];
+        }
+        _min_rpm = min_rpm;
+        _max_rpm = max_rpm;
+        // Round the step up, so the max rpm reaches the last entry
+        uint32_t range = max_rpm - min_rpm;
+        _step          = ((uint64_t(SPINDLE_CURVE_SIZE - 1) << 32) + range - 1) / range;
+
+        int point = 0;
+        for (int i = 0; i < SPINDLE_CURVE_SIZE; i++) {
+            float at = min_rpm + float(range) * i / (SPINDLE_CURVE_SIZE - 1);
+            while (point < n - 1 && rpm[point + 1] <= at) {
+                point++;
+            }
+            float value;
+            if (at <= rpm[0]) {
+                value = percent[0];
+            } else if (point == n - 1) {
+                value = percent[n - 1];
+            } else {
+                value = percent[point] + (percent[point + 1] - percent[point]) * (at - rpm[point]) / (rpm[point + 1] - rpm[point]);
+            }
+            _table[i] = uint32_t(period * value / 100.0f + 0.5f);
+        }
+    }
+
+    uint32_t Curve::duty(uint32_t rpm) const {
+        if (rpm <= _min_rpm) {
+            return _table[0];
+        }
+        if (rpm >= _max_rpm) {
+            rpm = _max_rpm;
+        }
+        uint32_t position = ((rpm - _min_rpm) * _step) >> 16;  // The table index in 16.16 fixed point
+        uint32_t index    = position >> 16;
+        if (index >= SPINDLE_CURVE_SIZE - 1) {
+            return _table[SPINDLE_CURVE_SIZE - 1];
+        }
+        int32_t from = _table[index];
+        int32_t to   = _table[index + 1];
+        return from + int32_t((int64_t(to - from) * (position & 0xFFFF) + 0x8000) >> 16);
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+    SpindleCurve.h
+
+    A calibration of the spindle output, set by $Spindle/PWM/Curve.
+
+    Part of Grbl_ESP32
+
+    Grbl is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    Grbl is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    You should have received a copy of the GNU General Public License
+    along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "../Grbl.h"
+
+namespace Spindles {
+    // The output duty as a function of the rpm, given by points like "5000:18,12000:42,24000:100".
+    // Each point is an rpm and the output there in percent of the PWM period. The output follows
+    // straight lines between the points and stays level beyond the first and the last one.
+    //
+    // compile() samples the curve into a table of SPINDLE_CURVE_SIZE outputs from the min to the max
+    // rpm, so duty() only interpolates between two neighbouring entries. It is called from the
+    // stepper ISR.
+    class Curve {
+    public:
+        static const int MAX_POINTS = 16;
+
+        Curve() = default;
+
+        Curve(const Curve&) = delete;
+        Curve(Curve&&)      = delete;
+        Curve& operator=(const Curve&) = delete;
+        Curve& operator=(Curve&&) = delete;
+
+        // Reads the points of the text into rpm and percent, which hold MAX_POINTS. Returns the
+        // number of points, 0 for an empty text, or -1 if the text is not a curve.
+        static int parse(const char* text, float* rpm, float* percent);
+
+        // Builds the table for the rpm range and a PWM period. Without points, or without a
+        // range, there is no curve and active() is false.
+        void compile(const char* text, uint32_t min_rpm, uint32_t max_rpm, uint32_t period);
+
+        bool     active() const { return _table != nullptr; }
+        uint32_t duty(uint32_t rpm) const;
+
+        ~Curve() { delete[] _table; }
+
+    private:
+        uint32_t* _table = nullptr;
+        uint32_t  _min_rpm;
+        uint32_t  _max_rpm;
+        uint64_t  _step;  // Table entries per rpm, in 32.32 fixed point
+    };
+}
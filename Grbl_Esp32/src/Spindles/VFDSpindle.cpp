@@ -38,16 +38,18 @@
 
 // Timing and modbus... The manual states that between communications, we should respect a
 // silent interval of 3,5 characters. If we received communications between these times, we
-// have to assume that the message is broken. We use a poll rate of 250 ms here, which should
-// be plenty: assuming 9600 8N1, that's roughly 250 chars. A message of 2x16 chars with 4x4
-// chars buffering is just 40 chars.
-
-const int        VFD_RS485_UART_PORT  = 2;  // hard coded for this port right now
-const int        VFD_RS485_BUF_SIZE   = 127;
-const int        VFD_RS485_QUEUE_SIZE = 10;                                         // numv\ber of commands that can be queued up.
-const int        RESPONSE_WAIT_MILLIS = 1000;                                       // how long to wait for a response in milliseconds
-const int        VFD_RS485_POLL_RATE  = 250;                                        // in milliseconds between commands
-const TickType_t response_ticks       = RESPONSE_WAIT_MILLIS / portTICK_PERIOD_MS;  // in milliseconds between commands
+// have to assume that the message is broken. The same silence ends a response, so we read a
+// response until the line goes quiet instead of for a fixed time. Queued commands are sent as
+// soon as the line is free; status polls are spaced by an interval that depends on what the
+// spindle is doing, see poll_ticks().
+
+const int        VFD_RS485_UART_PORT      = 2;     // hard coded for this port right now
+const int        VFD_RS485_BUF_SIZE       = 127;
+const int        VFD_RS485_QUEUE_SIZE     = 10;    // number of commands that can be queued up.
+const int        RESPONSE_WAIT_MILLIS     = 1000;  // how long to wait for a response to start in milliseconds
+const int        VFD_RS485_POLL_RATE      = 250;   // in milliseconds between polls while the spindle runs
+const int        VFD_RS485_IDLE_POLL_RATE = 1000;  // in milliseconds between polls while the spindle is off
+const TickType_t response_ticks           = RESPONSE_WAIT_MILLIS / portTICK_PERIOD_MS;
 
 // OK to change these
 // #define them in your machine definition file if you want different values
@@ -111,61 +113,65 @@ namespace Spindles {
         while (true) {
             response_parser parser = nullptr;
 
-            next_cmd.msg[0] = VFD_RS485_ADDR;  // Always default to this
-
-            // First check if we should ask the VFD for the max RPM value as part of the initialization. We
-            // should also query this is max_rpm is 0, because that means a previous initialization failed:
-            if ((pollidx < 0 || instance->_max_rpm == 0) && (parser = instance->initialization_sequence(pollidx, next_cmd)) != nullptr) {
-                next_cmd.critical = false;
-            } else {
-                pollidx           = 1;  // Done with initialization. Main sequence.
+            // Commands go first, so a speed or direction change never waits behind the initialization
+            // or the status polls. During idle, we can grab a parser.
+            if (xQueueReceive(vfd_cmd_queue, &next_cmd, 0) != pdTRUE) {
+                next_cmd.msg[0]   = VFD_RS485_ADDR;  // Always default to this
                 next_cmd.critical = false;
-            }
 
-            // If we don't have a parser, the queue goes first. During idle, we can grab a parser.
-            if (parser == nullptr && xQueueReceive(vfd_cmd_queue, &next_cmd, 0) != pdTRUE) {
-                // We poll in a cycle. Note that the switch will fall through unless we encounter a hit.
-                // The weakest form here is 'get_status_ok' which should be implemented if the rest fails.
-                if (instance->_syncing) {
-                    parser = instance->get_current_rpm(next_cmd);
-                } else if (safetyPollingEnabled) {
-                    switch (pollidx) {
-                        case 1:
-                            parser = instance->get_current_rpm(next_cmd);
-                            if (parser) {
-                                pollidx = 2;
-                                break;
-                            }
-                            // fall through intentionally:
-                        case 2:
-                            parser = instance->get_current_direction(next_cmd);
-                            if (parser) {
-                                pollidx = 3;
+                // First check if we should ask the VFD for the max RPM value as part of the initialization. We
+                // should also query this is max_rpm is 0, because that means a previous initialization failed:
+                if (pollidx < 0 || instance->_max_rpm == 0) {
+                    parser = instance->initialization_sequence(pollidx, next_cmd);
+                }
+                if (parser == nullptr) {
+                    if (pollidx < 0) {
+                        pollidx = 1;  // Done with initialization. Main sequence.
+                    }
+
+                    // We poll in a cycle. Note that the switch will fall through unless we encounter a hit.
+                    // The weakest form here is 'get_status_ok' which should be implemented if the rest fails.
+                    if (instance->_syncing) {
+                        parser = instance->get_current_rpm(next_cmd);
+                    } else if (safetyPollingEnabled) {
+                        switch (pollidx) {
+                            case 1:
+                                parser = instance->get_current_rpm(next_cmd);
+                                if (parser) {
+                                    pollidx = 2;
+                                    break;
+                                }
+                                // fall through intentionally:
+                            case 2:
+                                parser = instance->get_current_direction(next_cmd);
+                                if (parser) {
+                                    pollidx = 3;
+                                    break;
+                                }
+                                // fall through intentionally:
+                            case 3:
+                            default:
+                                parser  = instance->get_status_ok(next_cmd);
+                                pollidx = 1;
+
+                                // we could complete this in case parser == nullptr with some ifs, but let's
+                                // just keep it easy and wait an iteration.
                                 break;
-                            }
-                            // fall through intentionally:
-                        case 3:
-                        default:
-                            parser  = instance->get_status_ok(next_cmd);
-                            pollidx = 1;
-
-                            // we could complete this in case parser == nullptr with some ifs, but let's
-                            // just keep it easy and wait an iteration.
-                            break;
+                        }
                     }
                 }
 
                 // If we have no parser, that means get_status_ok is not implemented (and we have
-                // nothing resting in our queue). Let's fall back on a simple continue.
+                // nothing resting in our queue). Let's fall back on waiting for a command.
                 if (parser == nullptr) {
-                    vTaskDelay(VFD_RS485_POLL_RATE / portTICK_PERIOD_MS);
+                    xQueuePeek(vfd_cmd_queue, &next_cmd, VFD_RS485_POLL_RATE / portTICK_PERIOD_MS);
                     continue;  // main while loop
                 }
             }
 
             {
                 // Grabbed the command. Add the CRC16 checksum:
-                auto crc16 = ModRTU_CRC(next_cmd.msg, next_cmd.tx_length);
+                auto crc16 = Modbus::crc16(next_cmd.msg, next_cmd.tx_length);
 
                 next_cmd.tx_length += 2;
                 next_cmd.rx_length += 2;
@@ -192,9 +198,7 @@ namespace Spindles {
                 _uart.flushTxTimed(response_ticks);
 
                 // Read the response
-                uint16_t read_length  = 0;
-                uint16_t current_read = _uart.readBytes(rx_message, next_cmd.rx_length, response_ticks);
-                read_length += current_read;
+                uint16_t read_length = Modbus::read_frame(_uart, rx_message, next_cmd.rx_length, response_ticks, instance->_frame_gap);
 
                 // Apparently some Huanyang report modbus errors in the correct way, and the rest not. Sigh.
                 // Let's just check for the condition, and truncate the first byte.
@@ -202,17 +206,8 @@ namespace Spindles {
                     memmove(rx_message + 1, rx_message, read_length - 1);
                 }
 
-                while (read_length < next_cmd.rx_length && current_read > 0) {
-                    // Try to read more; we're not there yet...
-                    current_read = _uart.readBytes(rx_message + read_length, next_cmd.rx_length - read_length, response_ticks);
-                    read_length += current_read;
-                }
-                if (current_read < 0) {
-                    read_length = 0;
-                }
-
                 // Generate crc16 for the response:
-                auto crc16response = ModRTU_CRC(rx_message, next_cmd.rx_length - 2);
+                auto crc16response = Modbus::crc16(rx_message, next_cmd.rx_length - 2);
 
                 if (read_length == next_cmd.rx_length &&                             // check expected length
                     rx_message[0] == VFD_RS485_ADDR &&                               // check address
@@ -288,8 +283,23 @@ namespace Spindles {
                 }
             }
 
-            vTaskDelay(VFD_RS485_POLL_RATE / portTICK_PERIOD_MS);
+            // Keep the line silent between frames, then wait for the next poll. A queued command ends
+            // the wait right away.
+            vTaskDelay(instance->_frame_gap);
+            xQueuePeek(vfd_cmd_queue, &next_cmd, instance->poll_ticks());
+        }
+    }
+
+    // Status polls follow the spindle: back to back while a spin-up waits for the reported speed, at
+    // the poll rate while it runs, and slower while it is off.
+    TickType_t VFD::poll_ticks() const {
+        if (_syncing) {
+            return 0;
+        }
+        if (_current_state == SpindleState::Disable) {
+            return VFD_RS485_IDLE_POLL_RATE / portTICK_PERIOD_MS;
         }
+        return VFD_RS485_POLL_RATE / portTICK_PERIOD_MS;
     }
 
     // ================== Class methods ==================================
@@ -317,8 +327,12 @@ namespace Spindles {
             return;
         }
 
+        _uart.enableRxEvents();  // read_frame() sleeps until data arrives
         _uart.begin(_baudrate, _dataBits, _stopBits, _parity);
 
+        // The silent interval is 3.5 characters of 11 bits, and a fixed 1.75 ms above 19200 baud
+        _frame_gap = pdMS_TO_TICKS(_baudrate > 19200 ? 2 : (38500 + _baudrate - 1) / _baudrate) + 1;
+
         if (_uart.setHalfDuplex()) {
             grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "RS485 VFD uart set half duplex failed");
             return;
@@ -422,10 +436,6 @@ namespace Spindles {
             } else {
                 delayMillis = _spinup_delay;
             }
-
-            if (_current_state != state && !supports_actual_rpm()) {
-                delay(delayMillis);
-            }
         } else {
             if (_current_rpm != rpm) {
                 if (rpm != 0 && (rpm < _min_rpm || rpm > _max_rpm)) {
@@ -444,53 +454,22 @@ namespace Spindles {
 
         if (shouldWait) {
             if (supports_actual_rpm()) {
-                _syncing = true;
-
                 // Allow 2.5% difference from what we asked for. Should be fine.
                 uint32_t drpm = (_max_rpm - _min_rpm) / 40;
                 if (drpm < 100) {
                     drpm = 100;
                 }  // Just a sanity check
 
-                auto minRpmAllowed = _current_rpm > drpm ? (_current_rpm - drpm) : 0;
-                auto maxRpmAllowed = _current_rpm + drpm;
-
-                int       unchanged = 0;
-                const int limit     = 20;  // 20 * 0.5s = 10 sec
-                auto      last      = _sync_rpm;
-
-                while ((_sync_rpm < minRpmAllowed || _sync_rpm > maxRpmAllowed) && unchanged < limit) {
+                _sync_min     = _current_rpm > drpm ? (_current_rpm - drpm) : 0;
+                _sync_max     = _current_rpm + drpm;
+                _sync_last    = _sync_rpm;
+                _sync_changed = millis();
+                _syncing      = true;  // at_speed() waits for the VFD to report a speed in range
 #ifdef VFD_DEBUG_MODE
-                    grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Syncing RPM. Requested %d, current %d", int(rpm), int(_sync_rpm));
+                grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Info, "Syncing RPM. Requested %d, current %d", int(rpm), int(_sync_rpm));
 #endif
-                    if (!mc_dwell(500)) {
-                        // Something happened while we were dwelling, like a safety door.
-                        unchanged = limit;
-                        last      = _sync_rpm;
-                        break;
-                    }
-
-                    if (_sync_rpm == last) {
-                        ++unchanged;
-                    } else {
-                        unchanged = 0;
-                    }
-                    last = _sync_rpm;
-                }
-
-                if (unchanged == limit) {
-                    grbl_msg_sendf(CLIENT_ALL,
-                                   MsgLevel::Error,
-                                   "Critical Spindle RS485 did not reach speed %d. Reported speed is %d rpm.",
-                                   rpm,
-                                   _sync_rpm);
-                    mc_reset();
-                    sys_rt_exec_alarm = ExecAlarm::SpindleControl;
-                }
-
-                _syncing = false;
             } else {
-                delay(delayMillis);
+                spin_delay(delayMillis);
             }
         }
 
@@ -584,31 +563,37 @@ namespace Spindles {
 #ifdef VFD_DEBUG_MODE
         grbl_msg_sendf(CLIENT_SERIAL, MsgLevel::Debug, "VFD::stop()");
 #endif
+        _syncing = false;
         set_mode(SpindleState::Disable, true);
     }
 
-    // state is cached rather than read right now to prevent delays
-    SpindleState VFD::get_state() { return _current_state; }
-
-    // Calculate the CRC on all of the byte except the last 2
-    // It then added the CRC to those last 2 bytes
-    // full_msg_len This is the length of the message including the 2 crc bytes
-    // Source: https://ctlsys.com/support/how_to_compute_the_modbus_rtu_message_crc/
-    uint16_t VFD::ModRTU_CRC(uint8_t* buf, int msg_len) {
-        uint16_t crc = 0xFFFF;
-        for (int pos = 0; pos < msg_len; pos++) {
-            crc ^= uint16_t(buf[pos]);  // XOR byte into least sig. byte of crc.
-
-            for (int i = 8; i != 0; i--) {  // Loop over each bit
-                if ((crc & 0x0001) != 0) {  // If the LSB is set
-                    crc >>= 1;              // Shift right and XOR 0xA001
-                    crc ^= 0xA001;
-                } else {        // Else LSB is not set
-                    crc >>= 1;  // Just shift right
-                }
-            }
+    // Called by the protocol task while motion waits for the spindle. The communications task polls
+    // the speed while syncing, so this only compares the last speed it got.
+    bool VFD::at_speed() {
+        if (!_syncing) {
+            return Spindle::at_speed();
         }
-
-        return crc;
+        uint32_t rpm = _sync_rpm;
+        if (rpm >= _sync_min && rpm <= _sync_max) {
+            _syncing = false;
+            return true;
+        }
+        if (rpm != _sync_last) {
+            _sync_last    = rpm;
+            _sync_changed = millis();
+        } else if (millis() - _sync_changed >= SYNC_TIMEOUT) {
+            grbl_msg_sendf(CLIENT_ALL,
+                           MsgLevel::Error,
+                           "Critical Spindle RS485 did not reach speed %d. Reported speed is %d rpm.",
+                           _current_rpm,
+                           rpm);
+            _syncing = false;
+            mc_reset();
+            sys_rt_exec_alarm = ExecAlarm::SpindleControl;
+        }
+        return false;
     }
+
+    // state is cached rather than read right now to prevent delays
+    SpindleState VFD::get_state() { return _current_state; }
 }
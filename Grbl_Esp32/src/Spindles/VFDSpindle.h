@@ -19,6 +19,7 @@
     along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "Spindle.h"
+#include "Modbus.h"
 
 #include "../Uart.h"
 
@@ -31,6 +32,7 @@ namespace Spindles {
     private:
         static const int VFD_RS485_MAX_MSG_SIZE = 16;  // more than enough for a modbus message
         static const int MAX_RETRIES            = 5;   // otherwise the spindle is marked 'unresponsive'
+        static const int SYNC_TIMEOUT           = 10000;  // ms the reported speed may stay out of range and unchanged
 
         bool set_mode(SpindleState mode, bool critical);
         bool get_pins_and_settings();
@@ -43,11 +45,18 @@ namespace Spindles {
         bool     _task_running = false;
         bool     vfd_ok        = true;
 
+        // The speed range a spin-up must reach, and the last reported speed and when it changed
+        uint32_t _sync_min;
+        uint32_t _sync_max;
+        uint32_t _sync_last;
+        uint32_t _sync_changed;
+
         static QueueHandle_t vfd_cmd_queue;
         static TaskHandle_t  vfd_cmdTaskHandle;
         static void          vfd_cmd_task(void* pvParameters);
 
-        static uint16_t ModRTU_CRC(uint8_t* buf, int msg_len);
+        TickType_t _frame_gap = 1;  // Silent interval between frames in ticks, from the baud rate
+        TickType_t poll_ticks() const;
 
     protected:
         struct ModbusCommand {
@@ -95,6 +104,7 @@ namespace Spindles {
         void         init();
         void         config_message();
         void         set_state(SpindleState state, uint32_t rpm);
+        bool         at_speed() override;
         SpindleState get_state();
         uint32_t     set_rpm(uint32_t rpm);
         void         stop();
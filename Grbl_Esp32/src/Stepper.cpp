@@ -38,6 +38,14 @@ typedef struct {
     uint32_t step_event_count;
     uint8_t  direction_bits;
     uint8_t  is_pwm_rate_adjusted;  // Tracks motions that require constant laser power/rate
+#ifdef DEFER_POSITION_UPDATES
+    uint8_t  step_event_shift;    // step_event_count is an odd number shifted left by this,
+    uint32_t step_event_inverse;  // and this is the inverse of that odd number, modulo 2^32.
+#endif
+#ifdef LASER_RASTER
+    uint32_t raster_pixel_events;  // Step events per pixel of a G7 scanline, in 1/65536 events. 0 for other blocks.
+    uint32_t raster_end;           // Raster buffer position after the last pixel
+#endif
 } st_block_t;
 static st_block_t st_block_buffer[SEGMENT_BUFFER_SIZE - 1];
 
@@ -51,6 +59,15 @@ typedef struct {
     uint8_t  st_block_index;  // Stepper block data index. Uses this information to execute this segment.
     uint8_t  amass_level;     // AMASS level for the ISR to execute this segment
     uint16_t spindle_rpm;     // TODO get rid of this.
+#ifdef LASER_POWER_PER_STEP
+    uint32_t laser_level;  // Laser power level at the first step event, in 1/65536 levels
+    int32_t  laser_slope;  // Change of the laser power level per step event, 0 for none
+#endif
+#ifdef LASER_RASTER
+    uint32_t raster_position;  // Raster buffer position of the pixel at the first step event
+    int32_t  raster_next;      // Step events to the next pixel, in 1/65536 events
+    uint32_t raster_release;   // Raster buffer position the ISR is done with when the segment completes
+#endif
 } segment_t;
 static segment_t segment_buffer[SEGMENT_BUFFER_SIZE];
 
@@ -59,6 +76,9 @@ typedef struct {
     // Used by the bresenham line algorithm
 
     uint32_t counter[MAX_N_AXIS];  // Counter variables for the bresenham line tracer
+#ifdef DEFER_POSITION_UPDATES
+    uint32_t segment_counter[MAX_N_AXIS];  // Bresenham counters at the start of the executing segment
+#endif
 
     uint8_t  step_bits;        // Stores out_bits output to complete the step pulse delay
     uint8_t  execute_step;     // Flags step execution for each interrupt.
@@ -67,7 +87,21 @@ typedef struct {
     uint8_t  dir_outbits;
     uint32_t steps[MAX_N_AXIS];
 
+    uint32_t pulse_microseconds;      // Copies of the settings, taken by st_wake_up(), so the ISR
+    uint32_t direction_microseconds;  // doesn't read them through the settings on every tick.
+
     uint16_t    step_count;        // Steps remaining in line segment motion
+#ifdef USE_RMT_STEP_BURSTS
+    bool burst;  // The timer alarm spans a burst instead of one ISR period
+#endif
+#ifdef LASER_POWER_PER_STEP
+    uint8_t laser_countdown;  // Step events to the next laser power update
+#endif
+#ifdef LASER_RASTER
+    uint32_t raster_position;  // Raster buffer position of the pixel being engraved
+    int32_t  raster_next;      // Step events to the next pixel, in 1/65536 events
+    uint32_t raster_tick;      // Step events per ISR tick, in 1/65536 events
+#endif
     uint8_t     exec_block_index;  // Tracks the current st_block index. Change indicates new block.
     st_block_t* exec_block;        // Pointer to the block data for the segment being executed
     segment_t*  exec_segment;      // Pointer to the segment being executed
@@ -76,17 +110,58 @@ static stepper_t st;
 
 // Step segment ring buffer indices
 static volatile uint8_t segment_buffer_tail;
-static uint8_t          segment_buffer_head;
+static volatile uint8_t segment_buffer_head;
 static uint8_t          segment_next_head;
 
 // Used to avoid ISR nesting of the "Stepper Driver Interrupt". Should never occur though.
 static std::atomic<bool> busy;
 
+#ifdef DEFER_POSITION_UPDATES
+// Odd while the ISR is loading a segment or committing one to sys_position. Lets st_get_position()
+// take a consistent snapshot without masking interrupts. It doesn't change on the other step events.
+static volatile uint32_t position_seq;
+#endif
+
+#ifdef USE_RMT_STEP_BURSTS
+// Set by st_wake_up() when every motor can take its pulses as an RMT burst.
+static bool rmt_bursts;
+#endif
+
+#ifdef USE_SEGMENT_PREP_TASK
+// Serializes the segment prep task with the main program's own st_prep_buffer() calls, and with
+// the resets of the prep state. The planner never takes it.
+static SemaphoreHandle_t segmentPrepMutex      = NULL;
+static TaskHandle_t      segmentPrepTaskHandle = NULL;
+#endif
+
+// Set by the planner when the plan of the executing block changed. The segment prep recomputes
+// its velocity profile before the next segment. See st_update_plan_block_parameters().
+static volatile bool prep_replan;
+
+// Set while st_prep_buffer() runs. The segment prep reads and updates the planner blocks then, so
+// a plan update waits for it to clear, see st_prep_wait().
+static volatile bool prep_busy;
+
 // Pointers for the step segment being prepped from the planner buffer. Accessed only by the
-// main program. Pointers may be planning segments or planner blocks ahead of what being executed.
+// main program and the segment prep task, while holding the prep lock. Pointers may be planning segments or planner blocks ahead of what being executed.
 static plan_block_t* pl_block;       // Pointer to the planner block being prepped
 static st_block_t*   st_prep_block;  // Pointer to the stepper block data being prepped
 
+#ifdef ENABLE_MOTION_STATS
+st_stats_t st_stats;
+
+// Current count of the auto-reloading step timer, i.e. ticks since its last alarm.
+static inline uint32_t IRAM_ATTR step_timer_count() {
+    TIMERG0.hw_timer[STEP_TIMER_INDEX].update = 1;
+    return TIMERG0.hw_timer[STEP_TIMER_INDEX].cnt_low;
+}
+
+// True while part of the current motion is still to be prepped into the segment buffer.
+static bool motion_pending() {
+    return !sys.step_control.endMotion && (pl_block != NULL || plan_get_current_block() != NULL);
+}
+#endif
+
 // esp32 work around for disable in main loop
 uint64_t stepper_idle_counter;  // used to count down until time to disable stepper drivers
 bool     stepper_idle;
@@ -118,10 +193,25 @@ typedef struct {
     float accelerate_until;  // Acceleration ramp end measured from end of block (mm)
     float decelerate_after;  // Deceleration ramp start measured from end of block (mm)
 
+#ifdef S_CURVE_ACCELERATION
+    float current_accel;  // Current acceleration at the end of the segment buffer (mm/min^2)
+    float accel_limit;    // Acceleration limit of the executing block and its junction with the next (mm/min^2)
+    float jerk_limit;     // Jerk limit of the executing block and its junction with the next (mm/min^3)
+#endif
+
     float inv_rate;  // Used by PWM laser mode to speed up segment calculations.
     //uint16_t current_spindle_pwm;  // todo remove
     float current_spindle_rpm;
 
+#ifdef LASER_POWER_PER_STEP
+    uint32_t laser_power_max;  // Rpm of the top laser power level, 0 if the spindle can't ramp the power
+#endif
+
+#ifdef PLANNER_ARCS
+    int32_t arc_steps[3];    // Step position of the arc axes at the end of the last chord
+    bool    arc_block_used;  // The stepper block being prepped holds a chord already
+#endif
+
 } st_prep_t;
 static st_prep_t prep;
 
@@ -192,23 +282,253 @@ stepper_id_t current_stepper = DEFAULT_STEPPER;
 
 static void stepper_pulse_func();
 
-// TODO: Replace direct updating of the int32 position counters in the ISR somehow. Perhaps use smaller
-// int8 variables and update position counters only when a segment completes. This can get complicated
-// with probing and homing cycles that require true real-time positions.
+// Executes one Bresenham step event for the first N axes: sets st.step_outbits and, unless
+// DEFER_POSITION_UPDATES is enabled, updates sys_position. N is a template parameter so the axis
+// loop is unrolled, and stepper_init() picks the instance for the configured number of axes.
+template <int N>
+static void bresenham_step() {
+    const uint32_t step_event_count = st.exec_block->step_event_count;
+#ifndef DEFER_POSITION_UPDATES
+    const uint8_t direction_bits = st.exec_block->direction_bits;
+#endif
+    uint8_t step_bits = 0;
+    for (int axis = 0; axis < N; axis++) {
+        st.counter[axis] += st.steps[axis];
+        if (st.counter[axis] > step_event_count) {
+            step_bits |= bit(axis);
+            st.counter[axis] -= step_event_count;
+#ifndef DEFER_POSITION_UPDATES
+            sys_position[axis] += (direction_bits & bit(axis)) ? -1 : 1;
+#endif
+        }
+    }
+    st.step_outbits = step_bits;
+}
+
+#ifdef DEFER_POSITION_UPDATES
+// Adds the steps taken in the executing segment after the given number of step events to position.
+// Every step subtracts step_event_count from the axis counter, so the counter at the start of the
+// segment plus the increments added since, less the counter now, is an exact multiple of it. Called
+// by the ISR, so the quotient is taken by a shift and a multiply with the inverse from st_block_set_divisor().
+static void commit_segment_steps(int32_t* position, uint32_t step_events) {
+    auto           n_axis  = number_axis->get();
+    const uint8_t  shift   = st.exec_block->step_event_shift;
+    const uint32_t inverse = st.exec_block->step_event_inverse;
+    for (int axis = 0; axis < n_axis; axis++) {
+        uint64_t advanced = (uint64_t)st.segment_counter[axis] + (uint64_t)step_events * st.steps[axis] - st.counter[axis];
+        int32_t  steps    = (uint32_t)(advanced >> shift) * inverse;
+        if (st.exec_block->direction_bits & bit(axis)) {
+            position[axis] -= steps;
+        } else {
+            position[axis] += steps;
+        }
+    }
+}
+
+// Same as commit_segment_steps(), but for readers outside the ISR, which can't see the counters
+// consistently in the middle of a segment. An axis steps whenever its counter exceeds
+// step_event_count, and the segment starts with it in 1..step_event_count, so the steps follow
+// from the counter at the start of the segment and the increments added since.
+static void add_segment_steps(int32_t* position, uint32_t step_events) {
+    auto           n_axis           = number_axis->get();
+    const uint32_t step_event_count = st.exec_block->step_event_count;
+    for (int axis = 0; axis < n_axis; axis++) {
+        uint64_t added = (uint64_t)st.segment_counter[axis] + (uint64_t)step_events * st.steps[axis];
+        int32_t  steps = (added - 1) / step_event_count;
+        if (st.exec_block->direction_bits & bit(axis)) {
+            position[axis] -= steps;
+        } else {
+            position[axis] += steps;
+        }
+    }
+}
+
+// Splits step_event_count into an odd number and a power of two, for commit_segment_steps().
+static void st_block_set_divisor(st_block_t* block) {
+    uint8_t  shift   = __builtin_ctz(block->step_event_count);
+    uint32_t odd     = block->step_event_count >> shift;
+    uint32_t inverse = odd;  // Right in the low 3 bits. Each Newton step doubles that.
+    for (int i = 0; i < 4; i++) {
+        inverse *= 2 - odd * inverse;
+    }
+    block->step_event_shift   = shift;
+    block->step_event_inverse = inverse;
+}
+
+// Step events executed so far in the current segment. A segment with n_step of zero runs
+// for 65536 events, like the step counter it is loaded into.
+static uint32_t segment_step_events() {
+    return (uint16_t)(st.exec_segment->n_step - st.step_count);
+}
+#endif
+
+static void (*const bresenham_steps[MAX_N_AXIS + 1])() = {
+    bresenham_step<0>, bresenham_step<1>, bresenham_step<2>, bresenham_step<3>,
+    bresenham_step<4>, bresenham_step<5>, bresenham_step<6>,
+};
+static void (*bresenham_kernel)() = bresenham_step<MAX_N_AXIS>;
+
+// Discards the executed segment and advances the segment buffer.
+static void segment_complete() {
+#ifdef DEFER_POSITION_UPDATES
+    // Commit the steps of the whole segment to the machine position.
+    position_seq++;
+    std::atomic_thread_fence(std::memory_order_release);
+    uint32_t n_step = st.exec_segment->n_step;
+    commit_segment_steps(sys_position, n_step ? n_step : 0x10000);
+#endif
+#ifdef LASER_RASTER
+    if (st.exec_block->raster_pixel_events != 0) {
+        raster_tail = st.exec_segment->raster_release;  // Let raster_queue() reuse the engraved pixels
+    }
+#endif
+    st.exec_segment = NULL;
+#ifdef DEFER_POSITION_UPDATES
+    std::atomic_thread_fence(std::memory_order_release);
+    position_seq++;
+#endif
+    if (++segment_buffer_tail == SEGMENT_BUFFER_SIZE) {
+        segment_buffer_tail = 0;
+    }
+}
+
+#ifdef LASER_POWER_PER_STEP
+// Sets the laser power for the step events executed so far in the segment, on the ramp the segment
+// prep worked out from the segment's entry and exit speeds.
+static void laser_power_update() {
+    uint32_t step_events = (uint16_t)(st.exec_segment->n_step - st.step_count);
+    uint32_t level       = (st.exec_segment->laser_level + st.exec_segment->laser_slope * step_events) >> 16;
+#    ifdef LASER_RASTER
+    if (st.exec_block->raster_pixel_events != 0) {
+        level = level * raster_pixel(st.raster_position) / 255;
+    }
+#    endif
+    spindle->set_power_level(level);
+}
+#endif
+
+#ifdef LASER_RASTER
+// Moves the G7 scanline on by the given ISR ticks. If that reaches a new pixel, sets its power.
+static void raster_step(uint32_t ticks) {
+    st.raster_next -= ticks * st.raster_tick;
+    if (st.raster_next > 0) {
+        return;
+    }
+    do {
+        st.raster_position++;
+        st.raster_next += st.exec_block->raster_pixel_events;
+    } while (st.raster_next <= 0);
+    if ((int32_t)(st.exec_block->raster_end - st.raster_position) <= 0) {
+        st.raster_position = st.exec_block->raster_end - 1;  // Rounding at the end of the block
+    }
+    laser_power_update();
+}
+#endif
+
+#ifdef USE_RMT_STEP_BURSTS
+#    ifdef LASER_RASTER
+// ISR ticks before the one that reaches the next pixel of a G7 scanline
+static uint32_t raster_ticks() {
+    return (st.raster_next - 1) / st.raster_tick;
+}
+#    endif
+
+// True if the next ticks can go out as one burst. Segments with AMASS are slow enough for one
+// interrupt per tick, and probing and homing must see every step as it happens.
+static bool burst_possible() {
+    if (!(rmt_bursts && st.exec_segment != NULL && st.exec_segment->amass_level == 0 && st.step_count >= 4 &&
+          sys_probe_state != Probe::Active && sys.state != State::Homing)) {
+        return false;
+    }
+#    ifdef LASER_RASTER
+    // A burst stops short of the next pixel, so the tick that reaches it sets its power on time.
+    if (st.exec_block->raster_pixel_events != 0 && raster_ticks() < 4) {
+        return false;
+    }
+#    endif
+    return true;
+}
+
+// Sends the pending step bits and the next step events of the executing segment to the motors as one
+// burst, then sets the timer to fire again when the burst is over. The steps of the last event of the
+// burst are left in st.step_outbits, to be sent on the next interrupt as usual.
+static void step_burst() {
+    uint8_t  step_bits[RMT_BURST_TICKS];
+    uint32_t ticks  = st.step_count < RMT_BURST_TICKS ? st.step_count : RMT_BURST_TICKS;
+    uint32_t period = st.exec_segment->isrPeriod;
+#    ifdef LASER_RASTER
+    if (st.exec_block->raster_pixel_events != 0) {
+        ticks = MIN(ticks, raster_ticks());
+    }
+#    endif
+
+    step_bits[0] = st.step_outbits;
+    for (uint32_t tick = 1; tick <= ticks; tick++) {
+        bresenham_kernel();
+        if (tick < ticks) {
+            step_bits[tick] = st.step_outbits;
+        }
+    }
+    motors_step_burst(step_bits, ticks, period);
+    timer_set_alarm_value(STEP_TIMER_GROUP, STEP_TIMER_INDEX, (uint64_t)ticks * period);
+    st.burst = true;
+
+    st.step_count -= ticks;
+#    ifdef LASER_RASTER
+    if (st.exec_block->raster_pixel_events != 0) {
+        st.raster_next -= ticks * st.raster_tick;  // Short of the next pixel, see burst_possible()
+    }
+#    endif
+#    ifdef LASER_POWER_PER_STEP
+    if (st.exec_segment->laser_slope != 0) {
+        laser_power_update();
+    }
+#    endif
+    if (st.step_count == 0) {
+        segment_complete();
+    }
+}
+#endif
+
+// NOTE: With DEFER_POSITION_UPDATES, the ISR updates the int32 position counters only when a segment
+// completes. Probing and status reports read the true real-time position through st_get_position().
 void IRAM_ATTR onStepperDriverTimer(void* para) {
     // Timer ISR, normally takes a step.
     //
     // When handling an interrupt within an interrupt serivce routine (ISR), the interrupt status bit
     // needs to be explicitly cleared.
     TIMERG0.int_clr_timers.t0 = 1;
+#ifdef ENABLE_MOTION_STATS
+    uint32_t latency = step_timer_count();
+#endif
 
     bool expected = false;
     if (busy.compare_exchange_strong(expected, true)) {
+        uint8_t tail = segment_buffer_tail;
         stepper_pulse_func();
 
         TIMERG0.hw_timer[STEP_TIMER_INDEX].config.alarm_en = TIMER_ALARM_EN;
+#ifdef ENABLE_MOTION_STATS
+        uint32_t isr_time = step_timer_count() - latency;
+        if (latency > st_stats.max_isr_latency) {
+            st_stats.max_isr_latency = latency;
+        }
+        if (isr_time > st_stats.max_isr_time) {
+            st_stats.max_isr_time = isr_time;
+        }
+#endif
 
         busy.store(false);
+#ifdef USE_SEGMENT_PREP_TASK
+        // A segment was consumed. Wake the prep task to refill the buffer.
+        if (tail != segment_buffer_tail && segmentPrepTaskHandle != NULL) {
+            BaseType_t higherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(segmentPrepTaskHandle, &higherPriorityTaskWoken);
+            if (higherPriorityTaskWoken) {
+                portYIELD_FROM_ISR();
+            }
+        }
+#endif
     }
 }
 
@@ -220,10 +540,8 @@ void IRAM_ATTR onStepperDriverTimer(void* para) {
  * is to keep pulse timing as regular as possible.
  */
 static void stepper_pulse_func() {
-    auto n_axis = number_axis->get();
-
     if (motors_direction(st.dir_outbits)) {
-        auto wait_direction = direction_delay_microseconds->get();
+        auto wait_direction = st.direction_microseconds;
         if (wait_direction > 0) {
             // Stepper drivers need some time between changing direction and doing a pulse.
             switch (current_stepper) {
@@ -249,6 +567,13 @@ static void stepper_pulse_func() {
         }
     }
 
+#ifdef USE_RMT_STEP_BURSTS
+    if (burst_possible()) {
+        step_burst();
+        return;
+    }
+#endif
+
     // If we are using GPIO stepping as opposed to RMT, record the
     // time that we turned on the step pins so we can turn them off
     // at the end of this routine without incurring another interrupt.
@@ -256,20 +581,36 @@ static void stepper_pulse_func() {
     // those methods time the turn off automatically.
     //
     // NOTE: We could use direction_pulse_start_time + wait_direction, but let's play it safe
-    uint64_t step_pulse_start_time = esp_timer_get_time();
+    uint64_t step_pulse_start_time = current_stepper == ST_RMT ? 0 : esp_timer_get_time();
     motors_step(st.step_outbits);
 
     // If there is no step segment, attempt to pop one from the stepper buffer
     if (st.exec_segment == NULL) {
         // Anything in the buffer? If so, load and initialize next step segment.
         if (segment_buffer_head != segment_buffer_tail) {
+#ifdef DEFER_POSITION_UPDATES
+            position_seq++;
+            std::atomic_thread_fence(std::memory_order_release);
+#endif
             // Initialize new step segment and load number of steps to execute
             st.exec_segment = &segment_buffer[segment_buffer_tail];
+#ifdef ENABLE_MOTION_STATS
+            if (motion_pending()) {
+                uint8_t queued = (segment_buffer_head + SEGMENT_BUFFER_SIZE - segment_buffer_tail) % SEGMENT_BUFFER_SIZE;
+                if (queued < st_stats.min_segments) {
+                    st_stats.min_segments = queued;
+                }
+            }
+#endif
             // Initialize step segment timing per step and load number of steps to execute.
             Stepper_Timer_WritePeriod(st.exec_segment->isrPeriod);
+#ifdef USE_RMT_STEP_BURSTS
+            st.burst = false;
+#endif
             st.step_count = st.exec_segment->n_step;  // NOTE: Can sometimes be zero when moving slow.
             // If the new segment starts a new planner block, initialize stepper variables and counters.
             // NOTE: When the segment data index changes, this indicates a new planner block.
+            auto n_axis = number_axis->get();
             if (st.exec_block_index != st.exec_segment->st_block_index) {
                 st.exec_block_index = st.exec_segment->st_block_index;
                 st.exec_block       = &st_block_buffer[st.exec_block_index];
@@ -283,10 +624,38 @@ static void stepper_pulse_func() {
             for (int axis = 0; axis < n_axis; axis++) {
                 st.steps[axis] = st.exec_block->steps[axis] >> st.exec_segment->amass_level;
             }
+#ifdef DEFER_POSITION_UPDATES
+            memcpy(st.segment_counter, st.counter, sizeof(st.counter));
+            std::atomic_thread_fence(std::memory_order_release);
+            position_seq++;
+#endif
             // Set real-time spindle output as segment is loaded, just prior to the first step.
             spindle->set_rpm(st.exec_segment->spindle_rpm);
+#ifdef LASER_POWER_PER_STEP
+            st.laser_countdown = LASER_POWER_STEPS;
+#endif
+#ifdef LASER_RASTER
+            if (st.exec_block->raster_pixel_events != 0) {
+                st.raster_position = st.exec_segment->raster_position;
+                st.raster_next     = st.exec_segment->raster_next;
+                st.raster_tick     = 65536 >> st.exec_segment->amass_level;
+                laser_power_update();
+            }
+#endif
         } else {
             // Segment buffer empty. Shutdown.
+#ifdef ENABLE_MOTION_STATS
+            if (motion_pending()) {
+                st_stats.underruns++;
+                st_stats.min_segments = 0;
+#    ifdef USE_LINE_NUMBERS
+                plan_block_t* block = plan_get_current_block();
+                if (block != NULL) {
+                    st_stats.underrun_line = block->line_number;
+                }
+#    endif
+            }
+#endif
             st_go_idle();
             if (sys.state != State::Jog) {  // added to prevent ... jog after probing crash
                 // Ensure pwm is set properly upon completion of rate-controlled motion.
@@ -298,50 +667,51 @@ static void stepper_pulse_func() {
             return;  // Nothing to do but exit.
         }
     }
+#ifdef USE_RMT_STEP_BURSTS
+    if (st.burst) {
+        // Back to one interrupt per step event after a burst
+        Stepper_Timer_WritePeriod(st.exec_segment->isrPeriod);
+        st.burst = false;
+    }
+#endif
     // Check probing state.
     if (sys_probe_state == Probe::Active) {
         probe_state_monitor();
     }
-    // Reset step out bits.
-    st.step_outbits = 0;
-
-    for (int axis = 0; axis < n_axis; axis++) {
-        // Execute step displacement profile by Bresenham line algorithm
-        st.counter[axis] += st.steps[axis];
-        if (st.counter[axis] > st.exec_block->step_event_count) {
-            st.step_outbits |= bit(axis);
-            st.counter[axis] -= st.exec_block->step_event_count;
-            if (st.exec_block->direction_bits & bit(axis)) {
-                sys_position[axis]--;
-            } else {
-                sys_position[axis]++;
-            }
-        }
-    }
+    // Execute step displacement profile by Bresenham line algorithm
+    bresenham_kernel();
 
     // During a homing cycle, lock out and prevent desired axes from moving.
     if (sys.state == State::Homing) {
         st.step_outbits &= sys.homing_axis_lock;
     }
     st.step_count--;  // Decrement step events count
+#ifdef LASER_POWER_PER_STEP
+    if (st.exec_segment->laser_slope != 0 && --st.laser_countdown == 0) {
+        st.laser_countdown = LASER_POWER_STEPS;
+        laser_power_update();
+    }
+#endif
+#ifdef LASER_RASTER
+    if (st.exec_block->raster_pixel_events != 0) {
+        raster_step(1);
+    }
+#endif
     if (st.step_count == 0) {
         // Segment is complete. Discard current segment and advance segment indexing.
-        st.exec_segment = NULL;
-        if (++segment_buffer_tail == SEGMENT_BUFFER_SIZE) {
-            segment_buffer_tail = 0;
-        }
+        segment_complete();
     }
 
     switch (current_stepper) {
         case ST_I2S_STREAM:
             // Generate the number of pulses needed to span pulse_microseconds
-            i2s_out_push_sample(pulse_microseconds->get());
+            i2s_out_push_sample(st.pulse_microseconds);
             motors_unstep();
             break;
         case ST_I2S_STATIC:
         case ST_TIMED:
             // wait for step pulse time to complete...some time expired during code above
-            while (esp_timer_get_time() - step_pulse_start_time < pulse_microseconds->get()) {
+            while (esp_timer_get_time() - step_pulse_start_time < st.pulse_microseconds) {
                 NOP();  // spin here until time to turn off step
             }
             motors_unstep();
@@ -363,6 +733,67 @@ void stepper_init() {
 #endif
     // Other stepper use timer interrupt
     Stepper_Timer_Init();
+
+    int n_axis       = number_axis->get();
+    bresenham_kernel = bresenham_steps[n_axis >= 0 && n_axis <= MAX_N_AXIS ? n_axis : MAX_N_AXIS];
+#ifdef ENABLE_MOTION_STATS
+    st_stats_reset();
+#endif
+
+#ifdef USE_SEGMENT_PREP_TASK
+    segmentPrepMutex = xSemaphoreCreateRecursiveMutex();
+    xTaskCreatePinnedToCore(segmentPrepTask,             // task
+                            "segmentPrepTask",           // name for task
+                            4096,                        // size of task stack
+                            NULL,                        // parameters
+                            SEGMENT_PREP_TASK_PRIORITY,  // priority
+                            &segmentPrepTaskHandle,
+                            MOTION_TASK_CORE  // keep motion off the core that runs the main loop
+    );
+#endif
+}
+
+#ifdef USE_SEGMENT_PREP_TASK
+// Keeps the step segment buffer full while Grbl is moving. Woken by the stepper interrupt when a
+// segment completes, and at least every SEGMENT_PREP_TASK_PERIOD_MS otherwise.
+void segmentPrepTask(void* pvParameters) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, SEGMENT_PREP_TASK_PERIOD_MS / portTICK_PERIOD_MS);
+        if (sys.abort) {
+            continue;
+        }
+        // Same states in which protocol_exec_rt_system() reloads the segment buffer.
+        switch (sys.state) {
+            case State::Cycle:
+            case State::Hold:
+            case State::SafetyDoor:
+            case State::Homing:
+            case State::Sleep:
+            case State::Jog:
+                st_prep_buffer();
+                break;
+            default:
+                break;
+        }
+    }
+}
+#endif
+
+// Held while the segment prep state is used or reset. It nests, and is a no-op without the prep task.
+static void st_prep_lock() {
+#ifdef USE_SEGMENT_PREP_TASK
+    if (segmentPrepMutex != NULL) {
+        xSemaphoreTakeRecursive(segmentPrepMutex, portMAX_DELAY);
+    }
+#endif
+}
+
+static void st_prep_unlock() {
+#ifdef USE_SEGMENT_PREP_TASK
+    if (segmentPrepMutex != NULL) {
+        xSemaphoreGiveRecursive(segmentPrepMutex);
+    }
+#endif
 }
 
 void stepper_switch(stepper_id_t new_stepper) {
@@ -392,6 +823,11 @@ void st_wake_up() {
     stepper_idle = false;
 
     // Initialize step pulse timing from settings. Here to ensure updating after re-writing.
+    st.pulse_microseconds     = pulse_microseconds->get();
+    st.direction_microseconds = direction_delay_microseconds->get();
+#ifdef USE_RMT_STEP_BURSTS
+    rmt_bursts = current_stepper == ST_RMT && motors_can_step_burst();
+#endif
 #ifdef USE_RMT_STEPS
     // Step pulse delay handling is not require with ESP32...the RMT function does it.
     if (direction_delay_microseconds->get() < 1)
@@ -419,17 +855,29 @@ void st_reset() {
         i2s_out_reset();
     }
 #endif
+    st_prep_lock();
     st_go_idle();
+#ifdef DEFER_POSITION_UPDATES
+    // Keep the steps of a segment cut short by a reset or the end of a homing move.
+    if (st.exec_segment != NULL) {
+        position_seq++;
+        commit_segment_steps(sys_position, segment_step_events());
+        st.exec_segment = NULL;
+        position_seq++;
+    }
+#endif
     // Initialize stepper algorithm variables.
     memset(&prep, 0, sizeof(st_prep_t));
     memset(&st, 0, sizeof(stepper_t));
     st.exec_segment     = NULL;
     pl_block            = NULL;  // Planner block pointer used by segment buffer
+    prep_replan         = false;
     segment_buffer_tail = 0;
     segment_buffer_head = 0;  // empty = tail
     segment_next_head   = 1;
     st.step_outbits     = 0;
     st.dir_outbits      = 0;  // Initialize direction bits to default.
+    st_prep_unlock();
     // TODO do we need to turn step pins off?
 }
 
@@ -459,18 +907,309 @@ void st_go_idle() {
     st.step_outbits = 0;
 }
 
-// Called by planner_recalculate() when the executing block is updated by the new plan.
-void st_update_plan_block_parameters() {
-    if (pl_block != NULL) {  // Ignore if at start of a new block.
-        prep.recalculate_flag.recalculate = 1;
-        pl_block->entry_speed_sqr         = prep.current_speed * prep.current_speed;  // Update entry speed.
-        pl_block                          = NULL;  // Flag st_prep_segment() to load and check active velocity profile.
+#ifdef S_CURVE_ACCELERATION
+/* Jerk-limited (S-curve) velocity profiles. The speed and the acceleration at the end of the segment
+   buffer carry on from segment to segment, from block to block and through replans. The acceleration
+   changes at no more than the jerk limit, and never exceeds the acceleration limit of the block. The
+   ramps are thus longer than the planner's constant acceleration ramps, and the planned entry speeds
+   can't be met. Instead, the segment generator looks ahead over the planner buffer and brakes in time
+   for the speed limit at each junction (max_entry_speed_sqr) and for the stop at the end of the buffer.
+*/
+typedef struct {
+    float speed;  // (mm/min)
+    float accel;  // Signed acceleration (mm/min^2)
+    float mm;     // Distance to the end of the executing block (mm)
+} s_curve_state_t;
+
+typedef struct {
+    float speed;  // Speed to ramp to (mm/min)
+    float accel;  // Acceleration limit (mm/min^2)
+    float jerk;   // Jerk limit (mm/min^3)
+    bool  brake;  // Brake down to the speed as hard as the limits allow, instead of ramping up to it
+} s_curve_plan_t;
+
+typedef struct {
+    float jerk;       // (mm/min^3)
+    float time;       // Time to the end of the phase (min)
+    float accel_end;  // Acceleration at the end of the phase (mm/min^2)
+    float speed_end;  // Speed at the end of the phase, or negative if the phase doesn't end at a set speed (mm/min)
+} s_curve_phase_t;
+
+// Speed limit at the end of a planner block, with the plan to brake for it.
+typedef struct {
+    float          mm;  // Distance from the end of the executing block (mm)
+    s_curve_plan_t brake;
+} s_curve_limit_t;
+
+static s_curve_limit_t s_curve_limits[BLOCK_BUFFER_SIZE];
+static uint16_t        s_curve_limit_count;  // Up to BLOCK_BUFFER_SIZE, which may be 512
+
+const int S_CURVE_BISECTIONS   = 24;  // Iterations of the searches for a point in time
+const int S_CURVE_MAX_PHASES   = 12;  // Phases run at once. Bounds loops on round-off.
+const int S_CURVE_MAX_SWITCHES = 4;   // Plan switches per ramp computation. Bounds loops on round-off.
+
+// Margin for round-off on speeds (mm/min)
+static inline float s_curve_tolerance(float speed, float target) {
+    return 1e-5f * (speed + target) + 1e-3f;
+}
+
+// Advances the state by time t (min) at the given jerk (mm/min^3).
+static void s_curve_step(s_curve_state_t* s, float jerk, float t) {
+    s->mm -= t * (s->speed + t * (0.5f * s->accel + t * jerk * (1.0f / 6.0f)));
+    s->speed += t * (s->accel + 0.5f * jerk * t);
+    s->accel += jerk * t;
+    if (s->speed < 0.0f) {
+        s->speed = 0.0f;
+    }
+}
+
+// Gets the phase of the plan the state is in.
+static s_curve_phase_t s_curve_phase(const s_curve_state_t* s, const s_curve_plan_t* plan) {
+    float v         = s->speed;
+    float a         = s->accel;
+    float j         = plan->jerk;
+    float target    = plan->speed;
+    float tolerance = s_curve_tolerance(v, target);
+    float ease      = 0.5f * a * a / j;  // Speed change while easing the acceleration off to zero
+    if (!plan->brake) {
+        if (a >= 0.0f && v + ease >= target - tolerance) {
+            if (a == 0.0f) {
+                return { 0.0f, SOME_LARGE_VALUE, 0.0f, -1.0f };  // Cruise
+            }
+            return { -j, a / j, 0.0f, target };  // Ease off into the target speed
+        }
+        if (a > plan->accel) {
+            return { -j, (a - plan->accel) / j, plan->accel, -1.0f };  // Over the lower limit of a new block
+        }
+        if (a >= 0.9999f * plan->accel) {
+            return { 0.0f, (target - v - ease) / a, a, -1.0f };  // Hold the acceleration until it has to ease off
+        }
+        // Raise the acceleration up to the limit, or up to where it has to ease off
+        float ease_time  = (sqrtf(MAX(0.5f * a * a + j * (target - v), 0.0f)) - a) / j;
+        float limit_time = (plan->accel - a) / j;
+        if (limit_time < ease_time) {
+            return { j, limit_time, plan->accel, -1.0f };
+        }
+        return { j, ease_time, a + j * ease_time, -1.0f };
     }
+    if (a < 0.0f && v - ease <= target + tolerance) {
+        // Easing off gets down to the target speed, or as close to it as it can
+        return { j, -a / j, 0.0f, v - ease >= target - tolerance ? target : -1.0f };
+    }
+    if (a >= 0.0f && v + ease <= target + tolerance) {
+        if (a == 0.0f) {
+            return { 0.0f, SOME_LARGE_VALUE, 0.0f, -1.0f };  // Cruise
+        }
+        return { -j, a / j, 0.0f, -1.0f };  // Ease off below the target speed
+    }
+    // Brake at the acceleration that eases off right into the target speed, or hold the acceleration
+    // limit until it can.
+    float peak = MIN(sqrtf(0.5f * a * a + j * (v - target)), plan->accel);
+    if (a > -0.9999f * peak) {
+        return { -j, (a + peak) / j, -peak, -1.0f };
+    }
+    if (a < -1.0001f * peak) {
+        return { j, (-peak - a) / j, -peak, -1.0f };  // Over the lower limit of a new block
+    }
+    return { 0.0f, (v - ease - target) / -a, a, -1.0f };
+}
+
+// Advances the state along the plan for up to time t (min), but not past mm_end. Stops early where the
+// plan comes to a stop. Returns the time taken (min).
+static float s_curve_run(s_curve_state_t* s, const s_curve_plan_t* plan, float t, float mm_end) {
+    float taken = 0.0f;
+    for (int n = 0; n < S_CURVE_MAX_PHASES && taken < t && s->mm > mm_end; n++) {
+        s_curve_phase_t phase = s_curve_phase(s, plan);
+        if (phase.jerk == 0.0f && s->accel == 0.0f && s->speed == 0.0f) {
+            break;  // Stopped
+        }
+        float           time = MIN(phase.time, t - taken);
+        s_curve_state_t next = *s;
+        s_curve_step(&next, phase.jerk, time);
+        if (next.mm <= mm_end) {
+            // Find when it gets to mm_end. The distance only grows with time.
+            float early = 0.0f;
+            for (int i = 0; i < S_CURVE_BISECTIONS; i++) {
+                float half = 0.5f * (early + time);
+                next       = *s;
+                s_curve_step(&next, phase.jerk, half);
+                if (next.mm > mm_end) {
+                    early = half;
+                } else {
+                    time = half;
+                }
+            }
+            s_curve_step(s, phase.jerk, time);
+            s->mm = mm_end;
+            return taken + time;
+        }
+        *s = next;
+        if (time == phase.time) {  // Snap to the exact end of the phase
+            s->accel = phase.accel_end;
+            if (phase.speed_end >= 0.0f) {
+                s->speed = phase.speed_end;
+            }
+        }
+        taken += time;
+    }
+    return taken;
+}
+
+// Distance (mm) it takes to brake from the state down to the speed of the plan, zero if it doesn't have to.
+static float s_curve_brake_distance(const s_curve_state_t* s, const s_curve_plan_t* plan) {
+    float v      = s->speed;
+    float a      = s->accel;
+    float j      = plan->jerk;
+    float target = plan->speed;
+    float ease   = 0.5f * a * a / j;
+    if (a >= 0.0f ? v + ease <= target : v <= target) {
+        return 0.0f;
+    }
+    if (a < 0.0f && v - ease <= target) {
+        // Easing off gets down to the target speed on the way
+        float t = (-a - sqrtf(MAX(a * a - 2.0f * j * (v - target), 0.0f))) / j;
+        return t * (v + t * (0.5f * a + t * j * (1.0f / 6.0f)));
+    }
+    float           peak  = MIN(sqrtf(0.5f * a * a + j * (v - target)), plan->accel);
+    s_curve_state_t brake = { v, a, 0.0f };
+    s_curve_step(&brake, a > -peak ? -j : j, fabsf(a + peak) / j);
+    brake.accel = -peak;
+    float hold  = (brake.speed - target) / peak - 0.5f * peak / j;
+    if (hold > 0.0f) {
+        s_curve_step(&brake, 0.0f, hold);
+    }
+    s_curve_step(&brake, j, peak / j);
+    return -brake.mm;
+}
+
+// Lowest distance (mm) left over when braking for each speed limit ahead but the skipped one, and
+// the limit it is for.
+static float s_curve_slack(const s_curve_state_t* s, int16_t skip, int16_t* tightest) {
+    float slack = SOME_LARGE_VALUE;
+    for (int16_t idx = 0; idx < s_curve_limit_count; idx++) {
+        if (idx != skip) {
+            float left = s->mm + s_curve_limits[idx].mm - s_curve_brake_distance(s, &s_curve_limits[idx].brake);
+            if (left < slack) {
+                slack     = left;
+                *tightest = idx;
+            }
+        }
+    }
+    return slack;
+}
+
+// Collects the speed limits at the ends of the planner blocks ahead, as far as the segments prepped
+// over time t (min) could have to brake for. Also sets the limits to ramp up with.
+static void s_curve_look_ahead(float mm_remaining, float t) {
+    plan_block_t* block = pl_block;
+    float         accel = block->acceleration;
+    float         jerk  = block->jerk;
+    float         mm    = 0.0f;  // From the end of the executing block to the end of block (mm)
+    // Fastest the segments can get, to bound how far ahead braking can reach
+    s_curve_state_t fastest = { MAX(prep.current_speed, prep.maximum_speed), MAX(prep.current_accel, accel), 0.0f };
+
+    prep.accel_limit    = accel;
+    prep.jerk_limit     = jerk;
+    s_curve_limit_count = 0;
+    while (true) {
+        plan_block_t*    next  = sys.step_control.executeSysMotion ? NULL : plan_get_next_block(block);
+        s_curve_limit_t* limit = &s_curve_limits[s_curve_limit_count++];
+        limit->mm              = mm;
+        limit->brake           = { next == NULL ? 0.0f : sqrtf(next->max_entry_speed_sqr), accel, jerk, true };
+        if (next == NULL || s_curve_limit_count == BLOCK_BUFFER_SIZE) {
+            break;
+        }
+        accel = MIN(accel, next->acceleration);
+        jerk  = MIN(jerk, next->jerk);
+        if (block == pl_block) {
+            prep.accel_limit = accel;  // Enter the next block within its limits
+            prep.jerk_limit  = jerk;
+        }
+        s_curve_plan_t stop = { 0.0f, accel, jerk, true };
+        if (mm_remaining + mm > fastest.speed * t + s_curve_brake_distance(&fastest, &stop)) {
+            break;  // Stops before the limits further ahead at any speed it gets to
+        }
+        mm += next->millimeters;
+        block = next;
+    }
+}
+
+// Runs the profile of the executing block from mm_remaining (mm) on, for up to time t (min). Returns
+// the time taken, which is less only at the end of the block or of a feed hold.
+static float s_curve_prep(float t, float* mm_remaining) {
+    s_curve_state_t s     = { prep.current_speed, prep.current_accel, *mm_remaining };
+    float           taken = 0.0f;
+    s_curve_look_ahead(s.mm, t);
+    if (sys.step_control.executeHold) {
+        s_curve_plan_t stop = { 0.0f, prep.accel_limit, prep.jerk_limit, true };
+        taken               = s_curve_run(&s, &stop, t, 0.0f);
+        if (s.speed == 0.0f && s.accel == 0.0f) {
+            prep.mm_complete = s.mm;  // End of feed hold.
+        }
+    } else {
+        // Ramp up to the nominal speed, or brake down to it after a feed override change. Switch to
+        // braking for a speed limit ahead at the last moment it still can.
+        s_curve_plan_t plan  = { prep.maximum_speed, prep.accel_limit, prep.jerk_limit, false };
+        int16_t        limit = -1;  // The limit the plan brakes for
+        float          ease  = s.accel > 0.0f ? 0.5f * s.accel * s.accel / plan.jerk : 0.0f;
+        plan.brake           = s.speed + ease > plan.speed + s_curve_tolerance(s.speed, plan.speed);
+        for (int n = 0; n < S_CURVE_MAX_SWITCHES && taken < t && s.mm > 0.0f; n++) {
+            s_curve_state_t next     = s;
+            float           time     = s_curve_run(&next, &plan, t - taken, 0.0f);
+            int16_t         tightest = limit;
+            if (n == S_CURVE_MAX_SWITCHES - 1 || s_curve_slack(&next, limit, &tightest) >= 0.0f) {
+                s = next;
+                taken += time;
+                continue;
+            }
+            float early = 0.0f;
+            for (int i = 0; i < S_CURVE_BISECTIONS; i++) {
+                float   half = 0.5f * (early + time);
+                int16_t idx;
+                next = s;
+                s_curve_run(&next, &plan, half, 0.0f);
+                if (s_curve_slack(&next, limit, &idx) >= 0.0f) {
+                    early = half;
+                } else {
+                    time     = half;
+                    tightest = idx;
+                }
+            }
+            taken += s_curve_run(&s, &plan, early, 0.0f);
+            limit = tightest;
+            plan  = s_curve_limits[limit].brake;
+        }
+        if (taken < t && s.mm > 0.0f && s.speed == 0.0f && s.accel == 0.0f) {
+            // Stopped just short of the end of the block by round-off. Creep the rest of the way.
+            taken += cbrtf(6.0f * s.mm / prep.jerk_limit);
+            s.mm = 0.0f;
+        }
+    }
+    prep.current_speed = s.speed;
+    prep.current_accel = s.accel;
+    *mm_remaining      = s.mm;
+    return taken;
+}
+#endif
+
+// Called by planner_recalculate() when the executing block is updated by the new plan. Only flags
+// it. The segment prep recomputes the profile from the new plan before its next segment.
+void st_update_plan_block_parameters() {
+    std::atomic_thread_fence(std::memory_order_release);
+    prep_replan = true;
+}
+
+// Makes the segment prep recompute the velocity profile of the executing block from its current speed.
+static void prep_replan_block() {
+    prep.recalculate_flag.recalculate = 1;
+    pl_block->entry_speed_sqr         = prep.current_speed * prep.current_speed;  // Update entry speed.
+    pl_block                          = NULL;  // Flag st_prep_segment() to load and check active velocity profile.
 }
 
 #ifdef PARKING_ENABLE
 // Changes the run state of the step segment buffer to execute the special parking motion.
 void st_parking_setup_buffer() {
+    st_prep_lock();
     // Store step execution data of partially completed block, if necessary.
     if (prep.recalculate_flag.holdPartialBlock) {
         prep.last_st_block_index  = prep.st_block_index;
@@ -482,10 +1221,12 @@ void st_parking_setup_buffer() {
     prep.recalculate_flag.parking     = 1;
     prep.recalculate_flag.recalculate = 0;
     pl_block                          = NULL;  // Always reset parking motion to reload new block.
+    st_prep_unlock();
 }
 
 // Restores the step segment buffer to the normal run state after a parking motion.
 void st_parking_restore_buffer() {
+    st_prep_lock();
     // Restore step execution data and flags of partially completed block, if necessary.
     if (prep.recalculate_flag.holdPartialBlock) {
         st_prep_block                          = &st_block_buffer[prep.last_st_block_index];
@@ -501,6 +1242,7 @@ void st_parking_restore_buffer() {
     }
 
     pl_block = NULL;  // Set to reload next block.
+    st_prep_unlock();
 }
 #endif
 
@@ -510,7 +1252,58 @@ static uint8_t st_next_block_index(uint8_t block_index) {
     return block_index == (SEGMENT_BUFFER_SIZE - 1) ? 0 : block_index;
 }
 
-/* Prepares step segment buffer. Continuously called from main program.
+#ifdef PLANNER_ARCS
+// Sets up the stepping data of the next segment of an arc block: a chord from the step position
+// where the last chord ended to the point mm_remaining from the end of the arc. Every chord gets
+// a stepper block of its own. Returns the step events of the chord, 0 if it is shorter than a step.
+static uint32_t prep_arc_chord(segment_t* prep_segment, float mm_remaining) {
+    const uint8_t axes[3] = { pl_block->arc.axis_0, pl_block->arc.axis_1, pl_block->arc.axis_linear };
+    int32_t       steps[3];
+    int32_t       delta[3];
+    uint32_t      step_event_count = 0;
+    uint8_t       idx;
+    plan_arc_steps(pl_block, mm_remaining, steps);
+    for (idx = 0; idx < 3; idx++) {
+        delta[idx]       = steps[idx] - prep.arc_steps[idx];
+        step_event_count = MAX(step_event_count, (uint32_t)labs(delta[idx]));
+    }
+    if (step_event_count == 0) {
+        return 0;
+    }
+    // Axes that don't step keep their direction, so their direction pins don't toggle.
+    uint8_t direction_bits = st_prep_block->direction_bits;
+    if (prep.arc_block_used) {
+        // The stepper block of the last chord may still be executing. Take the next one.
+        uint8_t is_pwm_rate_adjusted        = st_prep_block->is_pwm_rate_adjusted;
+        prep.st_block_index                 = st_next_block_index(prep.st_block_index);
+        st_prep_block                       = &st_block_buffer[prep.st_block_index];
+        st_prep_block->is_pwm_rate_adjusted = is_pwm_rate_adjusted;
+#    ifdef LASER_RASTER
+        st_prep_block->raster_pixel_events = 0;
+#    endif
+        prep_segment->st_block_index = prep.st_block_index;
+    }
+    prep.arc_block_used = true;
+    memset(st_prep_block->steps, 0, sizeof(st_prep_block->steps));
+    for (idx = 0; idx < 3; idx++) {
+        st_prep_block->steps[axes[idx]] = labs(delta[idx]) << maxAmassLevel;
+        if (delta[idx] < 0) {
+            direction_bits |= bit(axes[idx]);
+        } else if (delta[idx] > 0) {
+            direction_bits &= ~bit(axes[idx]);
+        }
+    }
+    st_prep_block->direction_bits   = direction_bits;
+    st_prep_block->step_event_count = step_event_count << maxAmassLevel;
+#    ifdef DEFER_POSITION_UPDATES
+    st_block_set_divisor(st_prep_block);
+#    endif
+    memcpy(prep.arc_steps, steps, sizeof(steps));
+    return step_event_count;
+}
+#endif
+
+/* Prepares step segment buffer. Continuously called from main program and the segment prep task.
 
    The segment buffer is an intermediary buffer interface between the execution of steps
    by the stepper algorithm and the velocity profiles generated by the planner. The stepper
@@ -523,13 +1316,24 @@ static uint8_t st_next_block_index(uint8_t block_index) {
    Currently, the segment buffer conservatively holds roughly up to 40-50 msec of steps.
    NOTE: Computation units are in steps, millimeters, and minutes.
 */
-void st_prep_buffer() {
+static void prep_buffer() {
     // Block step prep buffer, while in a suspend state and there is no suspend motion to execute.
     if (sys.step_control.endMotion) {
         return;
     }
 
     while (segment_buffer_tail != segment_next_head) {  // Check if we need to fill the buffer.
+        // The main program is changing the plan. Leave it alone until it is done.
+        if (plan_update_pending()) {
+            return;
+        }
+        if (prep_replan) {
+            prep_replan = false;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (pl_block != NULL) {  // Ignore if at start of a new block.
+                prep_replan_block();
+            }
+        }
         // Determine if we need to load a new planner block or if the block needs to be recomputed.
         if (pl_block == NULL) {
             // Query planner for a queued block
@@ -557,6 +1361,11 @@ void st_prep_buffer() {
             } else {
                 // Load the Bresenham stepping data for the block.
                 prep.st_block_index = st_next_block_index(prep.st_block_index);
+#ifdef ENABLE_MOTION_STATS
+                if (!sys.step_control.executeSysMotion) {
+                    st_stats.planner_depth[plan_get_block_buffer_count() * PLANNER_DEPTH_BINS / BLOCK_BUFFER_SIZE]++;
+                }
+#endif
                 // Prepare and copy Bresenham algorithm segment data from the new planner block, so that
                 // when the segment buffer completes the planner block, it may be discarded when the
                 // segment buffer finishes the prepped block, but the stepper ISR is still executing it.
@@ -564,20 +1373,56 @@ void st_prep_buffer() {
                 st_prep_block->direction_bits = pl_block->direction_bits;
                 uint8_t idx;
                 auto    n_axis = number_axis->get();
+#ifdef LASER_RASTER
+                st_prep_block->raster_pixel_events = 0;
+#endif
 
-                // Bit-shift multiply all Bresenham data by the max AMASS level so that
-                // we never divide beyond the original data anywhere in the algorithm.
-                // If the original data is divided, we can lose a step from integer roundoff.
-                for (idx = 0; idx < n_axis; idx++) {
-                    st_prep_block->steps[idx] = pl_block->steps[idx] << maxAmassLevel;
-                }
-                st_prep_block->step_event_count = pl_block->step_event_count << maxAmassLevel;
+#ifdef PLANNER_ARCS
+                if (pl_block->motion.arcMotion) {
+                    // Each chord of the arc gets stepping data of its own, see prep_arc_chord().
+                    // Segments are sized by the finest step resolution of the arc axes.
+                    const uint8_t arc_axes[3] = { pl_block->arc.axis_0, pl_block->arc.axis_1, pl_block->arc.axis_linear };
+                    plan_arc_steps(pl_block, pl_block->millimeters, prep.arc_steps);
+                    prep.arc_block_used = false;
+                    prep.step_per_mm    = 0.0;
+                    for (idx = 0; idx < 3; idx++) {
+                        prep.step_per_mm = MAX(prep.step_per_mm, axis_settings[arc_axes[idx]]->steps_per_mm->get());
+                    }
+                } else
+#endif
+                {
+                    // Bit-shift multiply all Bresenham data by the max AMASS level so that
+                    // we never divide beyond the original data anywhere in the algorithm.
+                    // If the original data is divided, we can lose a step from integer roundoff.
+                    for (idx = 0; idx < n_axis; idx++) {
+                        st_prep_block->steps[idx] = pl_block->steps[idx] << maxAmassLevel;
+                    }
+                    st_prep_block->step_event_count = pl_block->step_event_count << maxAmassLevel;
+#ifdef DEFER_POSITION_UPDATES
+                    st_block_set_divisor(st_prep_block);
+#endif
 
-                // Initialize segment buffer data for generating the segments.
-                prep.steps_remaining  = (float)pl_block->step_event_count;
-                prep.step_per_mm      = prep.steps_remaining / pl_block->millimeters;
+                    // Initialize segment buffer data for generating the segments.
+                    prep.steps_remaining = (float)pl_block->step_event_count;
+                    prep.step_per_mm     = prep.steps_remaining / pl_block->millimeters;
+#ifdef LASER_RASTER
+                    if (pl_block->raster_pixels != 0) {
+                        uint64_t pixel_events              = ((uint64_t)pl_block->step_event_count << 16) / pl_block->raster_pixels;
+                        st_prep_block->raster_pixel_events = MAX(1, MIN(pixel_events, INT32_MAX));
+                        st_prep_block->raster_end          = pl_block->raster_start + pl_block->raster_pixels;
+                    }
+#endif
+                }
                 prep.req_mm_increment = REQ_MM_INCREMENT_SCALAR / prep.step_per_mm;
                 prep.dt_remainder     = 0.0;  // Reset for new segment block
+#ifdef S_CURVE_ACCELERATION
+                if (pl_block->entry_speed_sqr == 0.0 && !sys.step_control.executeHold) {
+                    // Start from rest. Otherwise the ramp carries on from the last block.
+                    prep.current_speed = 0.0;
+                    prep.current_accel = 0.0;
+                }
+                pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed;
+#else
                 if ((sys.step_control.executeHold) || prep.recalculate_flag.decelOverride) {
                     // New block loaded mid-hold. Override planner block entry speed to enforce deceleration.
                     prep.current_speed                  = prep.exit_speed;
@@ -586,6 +1431,7 @@ void st_prep_buffer() {
                 } else {
                     prep.current_speed = sqrt(pl_block->entry_speed_sqr);
                 }
+#endif
 
                 st_prep_block->is_pwm_rate_adjusted = false;  // set default value
                 // prep.inv_rate is only used if is_pwm_rate_adjusted is true
@@ -595,6 +1441,9 @@ void st_prep_buffer() {
                         prep.inv_rate                       = 1.0 / pl_block->programmed_rate;
                         st_prep_block->is_pwm_rate_adjusted = true;
                     }
+#ifdef LASER_POWER_PER_STEP
+                    prep.laser_power_max = spindle->power_levels();
+#endif
                 }
             }
             /* ---------------------------------------------------------------------------------
@@ -603,7 +1452,11 @@ void st_prep_buffer() {
              planner has updated it. For a commanded forced-deceleration, such as from a feed
              hold, override the planner velocities and decelerate to the target exit speed.
             */
-            prep.mm_complete  = 0.0;  // Default velocity profile complete at 0.0mm from end of block.
+            prep.mm_complete = 0.0;  // Default velocity profile complete at 0.0mm from end of block.
+#ifdef S_CURVE_ACCELERATION
+            // The jerk-limited ramps brake for the speed limits ahead by themselves. See s_curve_prep().
+            prep.maximum_speed = plan_compute_profile_nominal_speed(pl_block);
+#else
             float inv_2_accel = 0.5 / pl_block->acceleration;
             if (sys.step_control.executeHold) {  // [Forced Deceleration to Zero Velocity]
                 // Compute velocity profile parameters for a feed hold in-progress. This profile overrides
@@ -682,7 +1535,10 @@ void st_prep_buffer() {
                 }
             }
 
-            sys.step_control.updateSpindleRpm = true;  // Force update whenever updating block.
+#endif
+
+            // Force update whenever updating block.
+            sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = true; });
         }
 
         // Initialize new segment
@@ -708,16 +1564,34 @@ void st_prep_buffer() {
         float dt_max   = DT_SEGMENT;                                // Maximum segment time
         float dt       = 0.0;                                       // Initialize segment time
         float time_var = dt_max;                                    // Time worker variable
-        float mm_var;                                               // mm-Distance worker variable
-        float speed_var;                                            // Speed worker variable
+#ifndef S_CURVE_ACCELERATION
+        float mm_var;     // mm-Distance worker variable
+        float speed_var;  // Speed worker variable
+#endif
         float mm_remaining = pl_block->millimeters;                 // New segment distance from end of block.
         float minimum_mm   = mm_remaining - prep.req_mm_increment;  // Guarantee at least one step.
+#ifdef LASER_POWER_PER_STEP
+        float entry_speed = prep.current_speed;  // The laser power ramps from this speed to the exit speed
+#endif
 
         if (minimum_mm < 0.0) {
             minimum_mm = 0.0;
         }
+#ifdef PLANNER_ARCS
+        if (pl_block->motion.arcMotion) {
+            // Each segment of an arc is one chord. Keep it short enough for the arc tolerance at the
+            // highest speed it can reach.
+            float top_speed = MAX(prep.current_speed, prep.maximum_speed);
+            if (top_speed * dt_max > pl_block->arc.chord_mm) {
+                dt_max = time_var = pl_block->arc.chord_mm / top_speed;
+            }
+        }
+#endif
 
         do {
+#ifdef S_CURVE_ACCELERATION
+            time_var = s_curve_prep(time_var, &mm_remaining);
+#else
             switch (prep.ramp_type) {
                 case RAMP_DECEL_OVERRIDE:
                     speed_var = pl_block->acceleration * time_var;
@@ -782,6 +1656,7 @@ void st_prep_buffer() {
                     mm_remaining       = prep.mm_complete;
                     prep.current_speed = prep.exit_speed;
             }
+#endif
 
             dt += time_var;  // Add computed ramp time to total segment time.
             if (dt < dt_max) {
@@ -802,6 +1677,11 @@ void st_prep_buffer() {
           Compute spindle speed PWM output for step segment
         */
         if (st_prep_block->is_pwm_rate_adjusted || sys.step_control.updateSpindleRpm) {
+#ifdef LASER_POWER_PER_STEP
+            if (sys.step_control.updateSpindleRpm && spindle->inLaserMode()) {
+                prep.laser_power_max = spindle->power_levels();  // For a new spindle override
+            }
+#endif
             if (pl_block->spindle != SpindleState::Disable) {
                 float rpm = pl_block->spindle_speed;
                 // NOTE: Feed and rapid overrides are independent of PWM value and do not alter laser power/rate.
@@ -818,9 +1698,31 @@ void st_prep_buffer() {
                 sys.spindle_speed        = 0.0;
                 prep.current_spindle_rpm = 0.0;
             }
-            sys.step_control.updateSpindleRpm = false;
+            sys_update_step_control([](StepControl& control) { control.updateSpindleRpm = false; });
         }
         prep_segment->spindle_rpm = prep.current_spindle_rpm;  // Reload segment PWM value
+#ifdef LASER_POWER_PER_STEP
+        // Power levels of the laser ramp, at the entry and the exit speed of the segment
+        uint32_t laser_entry = 0;
+        uint32_t laser_exit  = 0;
+        if (st_prep_block->is_pwm_rate_adjusted && prep.laser_power_max != 0 && pl_block->spindle != SpindleState::Disable) {
+            float rpm_per_speed = pl_block->spindle_speed * prep.inv_rate;
+            float level_per_rpm = (LASER_POWER_LEVELS - 1) * 65536.0f / prep.laser_power_max;
+            float level_max     = (LASER_POWER_LEVELS - 1) * 65536.0f;
+            laser_entry         = fminf(entry_speed * rpm_per_speed * level_per_rpm, level_max);
+            laser_exit          = fminf(prep.current_speed * rpm_per_speed * level_per_rpm, level_max);
+            if (laser_entry != laser_exit) {
+                prep_segment->spindle_rpm = entry_speed * rpm_per_speed;  // The ISR ramps from here
+            }
+        }
+#    ifdef LASER_RASTER
+        if (st_prep_block->raster_pixel_events != 0 && !st_prep_block->is_pwm_rate_adjusted && prep.laser_power_max != 0 &&
+            pl_block->spindle != SpindleState::Disable) {
+            // Constant M3 power, which the ISR scales by the pixels of the scanline
+            laser_entry = laser_exit = fminf(pl_block->spindle_speed / prep.laser_power_max, 1.0f) * (LASER_POWER_LEVELS - 1) * 65536.0f;
+        }
+#    endif
+#endif
 
         /* -----------------------------------------------------------------------------------
            Compute segment step rate, steps to execute, and apply necessary rate corrections.
@@ -832,17 +1734,65 @@ void st_prep_buffer() {
            Fortunately, this scenario is highly unlikely and unrealistic in CNC machines
            supported by Grbl (i.e. exceeding 10 meters axis travel at 200 step/mm).
         */
-        float step_dist_remaining    = prep.step_per_mm * mm_remaining;             // Convert mm_remaining to steps
-        float n_steps_remaining      = ceil(step_dist_remaining);                   // Round-up current steps remaining
-        float last_n_steps_remaining = ceil(prep.steps_remaining);                  // Round-up last steps remaining
-        prep_segment->n_step         = last_n_steps_remaining - n_steps_remaining;  // Compute number of steps to execute.
+        float step_dist_remaining = 0.0;  // Arc chords end on a step, so these stay zero for them
+        float n_steps_remaining   = 0.0;
+        float step_events;  // Steps of the segment, including the partial step left by the last one
+#ifdef PLANNER_ARCS
+        if (pl_block->motion.arcMotion) {
+            prep_segment->n_step = prep_arc_chord(prep_segment, mm_remaining);
+            if (prep_segment->n_step == 0 && !sys.step_control.executeHold) {
+                // The chord is shorter than a step. Leave its time to the next one.
+                prep.dt_remainder += dt;
+                pl_block->millimeters     = mm_remaining;
+                pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed;
+                if (mm_remaining == prep.mm_complete) {  // No steps left at the end of the arc
+                    if (sys.step_control.executeSysMotion) {
+                        sys_update_step_control([](StepControl& control) { control.endMotion = true; });
+                        return;
+                    }
+                    pl_block = NULL;
+                    plan_discard_current_block();
+                }
+                continue;
+            }
+            step_events = prep_segment->n_step;
+        } else
+#endif
+        {
+            step_dist_remaining          = prep.step_per_mm * mm_remaining;             // Convert mm_remaining to steps
+            n_steps_remaining            = ceil(step_dist_remaining);                   // Round-up current steps remaining
+            float last_n_steps_remaining = ceil(prep.steps_remaining);                  // Round-up last steps remaining
+            prep_segment->n_step         = last_n_steps_remaining - n_steps_remaining;  // Compute number of steps to execute.
+            step_events                  = last_n_steps_remaining - step_dist_remaining;
+#ifdef LASER_RASTER
+            if (st_prep_block->raster_pixel_events != 0) {
+                // Step event e of the block is over pixel e * pixels / step_event_count of the scanline.
+                uint64_t events       = pl_block->step_event_count;
+                uint64_t pixels       = pl_block->raster_pixels;
+                uint64_t entry_events = events - (uint64_t)last_n_steps_remaining;
+                uint64_t entry_pixel  = entry_events * pixels / events;
+                prep_segment->raster_position = pl_block->raster_start + entry_pixel;
+                prep_segment->raster_next     = (((entry_pixel + 1) * events << 16) / pixels) - (entry_events << 16);
+                if (n_steps_remaining == 0.0) {
+                    prep_segment->raster_release = pl_block->raster_start + pixels;
+                } else {
+                    prep_segment->raster_release = pl_block->raster_start + (events - (uint64_t)n_steps_remaining) * pixels / events;
+                }
+            }
+#endif
+        }
 
         // Bail if we are at the end of a feed hold and don't have a step to execute.
         if (prep_segment->n_step == 0) {
             if (sys.step_control.executeHold) {
                 // Less than one step to decelerate to zero speed, but already very close. AMASS
                 // requires full steps to execute. So, just bail.
-                sys.step_control.endMotion = true;
+                sys_update_step_control([](StepControl& control) { control.endMotion = true; });
+#ifdef S_CURVE_ACCELERATION
+                prep.current_speed = 0.0;
+                prep.current_accel = 0.0;
+#endif
+                pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed;
 #ifdef PARKING_ENABLE
                 if (!(prep.recalculate_flag.parking)) {
                     prep.recalculate_flag.holdPartialBlock = 1;
@@ -863,7 +1813,7 @@ void st_prep_buffer() {
 
         dt += prep.dt_remainder;  // Apply previous segment partial step execute time
         // dt is in minutes so inv_rate is in minutes
-        float inv_rate = dt / (last_n_steps_remaining - step_dist_remaining);  // Compute adjusted step rate inverse
+        float inv_rate = dt / step_events;  // Compute adjusted step rate inverse
 
         // Compute CPU cycles per step for the prepped segment.
         // fStepperTimer is in units of timerTicks/sec, so the dimensional analysis is
@@ -880,6 +1830,10 @@ void st_prep_buffer() {
         }
         prep_segment->amass_level = level;
         prep_segment->n_step <<= level;
+#ifdef LASER_POWER_PER_STEP
+        prep_segment->laser_level = laser_entry;
+        prep_segment->laser_slope = ((int32_t)laser_exit - (int32_t)laser_entry) / (prep_segment->n_step ? prep_segment->n_step : 0x10000);
+#endif
         // isrPeriod is stored as 16 bits, so limit timerTicks to the
         // largest value that will fit in a uint16_t.
         prep_segment->isrPeriod = timerTicks > 0xffff ? 0xffff : timerTicks;
@@ -889,10 +1843,12 @@ void st_prep_buffer() {
         if (++segment_next_head == SEGMENT_BUFFER_SIZE) {
             segment_next_head = 0;
         }
-        // Update the appropriate planner and segment data.
-        pl_block->millimeters = mm_remaining;
-        prep.steps_remaining  = n_steps_remaining;
-        prep.dt_remainder     = (n_steps_remaining - step_dist_remaining) * inv_rate;
+        // Update the appropriate planner and segment data. The planner takes the entry speed and the
+        // distance left as the state of the executing block when it replans.
+        pl_block->millimeters     = mm_remaining;
+        pl_block->entry_speed_sqr = prep.current_speed * prep.current_speed;
+        prep.steps_remaining      = n_steps_remaining;
+        prep.dt_remainder         = (n_steps_remaining - step_dist_remaining) * inv_rate;
         // Check for exit conditions and flag to load next planner block.
         if (mm_remaining == prep.mm_complete) {
             // End of planner block or forced-termination. No more distance to be executed.
@@ -900,7 +1856,7 @@ void st_prep_buffer() {
                 // Reset prep parameters for resuming and then bail. Allow the stepper ISR to complete
                 // the segment queue, where realtime protocol will set new state upon receiving the
                 // cycle stop flag from the ISR. Prep_segment is blocked until then.
-                sys.step_control.endMotion = true;
+                sys_update_step_control([](StepControl& control) { control.endMotion = true; });
 #ifdef PARKING_ENABLE
                 if (!(prep.recalculate_flag.parking)) {
                     prep.recalculate_flag.holdPartialBlock = 1;
@@ -910,7 +1866,7 @@ void st_prep_buffer() {
             } else {     // End of planner block
                 // The planner block is complete. All steps are set to be executed in the segment buffer.
                 if (sys.step_control.executeSysMotion) {
-                    sys.step_control.endMotion = true;
+                    sys_update_step_control([](StepControl& control) { control.endMotion = true; });
                     return;
                 }
                 pl_block = NULL;  // Set pointer to indicate check and load next planner block.
@@ -920,6 +1876,51 @@ void st_prep_buffer() {
     }
 }
 
+void st_prep_buffer() {
+    st_prep_lock();
+    prep_busy = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);  // Set before prep_buffer() checks for a plan update
+    prep_buffer();
+    std::atomic_thread_fence(std::memory_order_release);
+    prep_busy = false;
+    st_prep_unlock();
+}
+
+// Either the planner sees prep_busy set here, and waits for it to clear, or the segment prep sees
+// the update pending and returns before it reads the plan again.
+void st_prep_wait() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (prep_busy) {}
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+#ifdef ENABLE_MOTION_STATS
+void st_stats_reset() {
+    memset(&st_stats, 0, sizeof(st_stats_t));
+    st_stats.min_segments = SEGMENT_BUFFER_SIZE;
+}
+#endif
+
+// Copies the real-time machine position in steps. With DEFER_POSITION_UPDATES, sys_position lags
+// by the steps of the executing segment, which are added from the Bresenham counters.
+// NOTE: Safe to call from the stepper ISR, e.g. the probe state monitor.
+void st_get_position(int32_t* position) {
+#ifdef DEFER_POSITION_UPDATES
+    uint32_t seq;
+    do {
+        seq = position_seq;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        memcpy(position, sys_position, sizeof(sys_position));
+        if (st.exec_segment != NULL) {
+            add_segment_steps(position, segment_step_events());
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((seq & 1) || seq != position_seq);
+#else
+    memcpy(position, sys_position, sizeof(sys_position));
+#endif
+}
+
 // Called by realtime status reporting to fetch the current speed being executed. This value
 // however is not exactly the current speed, but the speed computed in the last step segment
 // in the segment buffer. It will always be behind by up to the number of segment blocks (-1)
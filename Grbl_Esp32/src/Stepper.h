@@ -93,6 +93,25 @@ enum stepper_id_t {
 extern const char*  stepper_names[];
 extern stepper_id_t current_stepper;
 
+#ifdef ENABLE_MOTION_STATS
+const int PLANNER_DEPTH_BINS = 8;  // Each bin covers 1/8 of the planner buffer
+
+// Motion performance counters. Kept until cleared by st_stats_reset().
+// NOTE: Underruns only count a segment buffer running dry while motion remains to be prepped,
+// not the normal drain at the end of a motion or a feed hold.
+typedef struct {
+    uint32_t underruns;                          // Segment buffer ran empty in the middle of a motion
+    uint32_t underrun_line;                      // Line number of the planner block at the last underrun
+    uint8_t  min_segments;                       // Fewest segments queued when the ISR loaded one
+    uint32_t planner_depth[PLANNER_DEPTH_BINS];  // Planner buffer fill, sampled as each block is prepped
+    uint32_t max_isr_latency;                    // Stepper timer ticks from the alarm to the ISR running
+    uint32_t max_isr_time;                       // Stepper timer ticks spent in the ISR
+} st_stats_t;
+extern st_stats_t st_stats;
+
+void st_stats_reset();
+#endif
+
 // -- Task handles for use in the notifications
 void IRAM_ATTR onSteppertimer();
 void IRAM_ATTR onStepperOffTimer();
@@ -118,9 +137,20 @@ void st_parking_restore_buffer();
 // Reloads step segment buffer. Called continuously by realtime execution system.
 void st_prep_buffer();
 
-// Called by planner_recalculate() when the executing block is updated by the new plan.
+// Refills the step segment buffer on MOTION_TASK_CORE when USE_SEGMENT_PREP_TASK is enabled.
+void segmentPrepTask(void* pvParameters);
+
+// Called by planner_recalculate() when the executing block is updated by the new plan. Flags the
+// segment prep to recompute its velocity profile before its next segment.
 void st_update_plan_block_parameters();
 
+// Called by the planner when it starts to change the plan. Returns once the segment prep is done
+// with the segment it is working on. The prep doesn't start another one until the change is done.
+void st_prep_wait();
+
+// Copies the real-time machine position in steps, including the executing segment.
+void st_get_position(int32_t* position);
+
 // Called by realtime status reporting if realtime rate reporting is enabled in config.h.
 float st_get_realtime_rate();
 
@@ -160,6 +160,16 @@ uint8_t system_check_safety_door_ajar() {
 #endif
 }
 
+static portMUX_TYPE step_control_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+void sys_update_step_control(void (*update)(StepControl& control)) {
+    portENTER_CRITICAL(&step_control_spinlock);
+    StepControl control = sys.step_control;
+    update(control);
+    sys.step_control = control;
+    portEXIT_CRITICAL(&step_control_spinlock);
+}
+
 void system_flag_wco_change() {
 #ifdef FORCE_BUFFER_SYNC_DURING_WCO_CHANGE
     protocol_buffer_synchronize();
@@ -187,7 +197,9 @@ void system_convert_array_steps_to_mpos(float* position, int32_t* steps) {
 }
 float* system_get_mpos() {
     static float position[MAX_N_AXIS];
-    system_convert_array_steps_to_mpos(position, sys_position);
+    int32_t      steps[MAX_N_AXIS];
+    st_get_position(steps);
+    system_convert_array_steps_to_mpos(position, steps);
     return position;
 };
 
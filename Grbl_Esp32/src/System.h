@@ -145,6 +145,10 @@ extern volatile bool sys_rt_exec_debug;
 
 void system_ini();  // Renamed from system_init() due to conflict with esp32 files
 
+// Changes sys.step_control by a read-modify-write that update does on a copy of it. Both the main
+// program and the segment prep task change its bits, so every write must go through here.
+void sys_update_step_control(void (*update)(StepControl& control));
+
 // Returns bitfield of control pin states, organized by CONTROL_PIN_INDEX. (1=triggered, 0=not triggered).
 ControlPins system_control_get_state();
 
@@ -11,7 +11,11 @@
 #include "soc/dport_reg.h"
 #include "soc/rtc.h"
 
-Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1) {}
+Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1), _rx_events(false), _event_queue(NULL) {}
+
+void Uart::enableRxEvents() {
+    _rx_events = true;
+}
 
 void Uart::begin(unsigned long baudrate, Data dataBits, Stop stopBits, Parity parity) {
     //    uart_driver_delete(_uart_num);
@@ -26,7 +30,35 @@ void Uart::begin(unsigned long baudrate, Data dataBits, Stop stopBits, Parity pa
     if (uart_param_config(_uart_num, &conf) != ESP_OK) {
         return;
     };
-    uart_driver_install(_uart_num, 256, 0, 0, NULL, 0);
+    if (!_rx_events) {
+        uart_driver_install(_uart_num, 256, 0, 0, NULL, 0);
+        return;
+    }
+    // The driver posts an event to the queue when it has moved received bytes to its buffer
+    uart_driver_install(_uart_num, 256, 0, 20, &_event_queue, 0);
+    // The default is to wait for 120 bytes or 10 idle character times. A waiting task should see
+    // a single realtime character as soon as it has been received.
+    uart_intr_config_t intr;
+    intr.intr_enable_mask = UART_RXFIFO_FULL_INT_ENA_M | UART_RXFIFO_TOUT_INT_ENA_M | UART_FRM_ERR_INT_ENA_M |
+                            UART_RXFIFO_OVF_INT_ENA_M | UART_BRK_DET_INT_ENA_M | UART_PARITY_ERR_INT_ENA_M;
+    intr.rxfifo_full_thresh       = 120;
+    intr.rx_timeout_thresh        = 1;
+    intr.txfifo_empty_intr_thresh = 10;
+    uart_intr_config(_uart_num, &intr);
+}
+
+// Sleeps until the UART has received data, or for at most timeout ticks. Returns true if there
+// is data to read. Needs enableRxEvents().
+bool Uart::waitForRx(TickType_t timeout) {
+    if (available()) {
+        return true;
+    }
+    if (_event_queue == NULL) {
+        vTaskDelay(timeout);
+        return available();
+    }
+    uart_event_t event;
+    return xQueueReceive(_event_queue, &event, timeout) == pdTRUE && available();
 }
 
 int Uart::available() {
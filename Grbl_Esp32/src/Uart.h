@@ -4,8 +4,10 @@
 
 class Uart : public Stream {
 private:
-    uart_port_t _uart_num;
-    int         _pushback;
+    uart_port_t   _uart_num;
+    int           _pushback;
+    bool          _rx_events;
+    QueueHandle_t _event_queue;
 
 public:
     enum class Data : int {
@@ -30,7 +32,9 @@ public:
     Uart(int uart_num);
     bool          setHalfDuplex();
     bool          setPins(int tx_pin, int rx_pin, int rts_pin = -1, int cts_pin = -1);
+    void          enableRxEvents();  // Call before begin() to use waitForRx()
     void          begin(unsigned long baud, Data dataBits, Stop stopBits, Parity parity);
+    bool          waitForRx(TickType_t timeout);
     int           available(void) override;
     int           read(void) override;
     int           read(TickType_t timeout);
@@ -53,6 +53,7 @@ namespace WebUI {
             case ESP_SPP_CLOSE_EVT:  //Client connection closed
                 grbl_send(CLIENT_ALL, "[MSG:BT Disconnected]\r\n");
                 BTConfig::_btclient = "";
+                report_status_unsubscribe(CLIENT_BT);
                 break;
             default:
                 break;
@@ -20,6 +20,7 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include "../Config.h"
 #include <Print.h>
 #include <cstring>
 
@@ -49,7 +50,7 @@ namespace WebUI {
         ~InputBuffer();
 
     private:
-        static const int RXBUFFERSIZE = 256;
+        static const int RXBUFFERSIZE = RX_BUFFER_SIZE;
 
         uint8_t  _RXbuffer[RXBUFFERSIZE];
         uint16_t _RXbufferSize;
@@ -20,6 +20,7 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include "../Config.h"
 #include <Print.h>
 #include <cstring>
 
@@ -28,7 +29,7 @@ class WebSocketsServer;
 namespace WebUI {
     class Serial_2_Socket : public Print {
         static const int TXBUFFERSIZE = 1200;
-        static const int RXBUFFERSIZE = 256;
+        static const int RXBUFFERSIZE = RX_BUFFER_SIZE;
         static const int FLUSHTIMEOUT = 500;
 
     public:
@@ -67,6 +67,7 @@ namespace WebUI {
     }
 
     void Telnet_Server::end() {
+        report_status_unsubscribe(CLIENT_TELNET);
         _setupdone    = false;
         _RXbufferSize = 0;
         _RXbufferpos  = 0;
@@ -88,6 +89,7 @@ namespace WebUI {
 #    endif
                     if (_telnetClients[i]) {
                         _telnetClients[i].stop();
+                        report_status_unsubscribe(CLIENT_TELNET);
                     }
                     _telnetClients[i] = _telnetserver->available();
                     break;
@@ -161,6 +163,7 @@ namespace WebUI {
                     _telnetClientsIP[i] = IPAddress(0, 0, 0, 0);
 #    endif
                     _telnetClients[i].stop();
+                    report_status_unsubscribe(CLIENT_TELNET);
                 }
             }
             COMMANDS::wait(0);
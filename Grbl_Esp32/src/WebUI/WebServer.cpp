@@ -1572,6 +1572,8 @@ namespace WebUI {
         switch (type) {
             case WStype_DISCONNECTED:
                 //USE_SERIAL.printf("[%u] Disconnected!\n", num);
+                // The web sockets share one client, so a subscription may be this one's
+                report_status_unsubscribe(CLIENT_WEBUI);
                 break;
             case WStype_CONNECTED: {
                 IPAddress ip = _socket_server->remoteIP(num);
@@ -673,12 +673,12 @@ namespace WebUI {
     }
 
 #ifdef ENABLE_SD_CARD
-    static Error openSDFile(char* parameter) {
+    static Error getSDPath(char* parameter, String& path) {
         if (*parameter == '\0') {
             webPrintln("Missing file name!");
             return Error::InvalidValue;
         }
-        String path = trim(parameter);
+        path = trim(parameter);
         if (path[0] != '/') {
             path = "/" + path;
         }
@@ -692,6 +692,19 @@ namespace WebUI {
                 return Error::FsFailedBusy;
             }
         }
+        return Error::Ok;
+    }
+    static Error openSDFile(char* parameter, bool use_compiled = false) {
+        String path;
+        Error  err;
+        if ((err = getSDPath(parameter, path)) != Error::Ok) {
+            return err;
+        }
+#    ifdef ENABLE_SD_COMPILE
+        if (use_compiled && sd_open_compiled(SD, path.c_str())) {
+            return Error::Ok;
+        }
+#    endif
         if (!openFile(SD, path.c_str())) {
             report_status_message(Error::FsFailedRead, (espresponse) ? espresponse->client() : CLIENT_ALL);
             webPrintln("");
@@ -727,9 +740,17 @@ namespace WebUI {
             webPrintln("Busy");
             return Error::IdleError;
         }
-        if ((err = openSDFile(parameter)) != Error::Ok) {
+        if ((err = openSDFile(parameter, true)) != Error::Ok) {
             return err;
         }
+        if (SD_compiled_job) {
+            // The job may start with motion records, which Protocol.cpp runs
+            SD_client     = (espresponse) ? espresponse->client() : CLIENT_ALL;
+            SD_auth_level = auth_level;
+            SD_ready_next = true;
+            webPrintln("");
+            return Error::Ok;
+        }
         char fileLine[255];
         if (!readFileLine(fileLine, 255)) {
             //No need notification here it is just a macro
@@ -746,6 +767,24 @@ namespace WebUI {
         return Error::Ok;
     }
 
+#    ifdef ENABLE_SD_COMPILE
+    static Error compileSDFile(char* parameter, AuthenticationLevel auth_level) {  // ESP222
+        if (sys.state != State::Idle) {
+            webPrintln("Busy");
+            return Error::IdleError;
+        }
+        String path;
+        Error  err;
+        if ((err = getSDPath(parameter, path)) != Error::Ok) {
+            return err;
+        }
+        err = sd_compile_file(SD, path.c_str(), (espresponse) ? espresponse->client() : CLIENT_ALL);
+        SD.end();
+        webPrintln("");
+        return err;
+    }
+#    endif
+
     static Error deleteSDObject(char* parameter, AuthenticationLevel auth_level) {  // ESP215
         parameter = trim(parameter);
         if (*parameter == '\0') {
@@ -1079,6 +1118,9 @@ namespace WebUI {
         new WebCommand(NULL, WEBCMD, WU, "ESP400", "WebUI/List", listSettings, anyState);
 #endif
 #ifdef ENABLE_SD_CARD
+#    ifdef ENABLE_SD_COMPILE
+        new WebCommand("path", WEBCMD, WU, "ESP222", "SD/Compile", compileSDFile);
+#    endif
         new WebCommand("path", WEBCMD, WU, "ESP221", "SD/Show", showSDFile);
         new WebCommand("path", WEBCMD, WU, "ESP220", "SD/Run", runSDFile);
         new WebCommand("file_or_directory_path", WEBCMD, WU, "ESP215", "SD/Delete", deleteSDObject);
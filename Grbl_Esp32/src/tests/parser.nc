@@ -152,6 +152,7 @@ g61.1
 g62
 g63
 g64
+g61
 g65
 g66
 g67
@@ -251,3 +252,23 @@ m63 p0
 m63 p1
 m63 p4
 m63 p5
+
+g7 x1 d00ff
+$32=1
+g7 d00ff
+g7 x1
+g7 x1 y1 d00ff
+g7 x1 d0g
+g7 x1 d00*00
+g7 x0.5 f100 d00ff10*0410
+g7 x0 d00ff
+g1 x1 d00
+$g
+$32=0
+$Spindle/PWM/Curve=5000:18,12000:42,24000:100
+$Spindle/PWM/Curve
+$Spindle/PWM/Curve=5000:18
+$Spindle/PWM/Curve=12000:42,5000:18
+$Spindle/PWM/Curve=5000:18,24000:120
+$Spindle/PWM/Curve=5000,24000
+$Spindle/PWM/Curve=
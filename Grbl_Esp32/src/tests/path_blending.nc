@@ -0,0 +1,201 @@
+; G64 path blending of a finely tessellated path, as CAM output has it. The steps must stay
+; within the G64 tolerance of the programmed chords (check.sh runs it with -g).
+G21 G90 G17
+G0 X0 Y0
+G64 P0.05
+G1 F1500
+X0.500 Y0.416
+X1.000 Y0.829
+X1.500 Y1.237
+X2.000 Y1.636
+X2.500 Y2.024
+X3.000 Y2.397
+X3.500 Y2.754
+X4.000 Y3.092
+X4.500 Y3.408
+X5.000 Y3.701
+X5.500 Y3.968
+X6.000 Y4.207
+X6.500 Y4.418
+X7.000 Y4.597
+X7.500 Y4.745
+X8.000 Y4.860
+X8.500 Y4.941
+X9.000 Y4.987
+X9.500 Y5.000
+X10.000 Y4.977
+X10.500 Y4.920
+X11.000 Y4.829
+X11.500 Y4.704
+X12.000 Y4.546
+X12.500 Y4.358
+X13.000 Y4.138
+X13.500 Y3.890
+X14.000 Y3.615
+X14.500 Y3.315
+X15.000 Y2.992
+X15.500 Y2.649
+X16.000 Y2.286
+X16.500 Y1.908
+X17.000 Y1.517
+X17.500 Y1.115
+X18.000 Y0.706
+X18.500 Y0.291
+X19.000 Y-0.125
+X19.500 Y-0.541
+X20.000 Y-0.953
+X20.500 Y-1.358
+X21.000 Y-1.754
+X21.500 Y-2.138
+X22.000 Y-2.506
+X22.500 Y-2.858
+X23.000 Y-3.189
+X23.500 Y-3.499
+X24.000 Y-3.784
+X24.500 Y-4.043
+X25.000 Y-4.274
+X25.500 Y-4.475
+X26.000 Y-4.645
+X26.500 Y-4.783
+X27.000 Y-4.888
+X27.500 Y-4.958
+X28.000 Y-4.995
+X28.500 Y-4.996
+X29.000 Y-4.963
+X29.500 Y-4.896
+X30.000 Y-4.795
+X30.500 Y-4.660
+X31.000 Y-4.493
+X31.500 Y-4.295
+X32.000 Y-4.067
+X32.500 Y-3.810
+X33.000 Y-3.528
+X33.500 Y-3.221
+X34.000 Y-2.891
+X34.500 Y-2.541
+X35.000 Y-2.174
+X35.500 Y-1.792
+X36.000 Y-1.397
+X36.500 Y-0.993
+X37.000 Y-0.581
+X37.500 Y-0.166
+X38.000 Y0.251
+X38.500 Y0.665
+X39.000 Y1.076
+X39.500 Y1.478
+X40.000 Y1.871
+X40.500 Y2.250
+X41.000 Y2.614
+X41.500 Y2.960
+X42.000 Y3.285
+X42.500 Y3.587
+X43.000 Y3.865
+X43.500 Y4.115
+X44.000 Y4.337
+X44.500 Y4.529
+X45.000 Y4.690
+X45.500 Y4.818
+X46.000 Y4.913
+X46.500 Y4.973
+X47.000 Y4.999
+X47.500 Y4.990
+X48.000 Y4.947
+X48.500 Y4.869
+X49.000 Y4.758
+X49.500 Y4.613
+X50.000 Y4.436
+X50.500 Y4.229
+X51.000 Y3.992
+X51.500 Y3.728
+X52.000 Y3.438
+X52.500 Y3.124
+X53.000 Y2.788
+X53.500 Y2.433
+X54.000 Y2.061
+X54.500 Y1.674
+X55.000 Y1.276
+X55.500 Y0.869
+X56.000 Y0.457
+X56.500 Y0.041
+X57.000 Y-0.376
+X57.500 Y-0.789
+X58.000 Y-1.198
+X58.500 Y-1.598
+X59.000 Y-1.986
+X59.500 Y-2.361
+X60.000 Y-2.720
+X60 Y20
+X59.962 Y20.872
+X59.848 Y21.736
+X59.659 Y22.588
+X59.397 Y23.420
+X59.063 Y24.226
+X58.660 Y25.000
+X58.192 Y25.736
+X57.660 Y26.428
+X57.071 Y27.071
+X56.428 Y27.660
+X55.736 Y28.192
+X55.000 Y28.660
+X54.226 Y29.063
+X53.420 Y29.397
+X52.588 Y29.659
+X51.736 Y29.848
+X50.872 Y29.962
+X50.000 Y30.000
+X49.128 Y29.962
+X48.264 Y29.848
+X47.412 Y29.659
+X46.580 Y29.397
+X45.774 Y29.063
+X45.000 Y28.660
+X44.264 Y28.192
+X43.572 Y27.660
+X42.929 Y27.071
+X42.340 Y26.428
+X41.808 Y25.736
+X41.340 Y25.000
+X40.937 Y24.226
+X40.603 Y23.420
+X40.341 Y22.588
+X40.152 Y21.736
+X40.038 Y20.872
+X40.000 Y20.000
+X40.038 Y19.128
+X40.152 Y18.264
+X40.341 Y17.412
+X40.603 Y16.580
+X40.937 Y15.774
+X41.340 Y15.000
+X41.808 Y14.264
+X42.340 Y13.572
+X42.929 Y12.929
+X43.572 Y12.340
+X44.264 Y11.808
+X45.000 Y11.340
+X45.774 Y10.937
+X46.580 Y10.603
+X47.412 Y10.341
+X48.264 Y10.152
+X49.128 Y10.038
+X50.000 Y10.000
+X50.872 Y10.038
+X51.736 Y10.152
+X52.588 Y10.341
+X53.420 Y10.603
+X54.226 Y10.937
+X55.000 Y11.340
+X55.736 Y11.808
+X56.428 Y12.340
+X57.071 Y12.929
+X57.660 Y13.572
+X58.192 Y14.264
+X58.660 Y15.000
+X59.063 Y15.774
+X59.397 Y16.580
+X59.659 Y17.412
+X59.848 Y18.264
+X59.962 Y19.128
+X60.000 Y20.000
+G61
+G0 X0 Y0
@@ -0,0 +1,2398 @@
+$32=1
+G0 X0 Y0
+M3 S255
+G1 F1000
+G0 X71 Y0.333
+G7 X-0.3333333 D2B412B192E25131B1411121124233A4024201C291D16201514180D1A2626302A3D463C432C2C2F252A3C2230463C3A2614191935212E4127113A445841494337272D36324D2F272F2E243B261A2C31
+G0 X44.667 Y0.667
+G7 X0.3333333 D34473B517C5F394E515373665755305B8E978A7B46542A3F70504C39282A43756A574A47594F516E572D56525A696E6E37181B273B40302025425064331F2F4B3D2C2C331D31332A38442D2D464D20
+G0 X70.667 Y1
+G7 X-0.3333333 D061D32361D1C1F23292E3E170F162B3726325540432F31252922472910205E554330316F414944212945383E3E7B8E4D302B2E4553572B2440444C6264636131583C525C495C5F56604526545014
+G0 X44.667 Y1.333
+G7 X0.3333333 D03332E152E2B2C4D4E4D494D3D404F5B413637505F4023213B3D67323C342D4E522B202528323C21234F5E4031343022282930371E2427352D1C1A1E222D221E1B1A1324433C422614151A0B
+G0 X68.667 Y1.667
+G7 X-0.3333333 D041612120D111D101D221D1B1519201F130F372D19251E392D2E332638252827263C2E21242836242627476C3A5E5F361D322452464D55512D1B34413C3C3D42341D354A291912
+G0 X45 Y2
+G7 X0.3333333 D04283B443845483728384537303C475D4D322E371F22254F402339695C4524112724232027241F18473526242F25363721190E263C1D2B1C24341D0B03
+G0 X64.667 Y2.333
+G7 X-0.3333333 D031C34361F1B2119241B29202927242E1C1B2F1D2A3326201D241B0929424543372F42372F1B3A2D3632324241564C2A3A2A2925443B3E353309
+G0 X45.667 Y2.667
+G7 X0.3333333 D22543F3037292B37392A37554F3A21243A2B3D2F353D392F272B3533272E232844503943342E1F131D21232A2811171D2514292C4A8050
+G0 X64 Y3
+G7 X-0.3333333 D60A686652C1E151A1627362D1B1E191A282D2B30384844362941283335312C2A42413A37322A392F2A2B363B3A2D4836322C28302A0E
+G0 X46.667 Y3.333
+G7 X0.3333333 D0D1A20272D392336242F3F452F2D2A2129342A3423263A342E32432F2C282B1D23272B2A1423322C2D3238203353344A7574933B
+G0 X64 Y3.667
+G7 X-0.3333333 D06747E79625F817777616B5A45373B1F2C191F2D2B241A1A212A2B2C2E2C25212023302220272B2527221B191C10100B07
+G0 X51 Y4
+G7 X0.3333333 D010C25443D4D5650895F718E606B5043403B40533C352F68574A6A739177978A779672859144
+G0 X63.667 Y4.333
+G7 X-0.3333333 D037B957797917D736D996C76724B825049687B7F6657829DA58AA46E7199887A9A9D7B09
+G0 X51.667 Y4.667
+G7 X0.3333333 D3DB4BF9C8B99908C737990A7AFA45C7DA4775C4F589871577E7B807F91A1928881780E
+G0 X63 Y5
+G7 X-0.3333333 D0D6A7E929782746C808B5878A66B4849567C828194908A89836C8F8D9696A6ADBA30
+G0 X51.667 Y5.333
+G7 X0.3333333 D049FBEA18B9C938C848BA59692B39B8276482E506B978282846B73707C8671650F
+G0 X62.333 Y5.667
+G7 X-0.3333333 D307C84887366626B7F999B6E603843568FA5B49B9C9F6E8BA08E9C9B9CB297
+G0 X52 Y6
+G7 X0.3333333 D6EA194A7988AA78D65999C9BB3997046626D7A69979F7F7E765B898882740A
+G0 X62 Y6.333
+G7 X-0.3333333 D54777B876375877C949E5C718880585D769B9E9C8458A99F879898A0A520
+G0 X52.333 Y6.667
+G7 X0.3333333 D318AA0A7A08DAE88739C8C74545F82937A5E6A9290918F6058796C6C3B
+G0 X62 Y7
+G7 X-0.3333333 D2C62647F5A4965869B9972586A857C5962788B8F8AB5A4A5B69A1D
+G0 X53.333 Y7.333
+G7 X0.3333333 D52C2B0B7B7A0969F8275745C606E5C7EAE8C6D595662786B6F2C
+G0 X62 Y7.667
+G7 X-0.3333333 D2C776A776F796E7182A69E6B73655774859BAAA5ABB7B2AD9D0E
+G0 X53.667 Y8
+G7 X0.3333333 D6FB9B5B2ACA3A09E9170465F74759FA29186816B686B706F10
+G0 X62 Y8.333
+G7 X-0.3333333 D0360716F6B65697A90A19A80834E5B748D9F9B9FAFB5B6B434
+G0 X53.667 Y8.667
+G7 X0.3333333 D0499B3B7B39E9D9F9C7E584F89859EA18C7353626B626257
+G0 X61.667 Y9
+G7 X-0.3333333 D59645D645D4E7D8CA59D877B5B5D7C9D9A98A5B3AFB471
+G0 X54 Y9.333
+G7 X0.3333333 D3FB8B5B6B99B97A07A4A5877839DA08082515C6B6C685A
+G0 X62 Y9.667
+G7 X-0.3333333 D05575C6D7363638891AC987A7C6D5A90AEA39BB3B0B9BB1F
+G0 X54 Y10
+G7 X0.3333333 D0DAEB3A6B19896A29B6F5B8B9091B197866A65746C6149
+G0 X61.667 Y10.333
+G7 X-0.3333333 D41656B716C70829BBA8C84884A7893AC9E9EB1A9B29F01
+G0 X54.333 Y10.667
+G7 X0.3333333 D9BB1ADB5ACA3A38B8049858793B095876F6B6D6C5F40
+G0 X61.667 Y11
+G7 X-0.3333333 D39646D6F78828298A59695695E978A889CB0B4ADAE8C
+G0 X54.333 Y11.333
+G7 X0.3333333 D8CB0AEB4B4A58B89956D5490889C9D8B827A6D6E6F32
+G0 X61.667 Y11.667
+G7 X-0.3333333 D296476808485849E97828B5371878495ADB7AEB5B5B60D
+G0 X54 Y12
+G7 X0.3333333 D34B8AFB1B1BAB29987858053879893A4968B817B696022
+G0 X61.667 Y12.333
+G7 X-0.3333333 D18605F71747A91A595A97F6A7C78819EB2B7ABABACB41F
+G0 X54.333 Y12.667
+G7 X0.3333333 D6CACA4A6B4B2A490847E6B71A298A18F60566959540D
+G0 X61.667 Y13
+G7 X-0.3333333 D0555616A535F7F97968D82646D7E94ACB7B5A49CAD3C
+G0 X54.333 Y13.333
+G7 X0.3333333 D1EA89AA0AFBAB3947B68678A757E9D8B706160674B04
+G0 X61.667 Y13.667
+G7 X-0.3333333 D04546D56667FA09A78787B5E6284A7B1BAAB9F9C9E10
+G0 X54.333 Y14
+G7 X0.3333333 D089CA4A0ACBAB5B2875E5B7D877C92A27A6468714F02
+G0 X61.333 Y14.333
+G7 X-0.3333333 D527B775F7EA58F7D676560637AA5BAC5B39E9F8E
+G0 X54.667 Y14.667
+G7 X0.3333333 D7CA59FAFC1BE9F81696878716783A7865B717957
+G0 X61.333 Y15
+G7 X-0.3333333 D536E6D607F9F7D687A7C79827F99BDB8A9A1AD71
+G0 X54.667 Y15.333
+G7 X0.3333333 D63A89D9EADBCA3938481846C747D977A596B6E56
+G0 X61.333 Y15.667
+G7 X-0.3333333 D46705D5384A48B7C668B8E98A2ACC0AB9FA1A64F
+G0 X54.667 Y16
+G7 X0.3333333 D4AB19DA6ADB7AA968786766A768C9B9063656A39
+G0 X61.333 Y16.333
+G7 X-0.3333333 D3C7666768E83796363748E939BAFB09EA099AB3A
+G0 X54.667 Y16.667
+G7 X0.3333333 D20A497A7A7B6B09F9594744653636C8A757D8248
+G0 X61.333 Y17
+G7 X-0.3333333 D4F757B8483666E5755729099A0B1B5B0AE979D0D
+G0 X55 Y17.333
+G7 X0.3333333 D90A9AFAEACB8A19D95645D7A6C70938873724F
+G0 X61.333 Y17.667
+G7 X-0.3333333 D56797E8E977C83754C6795A4ABB1A4A7A5A97B
+G0 X55 Y18
+G7 X0.3333333 D67A99DA8AAACACA3836E525C827993997B777801
+G0 X61.667 Y18.333
+G7 X-0.3333333 D168C77708FA284605260828E9BA9B1A9AA9BA651
+G0 X55 Y18.667
+G7 X0.3333333 D41A69AA7A5AEAD95988665546484A18F71777C29
+G0 X61.667 Y19
+G7 X-0.3333333 D3270707B8A9584697778919BA2B1A898A29FAB32
+G0 X55 Y19.333
+G7 X0.3333333 D1CA0A4A4A2B2B2A589867B75658C8F86737C724F
+G0 X61.667 Y19.667
+G7 X-0.3333333 D7185807B75788B746D719197A3B1B3A7AC9A9C0F
+G0 X55 Y20
+G7 X0.3333333 D01919DA7A6B3AC9E9F937B756B807C7A897C6F860B
+G0 X62 Y20.333
+G7 X-0.3333333 D157D6B837A808384696D85A39E9BB3B3A3A4A987
+G0 X55.333 Y20.667
+G7 X0.3333333 D7AB5ACA9B2B4A19E9D6B696C7A847C8384727725
+G0 X62 Y21
+G7 X-0.3333333 D2B888EA1A598857373746C9DA0A5B7B5ABABB576
+G0 X55.333 Y21.333
+G7 X0.3333333 D78A7A2AEB6B8A7A6A67B6F747999A78E8A959632
+G0 X62 Y21.667
+G7 X-0.3333333 D3F8D73728A939C7B765B7FA1A3AEBCBEADA2A29103
+G0 X55 Y22
+G7 X0.3333333 D4DAA9EA3AFC5C2B2A19866538D888A7F857265734A
+G0 X62.333 Y22.333
+G7 X-0.3333333 D0151828C845F6C8D8F875768949EBEBFB8B49D999D9F0C
+G0 X54.667 Y22.667
+G7 X0.3333333 D78AD9497AEBAB9B8BC999770696878895F5D8D7E756630
+G0 X62.333 Y23
+G7 X-0.3333333 D30636E5B8A79716C5D5F6262989CB8BBC4C0AD95929AB369
+G0 X54 Y23.333
+G7 X0.3333333 D4DB29891878DAEC2C9BFB995936364575E5A6B869D5570690B
+G0 X62 Y23.667
+G7 X-0.3333333 D22786597A265625D596B77989EB6C2CBC6B49586A599A2B541
+G0 X53.333 Y24
+G7 X0.3333333 D32ACA28C94958DA0B2BFCDBCB4A791877C7862726AAD9C786F08
+G0 X61.667 Y24.333
+G7 X-0.3333333 D687F96A6786D747F708A8599B6ABC7C6B4B09A8D9793A0AA9C23
+G0 X52.667 Y24.667
+G7 X0.3333333 D18A49A97A5B6998B9DB3B9CBC3A9A992838971777D6171A29D8960
+G0 X61.667 Y25
+G7 X-0.3333333 D6A969F9E6184A086738A7E96B0B2BAC2BFAC9291A0AC9E98B6BF82
+G0 X52.333 Y25.333
+G7 X0.3333333 D0A97A7AEA1A8A9978FA0A3B6BFB8ACB39789847085A78C5F886D7B63
+G0 X61.667 Y25.667
+G7 X-0.3333333 D557272775592A07E6A87929AADABB2C1BAA4ACA08D98ACA6B2A65A
+G0 X52.667 Y26
+G7 X0.3333333 D64A5B4A1A1968EA0A99B6D81AFADB1969A865F829B95507F896956
+G0 X62 Y26.333
+G7 X-0.3333333 D116E71876F5E9E958970849A95B2B29A01
+G0 X56 Y26.333
+G7 X-0.3333333 D5CA787828D95A4AA7C08
+G0 X53 Y26.667
+G7 X0.3333333 D70A8988D7C7B819715
+G0 X56.667 Y26.667
+G7 X0.3333333 D81B7B2A49B81838C8AAF7469A87E6932
+G0 X62 Y27
+G7 X-0.3333333 D545F84AE757E9F8E8782809DACB5B37A
+G0 X55.667 Y27
+G7 X-0.3333333 D6AA78D7F878EA28D0F
+G0 X52.667 Y27.333
+G7 X0.3333333 D38A09E918B808BA120
+G0 X56.667 Y27.333
+G7 X0.3333333 D78ACB5A98D7672869FB28473A5A0827620
+G0 X62.333 Y27.667
+G7 X-0.3333333 D637984A2AD7978C4B18D697687A9BAB47E
+G0 X55.333 Y27.667
+G7 X-0.3333333 D656D7F96969BA15E
+G0 X27.667 Y27.667
+G7 X-0.3333333 D3119
+G0 X22.667 Y27.667
+G7 X-0.3333333 D050E
+G0 X22 Y28
+G7 X0.3333333 D5423
+G0 X25.333 Y28
+G7 X0.3333333 D3E14
+G0 X26.333 Y28
+G7 X0.3333333 D170361542540
+G0 X52.333 Y28
+G7 X0.3333333 D018997908F94957329
+G0 X56.667 Y28
+G7 X0.3333333 D8CB1BAA891776B92B9C2777EAB9F77696D28
+G0 X62.667 Y28.333
+G7 X-0.3333333 D5A73747C99A57D6CA8B192808B8EA0B8AE940A
+G0 X55.333 Y28.333
+G7 X-0.3333333 D057499908C8B979D28
+G0 X28.333 Y28.333
+G7 X-0.3333333 D2A736E89738D5422774C12272E
+G0 X22.667 Y28.333
+G7 X-0.3333333 D49AE21221C7118
+G0 X20.333 Y28.667
+G7 X0.3333333 D5D9589905F99361E
+G0 X23.333 Y28.667
+G7 X0.3333333 D0A
+G0 X24 Y28.667
+G7 X0.3333333 D538E6398A16691808C938834
+G0 X52.333 Y28.667
+G7 X0.3333333 D539C908D98999452
+G0 X56.333 Y28.667
+G7 X0.3333333 D2CA9B3B3A19C83729CA18F80669E9E7E82847D2B
+G0 X98.667 Y28.667
+G7 X0.3333333 D062A0255
+G0 X100 Y29
+G7 X-0.3333333 D6A719451
+G0 X63 Y29
+G7 X-0.3333333 D6080868091A39D709790AAA887879B9DA8B5B45B
+G0 X55 Y29
+G7 X-0.3333333 D217F999F928A8F77
+G0 X28.333 Y29
+G7 X-0.3333333 D0A8864899C789C7695AA98A72B
+G0 X23.667 Y29
+G7 X-0.3333333 D790A0E7647598FB0917B
+G0 X18.667 Y29
+G7 X-0.3333333 D1804
+G0 X18 Y29.333
+G7 X0.3333333 D2A9D0B
+G0 X19.667 Y29.333
+G7 X0.3333333 D26408883698C685B974B3C78
+G0 X24.333 Y29.333
+G7 X0.3333333 D778B7FA4AB93AB9B5D8E2B
+G0 X52 Y29.333
+G7 X0.3333333 D118D8F909899967A09
+G0 X56.333 Y29.333
+G7 X0.3333333 D74B0AFA2867A91A3ADB69E947B9AACA281827B812C
+G0 X98.667 Y29.333
+G7 X0.3333333 D64A88A8F
+G0 X100 Y29.667
+G7 X-0.3333333 D9D6B8A78
+G0 X63.333 Y29.667
+G7 X-0.3333333 D608D897985A3ACA0859AAEC2B8AD936D77959FAE9D10
+G0 X54.667 Y29.667
+G7 X-0.3333333 D67A2989794969836
+G0 X27.667 Y29.667
+G7 X-0.3333333 D5C427DAA999F92847126
+G0 X24 Y29.667
+G7 X-0.3333333 D1F9F515AA09260638292788A5F49416AAA2C05
+G0 X17.667 Y30
+G7 X0.3333333 D5B3580B18E988C8C7C8C9C27799A9B6356B12E
+G0 X24.333 Y30
+G7 X0.3333333 D0C65A58C97A69F72351E
+G0 X52 Y30
+G7 X0.3333333 D5E969C9F9799A748
+G0 X56 Y30
+G7 X0.3333333 D40B5A998926B78A4B1BDC0AE9F8D91AAA58E8696857A35
+G0 X98.667 Y30
+G7 X0.3333333 D247D7DAF
+G0 X100 Y30.333
+G7 X-0.3333333 D4F799316
+G0 X98.333 Y30.333
+G7 X-0.3333333 D02
+G0 X64 Y30.333
+G7 X-0.3333333 D097379838F899CA8AA7A6B8DA4BEBFA7A78B609190A9B277
+G0 X54.667 Y30.333
+G7 X-0.3333333 D189297959098917F03
+G0 X28.333 Y30.333
+G7 X-0.3333333 D302E4D047485749CA28E
+G0 X24.667 Y30.333
+G7 X-0.3333333 D2D10028D502717526B3A8F928C8E94949C76141209
+G0 X12.333 Y30.333
+G7 X-0.3333333 D0504
+G0 X11.333 Y30.667
+G7 X0.3333333 D0311
+G0 X18.333 Y30.667
+G7 X0.3333333 D1047A39E8F8F88928FAF68634D
+G0 X23 Y30.667
+G7 X0.3333333 D074914507E5958679C678899025A817603492E
+G0 X51.667 Y30.667
+G7 X0.3333333 D2390918D8C969572
+G0 X55.667 Y30.667
+G7 X0.3333333 D0999B8AE878F65A39F9FBFB494734F369AA19D8F8680756E4F
+G0 X98 Y30.667
+G7 X0.3333333 D41524E7C936D
+G0 X100 Y31
+G7 X-0.3333333 D937C8179914D12
+G0 X64.333 Y31
+G7 X-0.3333333 D35776971888A9A9EAA71
+G0 X60.667 Y31
+G7 X-0.3333333 D4CA38BA1B29C97A2868A89ADBBB648
+G0 X54.333 Y31
+G7 X-0.3333333 D4B9B9696928E9751
+G0 X29 Y31
+G7 X-0.3333333 D7B5873B4907E9C8D7C9C6262834A4730400E3BB084487CA7AA8A46736F779E4F6618
+G0 X11.667 Y31
+G7 X-0.3333333 D10
+G0 X10.667 Y31
+G7 X-0.3333333 D01
+G0 X6.667 Y31.333
+G7 X0.3333333 D0902
+G0 X10.667 Y31.333
+G7 X0.3333333 D08150C
+G0 X17 Y31.333
+G7 X0.3333333 D022544577AA36C84847A947C8A9F6284B3723D532F575560A09DAB746190AEADBA5D87741E
+G0 X51.667 Y31.333
+G7 X0.3333333 D83938F96A39E9516
+G0 X55.667 Y31.333
+G7 X0.3333333 D81C2BBABA68E84A79C94A29F967F44
+G0 X61 Y31.333
+G7 X0.3333333 D2EA9A6A09085837972811B
+G0 X91 Y31.333
+G7 X0.3333333 D090512
+G0 X97.667 Y31.333
+G7 X0.3333333 D6A9E8E648BA064
+G0 X100 Y31.667
+G7 X-0.3333333 D3F9383939F980F
+G0 X92.333 Y31.667
+G7 X-0.3333333 D2A6A586B
+G0 X64.667 Y31.667
+G7 X-0.3333333 D627C79767E849D9EA87F
+G0 X60.667 Y31.667
+G7 X-0.3333333 D6F7781959A9A9EA887A5A59EB4B59D03
+G0 X54 Y31.667
+G7 X-0.3333333 D71A4A39B95929931
+G0 X29.333 Y31.667
+G7 X-0.3333333 D5E8C926C8EA68AB7AA7472A1977A7845377B7F70917A6D76657985949DA2747D2F
+G0 X18 Y31.667
+G7 X-0.3333333 D7081
+G0 X11.667 Y31.667
+G7 X-0.3333333 D04310109
+G0 X7.333 Y31.667
+G7 X-0.3333333 D1001
+G0 X7 Y32
+G7 X0.3333333 D08
+G0 X7.667 Y32
+G7 X0.3333333 D01
+G0 X10 Y32
+G7 X0.3333333 D062C051C09
+G0 X17 Y32
+G7 X0.3333333 D2C90400728668AA98A9F9B8A788F4D6A6E4595A6711F779D9FA992859E9EA09C8A9CA6A164
+G0 X51.333 Y32
+G7 X0.3333333 D7290939B9BA0A342
+G0 X55.333 Y32
+G7 X0.3333333 D1994A9A69496AD9C9F9E938EA684697509
+G0 X61.333 Y32
+G7 X0.3333333 D40ADA1A0937F7E7F757333
+G0 X90.667 Y32
+G7 X0.3333333 D06808A7C533B4B320B4126
+G0 X98 Y32
+G7 X0.3333333 D7D9A86A76D73
+G0 X100 Y32.333
+G7 X-0.3333333 D96759B767C6B
+G0 X94.333 Y32.333
+G7 X-0.3333333 D2B99656D938F5864876D2844
+G0 X65.333 Y32.333
+G7 X-0.3333333 D0B67717C83868E95A1A38D06
+G0 X61 Y32.333
+G7 X-0.3333333 D1E716579A19796A3A3A5B19DA0A7BBA737
+G0 X54 Y32.333
+G7 X-0.3333333 D0C9194728D998A911E
+G0 X29.333 Y32.333
+G7 X-0.3333333 D2F979B8E8993999BB3A3A792A39F96838D72A44964A99493988BA5A8838D9F42
+G0 X18.333 Y32.333
+G7 X-0.3333333 D5334A7A11C
+G0 X11.667 Y32.333
+G7 X-0.3333333 D110337295519
+G0 X8 Y32.333
+G7 X-0.3333333 D030C0E
+G0 X7 Y32.667
+G7 X0.3333333 D0F1B
+G0 X9.667 Y32.667
+G7 X0.3333333 D5134
+G0 X10.667 Y32.667
+G7 X0.3333333 D1E
+G0 X11.333 Y32.667
+G7 X0.3333333 D2A320601
+G0 X16.333 Y32.667
+G7 X0.3333333 D0D398C718C6F0611A2909CA7B0A5A4B0B0A78B8BA59798777DA5AE90618EB3B1939D874785876C21
+G0 X51 Y32.667
+G7 X0.3333333 D469B8F9D89608063
+G0 X55.333 Y32.667
+G7 X0.3333333 D49BCC2AFACABC0ADA8A997A88A78826E38
+G0 X61.667 Y32.667
+G7 X0.3333333 D4EA2A099988373757D7C4A
+G0 X90 Y32.667
+G7 X0.3333333 D31939887893E79B2846B7B7C06
+G0 X94.667 Y32.667
+G7 X0.3333333 D05
+G0 X96.667 Y32.667
+G7 X0.3333333 D14
+G0 X98 Y32.667
+G7 X0.3333333 D3445876A4A7E
+G0 X100 Y33
+G7 X-0.3333333 D9D98767047
+G0 X97 Y33
+G7 X-0.3333333 D7F1F
+G0 X95 Y33
+G7 X-0.3333333 D1D1E540E6F80B07A2D4F81968A83423701
+G0 X65.667 Y33
+G7 X-0.3333333 D126F686C70748DA4969E970E
+G0 X61 Y33
+G7 X-0.3333333 D4C6D786C97B38DA7ABB2C0B3A4A8BEAA70
+G0 X53.667 Y33
+G7 X-0.3333333 D227F6F909E97A371
+G0 X29.333 Y33
+G7 X-0.3333333 D137C84909F9A9FA0977C95ADB69F8A869BAFAEA0A4AB9FA6A4B49C8FA2A5A05F0D4C40
+G0 X17.333 Y33
+G7 X-0.3333333 D3A18
+G0 X12.667 Y33
+G7 X-0.3333333 D6075720C386D7861750E420E2B
+G0 X8 Y33
+G7 X-0.3333333 D0D3F04
+G0 X7.333 Y33.333
+G7 X0.3333333 D0D352E6922806C9B9AA095966071AAA114152B3D
+G0 X17.667 Y33.333
+G7 X0.3333333 D030C2468BCA19CABA0A4A19E9E989CA5AEB0AC8F8999A5A5A2B6A9AD967E9F43395B0A
+G0 X50.667 Y33.333
+G7 X0.3333333 D048F969C9D89616E
+G0 X55.333 Y33.333
+G7 X0.3333333 D80ADBFABB0BABAA1A99C8BA59772847F5E11
+G0 X62 Y33.333
+G7 X0.3333333 D63A699A292857D716B7D40
+G0 X87.333 Y33.333
+G7 X0.3333333 D1306561A133E126D698C7D808158024C809182556D426310
+G0 X96 Y33.333
+G7 X0.3333333 D026E8F652D4938909C7469A2
+G0 X100 Y33.667
+G7 X-0.3333333 D5D1381878883928699A2A048
+G0 X95.333 Y33.667
+G7 X-0.3333333 D25556C
+G0 X94 Y33.667
+G7 X-0.3333333 D5789984A334B608A7E8E9B849860901D
+G0 X88.333 Y33.667
+G7 X-0.3333333 D692117
+G0 X66 Y33.667
+G7 X-0.3333333 D03708E727177838D9B9D9D20
+G0 X61.333 Y33.667
+G7 X-0.3333333 D327C6B768990ABA3A0AD98A2B6B2A8BEC491
+G0 X53.333 Y33.667
+G7 X-0.3333333 D3A7788979B949E2A
+G0 X28.333 Y33.667
+G7 X-0.3333333 D3868968D8299AA868CAD81999C92A1A18C90A1A6A8B6AEADAD9EA09F8F1A0D
+G0 X14.667 Y33.667
+G7 X-0.3333333 D01
+G0 X14 Y33.667
+G7 X-0.3333333 D28A1884EA89273A392877E95A4A180249D68071E
+G0 X7.333 Y34
+G7 X0.3333333 D1A418E9D526AABA4A2906C7EA2A38FA59FA38F0B6B10
+G0 X15.667 Y34
+G7 X0.3333333 D05
+G0 X17 Y34
+G7 X0.3333333 D1A
+G0 X17.667 Y34
+G7 X0.3333333 D2625
+G0 X18.667 Y34
+G7 X0.3333333 D56A4A9A3ADA7A2C1B5ACB6A2909F98748FA49CA38F9683945B75923A1B0804
+G0 X50.667 Y34
+G7 X0.3333333 D629C9CA395767F06
+G0 X55 Y34
+G7 X0.3333333 D34B8B5AC97B4ABA4A3AE97B4B48A8A606C854E
+G0 X62.333 Y34
+G7 X0.3333333 D5A989792817D7E667B7844
+G0 X86 Y34
+G7 X0.3333333 D14
+G0 X87.667 Y34
+G7 X0.3333333 D060D
+G0 X88.667 Y34
+G7 X0.3333333 D308661AA7271938061817E4776636C5B2B646911
+G0 X96 Y34
+G7 X0.3333333 D538FA09E96A19F827F927C41
+G0 X100 Y34.333
+G7 X-0.3333333 D9D94959DA497A09BA5A37E670A
+G0 X95.333 Y34.333
+G7 X-0.3333333 D0D5D828B79795164878AA679698F6F8EA273918F4E1228434624206602
+G0 X66.333 Y34.333
+G7 X-0.3333333 D155D616A73847E788389990F
+G0 X61.333 Y34.333
+G7 X-0.3333333 D649D99737B9CA99E8FA2A4B7B497A8B0B1BE56
+G0 X53 Y34.333
+G7 X-0.3333333 D68738EB3A99C9511
+G0 X44.667 Y34.333
+G7 X-0.3333333 D112A
+G0 X29.333 Y34.333
+G7 X-0.3333333 D08103547B0993967A7A783829A887893969EA2A6ACB2B6A89EA1A4A4A19E9F161A871C
+G0 X17.333 Y34.333
+G7 X-0.3333333 D8226
+G0 X16.333 Y34.333
+G7 X-0.3333333 D2C3B22
+G0 X14.333 Y34.333
+G7 X-0.3333333 D6C88A493A999AB97855D584B83A49975969F6609
+G0 X7.333 Y34.667
+G7 X0.3333333 D09
+G0 X8 Y34.667
+G7 X0.3333333 D119A518892928E7B5F408095AFB2AC8F9AA93D1F
+G0 X15.333 Y34.667
+G7 X0.3333333 D569C6B191A811F2E987A7BA5A2A19DA5A8AB9FB1B2ADA0A7A39AAA7D86886E8DBCA4A65750929F6B3B5C29410D
+G0 X30.667 Y34.667
+G7 X0.3333333 D0D
+G0 X43.667 Y34.667
+G7 X0.3333333 D409065154614
+G0 X50.333 Y34.667
+G7 X0.3333333 D529E9BACA68C6735
+G0 X55 Y34.667
+G7 X0.3333333 D71C2BDB3BA96B0B7AA9796ACABA698A2AB9C76
+G0 X62.667 Y34.667
+G7 X0.3333333 D95C599887E7D79785C5E4C
+G0 X86 Y34.667
+G7 X0.3333333 D26879890A78F6FABA36D929B9895925E7DAE8E93676E8582833912040B353A99A1938199AAA38B8B9845
+G0 X100 Y35
+G7 X-0.3333333 D6A61878195B3A08755593F2E2E
+G0 X95.333 Y35
+G7 X-0.3333333 D1311043F72887266885D7082829EB09D7F9184A8B1957D9D91998324
+G0 X66.667 Y35
+G7 X-0.3333333 D1686686973778A9BAFB2B45B
+G0 X61.667 Y35
+G7 X-0.3333333 D158798A0AFB6B5B1B38A8DADAEB2A0AEB6BCC094
+G0 X53 Y35
+G7 X-0.3333333 D0E6492A0AFA89B8F0D
+G0 X45.667 Y35
+G7 X-0.3333333 D279980919E8E1D2C
+G0 X31.667 Y35
+G7 X-0.3333333 D06
+G0 X31 Y35
+G7 X-0.3333333 D81436E90878B896A7F894B7BA7A4C0B19B819294A699868DA8AC8FA587B1A8A9A2A1A1939585AF976185617EA57E25
+G0 X14.667 Y35
+G7 X-0.3333333 D568D8FA08B7AAA877A457696A09F8A8B90548858
+G0 X0.333 Y35.333
+G7 X0.3333333 D353B
+G0 X8 Y35.333
+G7 X0.3333333 D68967B97858FA1988C876A7E7E9D92AA807C9310
+G0 X15.333 Y35.333
+G7 X0.3333333 D09
+G0 X16 Y35.333
+G7 X0.3333333 D3D90B26CA19F91929A9A9D9DA4A2919EA392889C858894707B91939CAAA7A8ABAF9FA4936F5B849A9D8F9BAA731226
+G0 X42.667 Y35.333
+G7 X0.3333333 D1A6C608C85859B5A
+G0 X45.667 Y35.333
+G7 X0.3333333 D04
+G0 X50 Y35.333
+G7 X0.3333333 D4CA49DA7ABA98D58
+G0 X54.667 Y35.333
+G7 X0.3333333 D11AFBDC0B9A6A7A9A3BB6443B8B5B7B9A294999B62
+G0 X62.667 Y35.333
+G7 X0.3333333 D14A8ADAEA4967876787278680B
+G0 X85.333 Y35.333
+G7 X0.3333333 D36234449305F948C918B8F9C9B9CA88A9073574A3E77654D6F6624101701
+G0 X96 Y35.333
+G7 X0.3333333 D03
+G0 X97 Y35.333
+G7 X0.3333333 D599A959C849495996A
+G0 X100 Y35.667
+G7 X-0.3333333 D79A1A6A79D9797A564
+G0 X95 Y35.667
+G7 X-0.3333333 D2A114B4E3A433C615C98655E51477FA9A39883969354928C221E3D043B0E
+G0 X67.333 Y35.667
+G7 X-0.3333333 D227E746F8C8F8A8590A8B4C368
+G0 X62 Y35.667
+G7 X-0.3333333 D08989A94A9ACB2B8BBA3
+G0 X58.333 Y35.667
+G7 X-0.3333333 D51BEAEA096ADC2BDBCBC47
+G0 X52.667 Y35.667
+G7 X-0.3333333 D3C779FB1AAA0938707
+G0 X46 Y35.667
+G7 X-0.3333333 D13402894879A8D95A4551B
+G0 X32 Y35.667
+G7 X-0.3333333 D5564803E6BAEB27D929C939E989395B0B8ADADAC899592A495A165848A9C8FA68D95ABAB93A1B09F9A96878D5C96985E471C
+G0 X14.333 Y35.667
+G7 X-0.3333333 D745B74A8BC96819B86956F809F94867D6DAB8813
+G0 X1 Y35.667
+G7 X-0.3333333 D584B
+G0 X0 Y36
+G7 X0.3333333 D41261F0E07
+G0 X8 Y36
+G7 X0.3333333 D3BA2A498999382859D90A3A27894B5A93604083B1105393F6A8279A2619293A4A1A8A69B98A0A697A2A6AAA9AF6D9BA7BA55737AA29B9BA8989B8DA1AC9594A384B3696298987B74
+G0 X42 Y36
+G7 X0.3333333 D5571558F3D91AD76866C846E16
+G0 X49.667 Y36
+G7 X0.3333333 D609A96AAA1A6945F1C
+G0 X54.667 Y36
+G7 X0.3333333 D7AC2BDB5BEA081A1B6BB48
+G0 X58.667 Y36
+G7 X0.3333333 D70C2BAB8B3A8A19FA434
+G0 X63 Y36
+G7 X0.3333333 D099DA6C7BCB6A89C919371767E4103
+G0 X85 Y36
+G7 X0.3333333 D154F
+G0 X86.333 Y36
+G7 X0.3333333 D726091926BA0AD72A1A3A38D5F827179AB5756573F372A2C2224
+G0 X97 Y36
+G7 X0.3333333 D1876888797A4999998
+G0 X100 Y36.333
+G7 X-0.3333333 D93AC8DA490884F3F0A
+G0 X95 Y36.333
+G7 X-0.3333333 D0F2D
+G0 X94 Y36.333
+G7 X-0.3333333 D202F0E59703F7E9C5165628B98AAAE979599A089636065
+G0 X86 Y36.333
+G7 X-0.3333333 D374A
+G0 X68.667 Y36.333
+G7 X-0.3333333 D01357A8C82667D7680899BA7B3C6A89730
+G0 X62 Y36.333
+G7 X-0.3333333 D69A2AEB7AAB0BBB8BB3F
+G0 X58.333 Y36.333
+G7 X-0.3333333 D3DB6B6A3A396B6BBBCC196
+G0 X52.667 Y36.333
+G7 X-0.3333333 D0C73789EA0A4A295A12F
+G0 X47 Y36.333
+G7 X-0.3333333 D1A
+G0 X46.333 Y36.333
+G7 X-0.3333333 D169D82849885A7AA6D9B978F7806
+G0 X32.333 Y36.333
+G7 X-0.3333333 D35767169787078AD68809D9AABA5774C697BA0AB93*037278A59BA9AA9F979F989E9A939AA4A5979AAEB286949F99A1472191506454
+G0 X14 Y36.333
+G7 X-0.3333333 D0C2B888D85835B8C737C858E92939C7A8703
+G0 X1.667 Y36.333
+G7 X-0.3333333 D45A76B4C98
+G0 X0 Y36.667
+G7 X0.3333333 DA199505D
+G0 X8 Y36.667
+G7 X0.3333333 D309A679DA093947557838477736B6E6366330F7D9590A19A54A76E5996BCC0BAAB9E9DA79DAAA8A0979A96A9AB9D99AD849BA4868BC29E1C
+G0 X27 Y36.667
+G7 X0.3333333 D1E566B849BA99F829E90648484889D70
+G0 X32.667 Y36.667
+G7 X0.3333333 D16
+G0 X41.667 Y36.667
+G7 X0.3333333 D28828D9BA8A7B08E877D8C8DAA213665
+G0 X47.667 Y36.667
+G7 X0.3333333 D1B252C
+G0 X49.333 Y36.667
+G7 X0.3333333 D789E9BA8A3B08D7B48
+G0 X54.333 Y36.667
+G7 X0.3333333 D0AA7BCBBC3BDA9AFA8ACAF2C
+G0 X58.667 Y36.667
+G7 X0.3333333 D27BBBCBDB5B9BFAE9BA117
+G0 X63 Y36.667
+G7 X0.3333333 D6B8AB2B9ACB2AD9F967B7B7D8B86929D8A5D20
+G0 X71 Y36.667
+G7 X0.3333333 D19640C02
+G0 X75 Y36.667
+G7 X0.3333333 D04
+G0 X85.333 Y36.667
+G7 X0.3333333 D0B440E287977949591929A9EA58C7C5E5974815D6D5F1C
+G0 X93.333 Y36.667
+G7 X0.3333333 D25
+G0 X94.333 Y36.667
+G7 X0.3333333 D402B2B
+G0 X97 Y36.667
+G7 X0.3333333 D0B0B3398A25F63BEA7
+G0 X100 Y37
+G7 X-0.3333333 DB29B878B9F96928E6F
+G0 X96 Y37
+G7 X-0.3333333 D171449365160
+G0 X93.667 Y37
+G7 X-0.3333333 D0B083F2F5B61646C5A6E8A93A99AA0B3AA80664670676049
+G0 X75.667 Y37
+G7 X-0.3333333 D2C4C
+G0 X72.333 Y37
+G7 X-0.3333333 D175AAE7B3B
+G0 X70 Y37
+G7 X-0.3333333 D17477E8D8A8E919C8C8764668EB2B5B8B89E8A8E3F
+G0 X62.333 Y37
+G7 X-0.3333333 D56A2AAB7B6BEBF*038B05
+G0 X58.333 Y37
+G7 X-0.3333333 D19A4A4A0AAA5B8C1BEBCAC0A
+G0 X53.667 Y37
+G7 X-0.3333333 D01
+G0 X52.333 Y37
+G7 X-0.3333333 D0B7E7EAEA2A4A4A0A02C0B5C3D4E
+G0 X47 Y37
+G7 X-0.3333333 D156F359593A27F9598AA8D9B9F94830E
+G0 X33 Y37
+G7 X-0.3333333 D0C154CA5AC9F9059599298AFA5ACA9746A61
+G0 X26.667 Y37
+G7 X-0.3333333 D236C7E8D8CA6A6ABB2AC9FA6B2AE98A5ACB4AFACA3919BABAEADA19E6772B9A98B8FAB9A9C8375A88B8C7D7E7A828E7F7D9E9A9EA7908937
+G0 X0.667 Y37
+G7 X-0.3333333 D355A
+G0 X0 Y37.333
+G7 X0.3333333 D0A
+G0 X0.667 Y37.333
+G7 X0.3333333 D5D3D
+G0 X7.667 Y37.333
+G7 X0.3333333 D155C99879AA1989B96979A655E9983868A98A69CA39A8B68AC9099A8908C988995AB9D98AEA5A49AA3B1AAB7A9A89E9192AC8E878E81
+G0 X26 Y37.333
+G7 X0.3333333 D096A585054A597BFAD9F507E938EA890B1937C4803
+G0 X42 Y37.333
+G7 X0.3333333 D1289B086A7A7908B87657267988201
+G0 X47.333 Y37.333
+G7 X0.3333333 D31654F605687B3ADA0979FA587770B
+G0 X53.333 Y37.333
+G7 X0.3333333 D443F013FBFC0C1C1BCA6A8A8A7A116
+G0 X59 Y37.333
+G7 X0.3333333 D45B6BEC0C0BFAFA9A893
+G0 X63 Y37.333
+G7 X0.3333333 D26B1685D90A8A2A3A33F5DA294918F978F807D7B7838
+G0 X70.667 Y37.333
+G7 X0.3333333 D556EB69B7136
+G0 X74 Y37.333
+G7 X0.3333333 D0D
+G0 X74.667 Y37.333
+G7 X0.3333333 D3131
+G0 X85.667 Y37.333
+G7 X0.3333333 D1C29101F17
+G0 X87.667 Y37.333
+G7 X0.3333333 D419B8E9888929C827767594C516D516A354446A76839337324
+G0 X97 Y37.333
+G7 X0.3333333 D2284929A9E9DA292A8
+G0 X100 Y37.667
+G7 X-0.3333333 DA08B767A817F5B8E3E231602
+G0 X95.667 Y37.667
+G7 X-0.3333333 D6243207F927B78675D736A5E8971517C91AE8A59917D7A3F5064541A2C
+G0 X84.667 Y37.667
+G7 X-0.3333333 D13
+G0 X83.667 Y37.667
+G7 X-0.3333333 D1006
+G0 X75 Y37.667
+G7 X-0.3333333 D253A64
+G0 X72.667 Y37.667
+G7 X-0.3333333 D6381997A65091A9B8897947B8688707D8B9EA393868D929E874E7CA855
+G0 X62.667 Y37.667
+G7 X-0.3333333 D34A9A6A9B0BBBEC0C27940
+G0 X58.333 Y37.667
+G7 X-0.3333333 D1699AFB59099B8BFC1C1CA4E478C6D3C631D0F849DA0939299A3B79A6C7766823B
+G0 X47 Y37.667
+G7 X-0.3333333 D4E5453866C43868B939E6F91AF740D24
+G0 X33 Y37.667
+G7 X-0.3333333 D3A64876586B4AB9FA8837A68A48969955D97655503
+G0 X25.667 Y37.667
+G7 X-0.3333333 D4772897D9A8B9FAF9BB6AEC1C0A297BA9EA381649D9B7393AB8E9430629E70799EAAA4A29A97839F865396809F9786A8B5A59F99734C5B08
+G0 X1.667 Y37.667
+G7 X-0.3333333 D158D39
+G0 X0 Y38
+G7 X0.3333333 D09
+G0 X1 Y38
+G7 X0.3333333 D16
+G0 X7.333 Y38
+G7 X0.3333333 D3B7F8CA8B9B1AFB9A39692998A8A8FA6A5A2A8959AB3A8A2AA8C3E825C4A849D96818972839496B7A5ABB0A3878CA7BFBCAA6C5784
+G0 X26 Y38
+G7 X0.3333333 D035B36748B8C8841704C97A29B9898B3987CA1936A33
+G0 X41.333 Y38
+G7 X0.3333333 D64607C27698B2DA4999D737E967A2A8424
+G0 X47.333 Y38
+G7 X0.3333333 D1E9B7C746E8CA3A69E8D7EA2958D627EA7A7A2995B409BBDC2BCA29099B1B79511
+G0 X58.667 Y38
+G7 X0.3333333 D0F3C7AC3BCB6BDB7ADAAA58C2E4F4F43598A9891758D98A9B19E8A747B878390A29D9B51504539A1A85B
+G0 X74 Y38
+G7 X0.3333333 D2E6A341A2006
+G0 X83 Y38
+G7 X0.3333333 D5F3D1D254F
+G0 X86 Y38
+G7 X0.3333333 D2D5E77A978417A93A16178918C605D5A987E6B7C4F7E625C864C4B80611F27589D799F54459647789B97
+G0 X100 Y38.333
+G7 X-0.3333333 D7CA74C268374429D98A87825556563523254274A703374907E826A596A7B98889B9C949E7A859797AD4F0D
+G0 X85.333 Y38.333
+G7 X-0.3333333 D16325A4E665F4B1F05
+G0 X76 Y38.333
+G7 X-0.3333333 D0B503A6254
+G0 X73.333 Y38.333
+G7 X-0.3333333 D44366B8D8D1C2F8C7E8B8E98A9A3745F7BA3B5B7A25E788D7854334320190A599A9FAAB3BDB5B5BCBF5D202B
+G0 X58.333 Y38.333
+G7 X-0.3333333 D139CAEA99F978EA4C1BF6D47577FAC8C7386789D79918E8FABB18A807D7075A363072E908F8EA4ADA49E96A983847E2EA2917D
+G0 X34 Y38.333
+G7 X-0.3333333 D0D235D9C9E9E99707789785FA7A98C6F7CC5A3A93A1A327229886E86888999A3AE9FAEBDA08F9BADA4939C8E3341590F27A958
+G0 X16.667 Y38.333
+G7 X-0.3333333 D786E5F94A79CA47AA7AEA6AA999E9997B1A5B7BDBCB5ABB0A6940E
+G0 X1.333 Y38.333
+G7 X-0.3333333 D370D4661
+G0 X0 Y38.667
+G7 X0.3333333 D6F851C25
+G0 X6 Y38.667
+G7 X0.3333333 D2B3D
+G0 X7.333 Y38.667
+G7 X0.3333333 D1D5F899BA2B8C0BAB9B6BBB7BAA8959BABABB5AD7D808AA27477683F485320
+G0 X18 Y38.667
+G7 X0.3333333 D2238033B9A92959D9C989FA9C4BB959D9A*03B37B92998AA574618CAEB1BB9E89A6B298777B966D70A470888E7F9666
+G0 X41.333 Y38.667
+G7 X0.3333333 D369B9A93A37E9BA68FA6AB9A9E8B843D676779AE807178717C8C97909F807E8985986A6CA39D713C6DC5BDAC999AA4ACB2A41B
+G0 X58.667 Y38.667
+G7 X0.3333333 D323B4ABCC2B8B5A0B5AAA38D6442545C878238507E57406D757B7E5D565499B5A091927F6E6C5F4B8BA8922D
+G0 X73.667 Y38.667
+G7 X0.3333333 D01587A2C4218
+G0 X82.667 Y38.667
+G7 X0.3333333 D4B7A658A828C741D
+G0 X85.667 Y38.667
+G7 X0.3333333 D195CAB9489979A957F8D94848367655E5E73768F725747142C1233737C63754976A29B8443635C55563E96
+G0 X100 Y39
+G7 X-0.3333333 D9F5DA8537C524F7FAE9F79A25306362A2F24
+G0 X93.667 Y39
+G7 X-0.3333333 D2E8A50182B8574816C678E7A4F74A663828A94928C91750E
+G0 X85.333 Y39
+G7 X-0.3333333 D42396D827671A304
+G0 X75.333 Y39
+G7 X-0.3333333 D064A6C2E09
+G0 X73 Y39
+G7 X-0.3333333 D4A92A04D5D70748E989FA8B1996D6F596D5D10829349627D72938875726B5E869EABB0B1BDC1963A3D162D
+G0 X58.333 Y39
+G7 X-0.3333333 D0DA3ABB19F99A1ADBCC98B406A82568D96A1887E908D76868D837D4F5475528C8E7C9F7196868F939EA9AAA5AA99928D9D452F25
+G0 X34.667 Y39
+G7 X-0.3333333 D0A3357846F4E9771837794B88A3CA7AA95ACBEABB3C19097AEA5B6A17655A2A99BA099A0BAA9AEB7B5AF9DA06E7F475245671E0D0D3591708E91938E7EAABAB3ADB0988DADB2B3B6B3C1BCAEAC93AB8F3913
+G0 X6.667 Y39
+G7 X-0.3333333 D346B5108
+G0 X1.667 Y39
+G7 X-0.3333333 D37307A9387
+G0 X0 Y39.333
+G7 X0.3333333 D209CA5998C07
+G0 X2.333 Y39.333
+G7 X0.3333333 D0401
+G0 X5.667 Y39.333
+G7 X0.3333333 D887F
+G0 X7.667 Y39.333
+G7 X0.3333333 D064F6973ACB1BDC0AEAFA8ACB3A1A999B5B7B7AD988C91A29E967367845D25863B3C6CA05F8785A1B7A7ADB6B48B9A969EA4A16433889C9FA6AD93B28F98B5AD63A07227A9B5AD846C34A69A4E051A46
+G0 X40.667 Y39.333
+G7 X0.3333333 D2448765A848BA0B5B1B2A292939C9B9AAA528C9180827B7660A49F7E9C8F73A49FA29C737E8D584E816F71C4BDA8A09EA4A7AF8F
+G0 X58.667 Y39.333
+G7 X0.3333333 D24520C
+G0 X60 Y39.333
+G7 X0.3333333 D0248B4B9B1AEA184715374625A8E8F8F6A548C823A5E5661475976AEAFA89D949566186D6C6A7F4E5B12106D3B
+G0 X82.333 Y39.333
+G7 X0.3333333 D1C1D649667433B5D675C47A996929992999F6767476D8F735C4394786A1617703D
+G0 X94 Y39.333
+G7 X0.3333333 D1B49
+G0 X95.333 Y39.333
+G7 X0.3333333 D10078CB09187962304449D89949A
+G0 X100 Y39.667
+G7 X-0.3333333 D9EB0341A
+G0 X98.333 Y39.667
+G7 X-0.3333333 D3164923E68AE4B5547463B51051405725970775A6E7C5B73597584533E79A1928784826F734B64229072216B9B6D122D3A081C
+G0 X76 Y39.667
+G7 X-0.3333333 D13
+G0 X75 Y39.667
+G7 X-0.3333333 D238235
+G0 X73.667 Y39.667
+G7 X-0.3333333 D84A894608A632E9D9696A0B3AC7C586B2E262066748B7A52618F8DAF4A518876647597AEB5B790
+G0 X59.333 Y39.667
+G7 X-0.3333333 D531B
+G0 X58 Y39.667
+G7 X-0.3333333 D70AEAAA997A6A9B6CB7B47525958865556819F85AB6F8DA78B9AB29B829683829BA3858E9F9C7B77A98F95AA959E727A915C4E9623381E
+G0 X34 Y39.667
+G7 X-0.3333333 D182B21A98785A5B69E698CACAF9DA0AD7AB89E8A9DA09B909C726AA3A1A9A6A37BA4B5A9AFACABA988A2A9AFAD9B9278457463886383AAA49C9C8F9BACA99F919E9DB8AD977F8FBDB7C0B84D
+G0 X7.333 Y39.667
+G7 X-0.3333333 D16742E31523F040204
+G0 X4 Y39.667
+G7 X-0.3333333 D0324
+G0 X3 Y39.667
+G7 X-0.3333333 D3259
+G0 X2 Y39.667
+G7 X-0.3333333 D2D68A19F8146
+G0 X0 Y40
+G7 X0.3333333 DB95E3B250C46
+G0 X2.333 Y40
+G7 X0.3333333 D794929514642028286A960
+G0 X6.333 Y40
+G7 X0.3333333 D5F59
+G0 X8.667 Y40
+G7 X0.3333333 D466C9E9EA79585959F8DAF98A793A4B1AD978D8AA8BD794C6A15A27D85B29DA1A59C91A3A18D9089B7B5B7ADA2ACA8A5B3AE9E9DA4A4A29F8EA1AB8DB294B2BCAE9B749FAE9760314C1E3B42
+G0 X39.667 Y40
+G7 X0.3333333 D18465B9B98948A4B7885269795989F7CA8909D99A5B5A5817B6490A6A2878C9E8965AA7D72686544786854556A7DC083A4AD99A0B1A765
+G0 X58.667 Y40
+G7 X0.3333333 D242B
+G0 X60.667 Y40
+G7 X0.3333333 D7CB5B8AF9180717F7F636082878D7C6B8678714715264B79A1594F769CA09B9F858460909E97793E381F10
+G0 X75.333 Y40
+G7 X0.3333333 D2026
+G0 X80.333 Y40
+G7 X0.3333333 D3E14
+G0 X81.333 Y40
+G7 X0.3333333 D45714F2020858D69645279726C54085589798F8C86605560768669757B7A727F767E636F1516
+G0 X94.333 Y40
+G7 X0.3333333 D3B175834094B903E8F94A1827A3C216A91
+G0 X100 Y40.333
+G7 X-0.3333333 D87697287A2A9AF6F84571038503A
+G0 X95 Y40.333
+G7 X-0.3333333 D2032
+G0 X94 Y40.333
+G7 X-0.3333333 D152A5F7C99747B797669595D616A6C7A6E86867E7D8B85566D26585D475A567E8D79A16D700F0B37AA22
+G0 X74.667 Y40.333
+G7 X-0.3333333 D26438A7F6B757A7081929EA1A6854878A6A6A786142C35526E7899A1A97D46819981A18B8F9BAFBCB6A615
+G0 X59.333 Y40.333
+G7 X-0.3333333 D252B
+G0 X58 Y40.333
+G7 X-0.3333333 D5AAAB3B2B9B0A64E5871917B7F895862706E47796E6E8A9992778F98935678586799ACA89989AFAD989E5E6B546F9259968BAE9D4738
+G0 X32.667 Y40.333
+G7 X-0.3333333 D0B46A1AA9F8D8F9BB6BC689F9E97A5B89D97A5ABB0A5B1AAB3B8A89AB4B2A7AF9686979EA795AC9DA8A18B9A963A
+G0 X17 Y40.333
+G7 X-0.3333333 D8B727CB79FA694A8AA9CA4AA8C90B386929B919C88A5A26318
+G0 X8.333 Y40.333
+G7 X-0.3333333 D1E06
+G0 X7 Y40.333
+G7 X-0.3333333 D4E851AA3B7934A3BA15F834F6C7F1B53
+G0 X1 Y40.333
+G7 X-0.3333333 D26428F
+G0 X0 Y40.667
+G7 X0.3333333 D8774681D110E197C96A0A45BA6B03A75B0621C7823
+G0 X7.667 Y40.667
+G7 X0.3333333 D3A4E09
+G0 X9 Y40.667
+G7 X0.3333333 D1089949F9B9CA39AAB8D7D73A5855681A9B7C0B7B4A68F2C0C7248868194ACA9917B9EA4ADA1A8899FACAE9DA0B4C2ABAFB0ADA89F8A99B0AD7D6C5BAEBDAB8793B875545D52757A10
+G0 X40 Y40.667
+G7 X0.3333333 D24378197988E7C80478E734D9798999A7D96A59A76536180627C9E9179849B957571564E8B82686A936890A25D395494B9B6B2B1B358
+G0 X58.667 Y40.667
+G7 X0.3333333 D2A24
+G0 X60.333 Y40.667
+G7 X0.3333333 D84BAB9BDAFA19792A7A27A5F447A2E5A958B704218
+G0 X67.667 Y40.667
+G7 X0.3333333 D03716B75A5A9767B8EA69C9A918B7A
+G0 X73 Y40.667
+G7 X0.3333333 D3D9890404308
+G0 X80 Y40.667
+G7 X0.3333333 D6EA15A854141756F917F9268734806
+G0 X85.667 Y40.667
+G7 X0.3333333 D2D9E84867E7B7F8E838C6958717E687074737675AA8B5644513F5520
+G0 X95.333 Y40.667
+G7 X0.3333333 D0E44
+G0 X96.667 Y40.667
+G7 X0.3333333 D2F6B76979E74809DA097
+G0 X100 Y41
+G7 X-0.3333333 D85829FA0958F8B6C43
+G0 X95.667 Y41
+G7 X-0.3333333 D21
+G0 X95 Y41
+G7 X-0.3333333 D3F70906C8D5B847D756B4E787F8B6A80698B95929479797D7B7A8A7A3D
+G0 X85 Y41
+G7 X-0.3333333 D284E74896C6C7A669A1B439B8E989139
+G0 X75 Y41
+G7 X-0.3333333 D1D917854578677899FAFAEAD84618AA5AE7622362E
+G0 X67 Y41
+G7 X-0.3333333 D304F384B511F518772A5AAA881AA9BA8BAB2AFB452
+G0 X59.333 Y41
+G7 X-0.3333333 D3625
+G0 X58 Y41
+G7 X-0.3333333 D58AFACB6AABD9665525C7A8E6452486B8CA288516489A09584896C617F676C5E74678A878975878DA5837C692D1E38A1A09E44784432
+G0 X33 Y41
+G7 X-0.3333333 D02
+G0 X32 Y41
+G7 X-0.3333333 D6480979DACA697A4A997AF979796998BA4AEB7AFA8B8A6ADAE979CB3A9AFC4B9808FA48E8D9CA19D979F9CA434
+G0 X16.667 Y41
+G7 X-0.3333333 D6AAFA5BBC3A5A091639CA1A88396A69CA59E9C9C8D8B1C0574838656781C0E18059E996F969F75A2A48D93
+G0 X2 Y41
+G7 X-0.3333333 D0B7A2E21899E
+G0 X0 Y41.333
+G7 X0.3333333 DAC7D552F988E538190985E5FB4815AAA4D044B4C
+G0 X7 Y41.333
+G7 X0.3333333 D1C6B9FA67E673D967598A6B7AA9EAE9894AFB8BCA5B0ADAEBDA99B9493441F76A2A096A29C979B9C98A237B0CC9E9F999CB1BBB2ABB6BAA9ABA8A2AE9D958A797DBAA07492989E87A25F16
+G0 X40 Y41.333
+G7 X0.3333333 D0B7F884997A37C4F55418F716C8E7E7D818A79767D715C6145*036CA3B08EAAA1A2867E8A76723762895A474B6490BAAEB4B4B1AD5F
+G0 X58.667 Y41.333
+G7 X0.3333333 D1E280F93BF969BBCB6A4A3A881B5A79A54653D24170E2314
+G0 X68.333 Y41.333
+G7 X0.3333333 D240E4CADB299683F89B4AFABA0978F884B356F07
+G0 X79.333 Y41.333
+G7 X0.3333333 D0C7695A287673980753244707E6866313A2439916F73807A7D714E838D9E85767B9187977B6A6788734E8D679E723F24652D
+G0 X96.667 Y41.333
+G7 X0.3333333 D24638B83A1B4AF6A7049
+G0 X100 Y41.667
+G7 X-0.3333333 D998B597962A77E65175414
+G0 X96 Y41.667
+G7 X-0.3333333 D0C3C5484928D8F772D3D8264635B7E835B837D7571867F7F8F836A867DAF56084B6E5952444A97372C63697E8A8A9E6904
+G0 X75 Y41.667
+G7 X-0.3333333 D044674608199A4A8AAAFB6733F83A6AEAB36
+G0 X68.667 Y41.667
+G7 X-0.3333333 D0E
+G0 X68 Y41.667
+G7 X-0.3333333 D02
+G0 X66.667 Y41.667
+G7 X-0.3333333 D36620B0E0B1E4D206589A1A0A9ABA7B9BFA489BACB954810
+G0 X58 Y41.667
+G7 X-0.3333333 D6AA8AFB4C0B7C1B1695574A9B4724D84436978799DA1A671A8ADA2A35A
+G0 X48 Y41.667
+G7 X-0.3333333 D5E815E7B7C826B7E946A54817E7B876892657C602A1B
+G0 X34.333 Y41.667
+G7 X-0.3333333 D01
+G0 X31.667 Y41.667
+G7 X-0.3333333 D23779790A9AE978D7B487A8AA5A7A39699A0B4ACBAA9A8AFA4A694B097C49B888791A0A3A29D9A919C936269637C7BA4B3B2ABA1A59AA5BEB99793AAA5AEB59F9A8EA08E95A3A2791F08229E570731884080614753479393AEB97833097786
+G0 X0 Y42
+G7 X0.3333333 D69985365748B97937C04397E69710359A0101CA26969443C9CACA25895AFA3A9B3B79F848B97BCB39BAB9F9CA1A4A19B9D61578B536D987C7DA3899C98B09EC2BEBCC3C3A69FA8B3ABB2AEA4AFB09F9B99978381774C71498F9FB2978E9B4F
+G0 X40.333 Y42
+G7 X0.3333333 D19121F14696B89839B6074A37F978F697B807C7575A64F2E7368B4AC92889FA19B718C787A90798A60ACB2B5B2B5BABBBCB0A6A37E
+G0 X58.667 Y42
+G7 X0.3333333 D0CA5BFC7AD89C4BEB9B7AEABBCAF84907840
+G0 X65 Y42
+G7 X0.3333333 D04
+G0 X67 Y42
+G7 X0.3333333 D4F38
+G0 X68 Y42
+G7 X0.3333333 D171D45388FABAC815C3851A9A9ACAAA9917E8F6E07
+G0 X80 Y42
+G7 X0.3333333 D70948F8D7D618E91752641664F713A
+G0 X85.333 Y42
+G7 X0.3333333 D547C82987A6C868B84948E828B815E46955F65404671683F7986689F8E607317205238512A7A6D2B1C77A164
+G0 X100 Y42.333
+G7 X-0.3333333 D81A9A5615E71703029332D5E35677474A754608F80804C4A4F6D747F534E898F9A9C88878D8C7B88A46D9A490B07134877732449868253727B818E5F010B
+G0 X75 Y42.333
+G7 X-0.3333333 D0D627A9CACAEAD*03881B3E6E9EB1AC4637693D216182222B280B
+G0 X65.333 Y42.333
+G7 X-0.3333333 D587D67468475B5B2A6ADBDBEC1C4A48FB8BEBD7E3F098DA7AFA9B9B0B9BBBEBEBF8F3A868E8099939CA5A5A29788A79C8B5AA28088987C6F949378769195A6B07CA99C9083868C400E0C09
+G0 X40 Y42.333
+G7 X-0.3333333 D230A17
+G0 X38 Y42.333
+G7 X-0.3333333 D05
+G0 X32.333 Y42.333
+G7 X-0.3333333 D03043BA59D98A78E91798D6627659293AEA3B0B1AFAEA7B8ADC0B1A19A6DB4B4BDC4AFAA978E989A9DA085575F877D4190B098AFA5B28FA9B1AFAAA5B1A3A7B5B6B5A9AE7B428AA49D7A749BA89A3D7DB3A34197644F60
+G0 X3 Y42.333
+G7 X-0.3333333 D477096554D9BB58596
+G0 X0 Y42.667
+G7 X0.3333333 DA164847A3C97726E6D6E5F92949B9C937CA4749E9A856C9697A07D9AAEA5AEA596ADAEA9BEB387A4BCAB858AB0BAA3A06A7D917FB491579D9C6F8B9299AFCE948A9997316EA7A8AEB5B6AEB9AFABADB3A68490757D9191A2ACB4927D624E1D513A
+G0 X32.667 Y42.667
+G7 X0.3333333 D121D1104
+G0 X37.333 Y42.667
+G7 X0.3333333 D0A320F51047D698008
+G0 X41 Y42.667
+G7 X0.3333333 D1C849879768692A4B18FB08B808F747D77818856419F9F8C8B94909C9E98A4AFA4A19070A18C5A6FB6BABEBBB9AFAC9C9AA49946AABFB9BA807AB9B9C4C3B7A88BA2A798755C979B8B3C1C1B7F8311
+G0 X67.667 Y42.667
+G7 X0.3333333 D2B0F0953514FA1ABA4676660727AAAAC9DA8A4987015
+G0 X79.333 Y42.667
+G7 X0.3333333 D6653
+G0 X80.333 Y42.667
+G7 X0.3333333 D638E9B753E71384761455B3D3322214F8E829E927A938E9C819FA69EA17F656D6C7E5F33487C813E4C818A6C717182672C055430448B77978E9DA8
+G0 X100 Y43
+G7 X-0.3333333 D98954A6CABA35E129A2D
+G0 X96.333 Y43
+G7 X-0.3333333 D7B7CAA45629F7C145D785A6D5A596C795D5678A59BAEA38EA09EA375919E9074111C4A3D5B4D3D658655415A5455A35E038537
+G0 X75.333 Y43
+G7 X-0.3333333 D013E8BA3A4A198AB817463876586A9AA997B9A4867250B
+G0 X67.333 Y43
+G7 X-0.3333333 D685B6945897F478C7C7D9B969CB5B0B1B4C4BFBEC0B685986C70B9A9A3957594A5ADB7A8B0ABAB545B74856B9796957685A1959790*038EA15F
+G0 X47.667 Y43
+G7 X-0.3333333 D158F9B78666CA18294B2A4AC8D8D81717EA894670537467E60AA256A845601
+G0 X37 Y43
+G7 X-0.3333333 D0A
+G0 X34 Y43
+G7 X-0.3333333 D3F0B6723148496602C4F8D91989793A68A9E6D7F7C90A7AE9BA3ACBAB8BBBBB3A6A85F3E5396A3BFA997959B7B90927AA7A7814D938A9AA3B1B28D89A3B1A78AAFB29BBEB59A93B4B096868E9B8993958A86A180A0668BA8A7AA94959E9F964B969259659AA1
+G0 X0 Y43.333
+G7 X0.3333333 DB0A6A5918D99799F9375761A7F93A7ACA0917E967B9F909B9D9FC1B19BA2ADB3B1B9C2B3BEAA98B8A29C9B9CA2A4A1A9B1583E8FADAF77948C9EA894A0AE7AA56F063F5CAEACACB2AFB1AE918EAAB7A9A89491A7A298917795968D9E8E959A9BA35B197C696423
+G0 X36.667 Y43.333
+G7 X0.3333333 D6E0127A3B0692973577C61656A806D9F8F9A78787E94ACB89981A68C9780464E75759DA28B9A93998C878D8F8F8786945975575761808FB3B3B5B799AD8CA0A4AD8B275C8799B1BCC3BEBDB0B8C2B69A9B99AB75827C8D8B79574B95321D3285908B5A9FAAA6986C74635D516A9CA1A2
+G7 X0.3333333 D9C969E814D1F
+G0 X79.667 Y43.333
+G7 X0.3333333 D012583AD67878861718C92413D46407D552F96919F837AA4A6A5A6A4A8A68389413E7B64747050512E415B84955564594F945375AF2C717F956B95BA76
+G0 X100 Y43.667
+G7 X-0.3333333 D79B2AA8B73638B6086A09EAB74
+G0 X95.333 Y43.667
+G7 X-0.3333333 D1D6D7C3674460C35576081816C69678F8DAB9694B5A793938089A19EA2696F81222451988E80817CA6655F9E58
+G0 X77 Y43.667
+G7 X-0.3333333 D285777979993949C9FA05D2A
+G0 X72 Y43.667
+G7 X-0.3333333 D557D7899A0A79969125F8F7F5E36A7A7A2B8958F9AA6AAA19FA3A8ACB1BAB8BAB5BFC2BDA780A749247DB0A495AFB7C0BBBEA1885464746986706E727B82937479A999959F9373A2754D5B4E74A0A59F8F9FA58E978D617590989F91979A7B7D898C6D66678E8E698570
+G0 X35.333 Y43.667
+G7 X-0.3333333 D101A1E428A9B96784897A9A596879B9E8B9296A4A8A2B6AF90AEBFC5C59A9BA6A5ABAAB8CD753DB719207292A6995479AC9A7BA1B7BCA3797085A3A9*039AA2A678A694ACB0AEC7BCB4B5B7B9A7B1BA999798929F838C69A8ADA7B0AC675479779A83A8A6AD8F75A9B4
+G0 X0 Y44
+G7 X0.3333333 DBEAF9289A1A19D7C838E9A9D93B0B6B1B3925E7D7F96A19E91A1BBADAABAC2BAC3AEB38C9BA59B9B8AB2BC9B949DAEA77F93A5AEB5BBB49A78A078525D9A9F3B725D806A85C0B0ADAAB0AFA0AFB6B1C89D96AE9EAEA8ACACA4848CA9B69FADA88E3E7B8E9E9A77818B3B
+G0 X36.667 Y44
+G7 X0.3333333 D3EAC976C815E90767882748D94959598897B7D7A7A87969896A8988B5C618D510769A49A989495929E6C7C9A9E9E6A647D7A6C7B764D5F7ABEC0BDB0B3AEAEA960398BA3*03B9B4B1A9BDC1BA8F5A7A959FA2A49E9F9778A3A4AAAD595F9A9135
+G0 X69.333 Y44
+G7 X0.3333333 D6767A9A8A17F577001
+G0 X73.667 Y44
+G7 X0.3333333 D338AA69A93949C9FA3A68D5605
+G0 X80.333 Y44
+G7 X0.3333333 D4B3C080E8884934C6A94756F3A799AB6A9AC9C99877AA79BB19F9BB0A17B7162738682594C5C574B7D5B7334433C7A97A4B89A90896B838DB5B087
+G0 X100 Y44.333
+G7 X-0.3333333 D82ADB4A492966C9EA5AFB397545FAB9997869069646A6572938A6A526893AF9B8F7D918397898D8C88A5A19BA8874E527F7575576D6677464B21190D
+G0 X79.667 Y44.333
+G7 X-0.3333333 D357E625159879FA6A8A79E8E92A18F4F05
+G0 X72.333 Y44.333
+G7 X-0.3333333 D2B7548849FAB9752763C64A49BAB928CA5869697A99EA39C96918854586FA3AB9D9CB2B9AE92ADB4892C77A39EB1ABA3BDC0B882514B897568788D80909E9FA3A19BA1998B9DA3AAA1985F989884959590A29F918B6976969892767E5685AD92818284918E999E97928F5304
+G0 X35.333 Y44.333
+G7 X-0.3333333 D0B81794C63580703227EA5ACAB9DA69FA4AEB2B5A89D9BA899A0BAAEA4A8ACB4B0ADA3B1ABB68B8BB86659BDB28C828B8D91AEC1B8739F7D96A0A8B59B8EBBC6B4A1A8AF8AB99CABBFBDB4C3B4B5B4A8B5AA9A968B8FA7919BACB1A9A2966B92505C76958492ACBDBAAA
+G0 X0 Y44.667
+G7 X0.3333333 D9BA5A6B0AA9383693E5A825D84A893B0B3A49EAB8B96838DA99D87AAB4ADBE9B94C9999DBAA8AFA8A2B6C2C39BA9A9A09D4F61796440B0AF9E795D8E7B5451889DB7A989AFBCAC9CBAB4A7A898A3B9B4A4989A8497B4A19BBEA995B1A2ACA6A672
+G0 X33.333 Y44.667
+G7 X0.3333333 D0912165A761A22487D97949EA8A2A8A2A3A1A69391867F782D204D96A9A08B7B7A898287918CA1907F76589B85AABBB09C90B6BAAE99A8879B967D686B577B5A859290B1BDACAEABBEAE8B79A4A69CA7B1BFB6939994938BAA91899067649DA6AFAD9FA4B17B6E855C585C72474890A8
+G7 X0.3333333 DA096595331
+G0 X74.667 Y44.667
+G7 X0.3333333 D08507F919DA8A8A59F9FA3ABA4AB94322D50859066789A9B885F4278889E9E9F8E8F8A8D86A19E85806D2E4E8DA0849067677C7E958E7E76726F7F455FB7A98EA0A89EA5B29C949AABACB585
+G0 X100 Y45
+G7 X-0.3333333 D97AEB1A79A94B2B4A6A9B2ABACA4820B3A7C8C5A8D8F6A8577738E6A828BA9A55B50619B6D9FAE938B89A49F9EA1AC9AA6ADAEB0AFAAA29BA9ADB1A7B2B5A8AAA99A95A4ADA76A3420
+G0 X72 Y45
+G7 X-0.3333333 D2C8092A8A5985C5AAA7A592C7A8A9CA5A19CB4C6556763496499B4B995A0A6A3B0B6A9B5A4578C8AA0B1BABAA0B1B8C0BD6F6A9E7F5E4B83827EA69D99B0A7AEB6A699A2ABABA4905E6C928988A363937E728A819299A0938B764E80462129706C68ABA0A1AAA9A6A7A8B8BDB99D7191
+G7 X-0.3333333 D4A414C06132F2273A1A1ACA3B4AEAAA3938A9A8B9A8F93A9AFB8A6A8A99CBDB3A0ADB69DA4A4859A362716A89F8AA29D72802B2C897A5AA58E98A7B9C1BA919991B59FAE997EAE88AAAAAEB099889F937378837BACA39CA79E8A9367747559859F9899AAA2A7A5A6
+G0 X0 Y45.333
+G7 X0.3333333 DA0AA978F95909A998C1965908C99979996949C9C8993818C828A9FA7B8AEA79B9B8A728B8594BD876E99A8AFA48EAA9F8A3DA97712342D
+G0 X18.667 Y45.333
+G7 X0.3333333 D3B9CA1A5A83E84749D98AFB0AFB6AAA2B99D699DB6ABBCAE949BA29E91898B95979F91AA9F7E6C996E8273551E956163A9B4B5BABBAC92A1A195846A6A7E45584E2507331F77A4A4BD967A9295A2736FBD6B6B90869A8C5D4AA3AAADB3B1B9B3B2A6ABB3A6AB7DA097725F8D9793ACBF
+G7 X0.3333333 DBEBBAFA9B9C0A77E82956EABB4B3B4AA969A9FA0AEB59E8A97857F80BDBB9F91A5A57C7CA88279B68766A4A2AB96815845
+G0 X72.667 Y45.333
+G7 X0.3333333 D090C
+G0 X76.667 Y45.333
+G7 X0.3333333 D2A7FABA5ACABA5A1A9A9985E85988C9A7785674F9074748FB095A2976885B0B8A27C7B5B7288B0AE9E9B807A8D718B778EA66EA64E406B8C9BA7A5958BB4C0BAAFB0B2AFA1A5
+G0 X100 Y45.667
+G7 X-0.3333333 D9EB2A6A9BBB8B2AFAFB0A6A9A094A26B5C78A18AA14B4682897D778D97A79996815D597D8878939C8D546181539F8A3F3260585C79899D9F9E8F859B989BACA8A6B4B081
+G0 X74.333 Y45.667
+G7 X-0.3333333 D1112
+G0 X73.333 Y45.667
+G7 X-0.3333333 D4065554F729199AA9C9CAAA6A4A8AAA59DB699A994A2B7AF9588A0A8A89EB2A3A79D818491AFB9B6ADAE7B7997ADC2AFAAB1B6BDC0B8C2A88A6076719384A8939FA5A4A5AC9BB3C3ADA39B727B8B90725A3F81AB206191A29090A0A4A3B5946716
+G0 X40.667 Y45.667
+G7 X-0.3333333 D66
+G0 X40 Y45.667
+G7 X-0.3333333 D18176C9E968F6F7F45
+G0 X36.667 Y45.667
+G7 X-0.3333333 D3E859395A8B0B3AA963461425F9E73536A839C86AFAB8F7FA79F9BB0978E9DAB9F93965A79A59B9CA7BCB7B1BE535ABDBEA864957C41074D052390AF6D6F468A9EA2B6978C7394C7BB987A959897A8B0ACA489868594848A83759B84818F85908A97891F6BAB9D908D9FA491B286
+G0 X0 Y46
+G7 X0.3333333 D886C94AB929AA4A5B0B36D8B6B38979B5F456C94724F606B8F889BA0A1A1A8AF9E8E9DA1BFAEB6ACB2BFB7B0A8AB9482889693A904
+G0 X18 Y46
+G7 X0.3333333 D847DABB1AA7BB3B2B09590B3AFC4CFAF96AD8F8B8C998B8F9D8195A7A3839EB5908DA4A3AA95829F8B978F07709E9EAFB192974A6F765F
+G0 X37 Y46
+G7 X0.3333333 D29937E84A0953F793109605671C1C0BEBAAD91A09C9D8C9371A8B9957E8D92ADAF9C85A89C8F7B68A59CAAA7A39594806F87717A7891B5C0B9B8B6A5A1B7C4B8A9A38A96B6B9BCADA2928FA9A2AFA49AA4A0B076A39BAFB178A1B0ADB070A5A896A2A1889EACA3938687597F55138F63
+G0 X76.333 Y46
+G7 X0.3333333 D07
+G0 X77 Y46
+G7 X0.3333333 D0C658898A3AA9D9CA69FA3869FABA2AD8F8382696E71538C4968828F7D8D60247E815262827590917CA4997DA55B235AA0958C757E609A96AAADBDBEA3A790BBB690AAA384
+G0 X100 Y46.333
+G7 X-0.3333333 D8A93B16F7FB5938CA8B8ACA4B19C8597756A9372867D6B738F7F7298906E867B6F605E657742466F5F497758716667B4A05484919FB0ABAD9D8A99A4B9AB9B9E76215F8B4B
+G0 X76.667 Y46.333
+G7 X-0.3333333 D0D
+G0 X74.333 Y46.333
+G7 X-0.3333333 D76A579547B6B8C8A99A3A785487AA2A4B7B5A1B3B2AEAA9EB4AC6E90739FA3A29B9BA4B1AA8894A5B5BCBBB49FC2B5A5BCC4BDA4ADB6B8B7C2B5606B7D787D77828B9AA5B3A99AA39F9EA4B5A4A2A19D9DA3928E92919C797F8B92B2B8B7B6B6B0BDBFC8C19C94878B75A1A4A2773D44
+G7 X-0.3333333 D7E175C83573D6E6A7A9ABCBAB193737DA69C9997A29D928F95929B8B8C9A9C8499909E969F91A6A38ABBCBC1AD86789AB0A090ACADAB93836C2527A88D8F9F9B919092B8B5B3B8B6B9AFBCB99FA0A7A9AFA798A59E929C8C7F67747C66797397806974929CA8A18C938D98B08F689E
+G0 X0 Y46.667
+G7 X0.3333333 DAA879A9C8E7399A082A68A27747F617E94876D6E5C8A9A989788A7A298A3B0B0B5B3B6B8ABAFBBB7B0B3B1A1AB9E8D907BB1B9AB81846B6954AAAF9FA3A9AF9593A48FA8C0AF98989A93928A97A5928F978C9E7A8AA0A88F8699A291939586789FC1ADA19D4337778851659B8689774C
+G0 X37.667 Y46.667
+G7 X0.3333333 D0E7CABABAEABC1C2B7BABAB8B8B9BDABB6BDA9816E7A7A729BAEA98F8C8A8E86B0889099B9B8AB96A1B59C887A8F795691A696A0C4C0B6B8B5AD92A9C3BBADA19EB3B6BEBEB68F73939B98AA88A3AAA5A588A26E93B4B1709EB7B96F9BA7A8AD932F62A6A79B928F7782537FA59024
+G0 X76.667 Y46.667
+G7 X0.3333333 D1159985B56274DA8B3B79D8697A6A39BAF8799876E9E8BA58E837A5E537567356D8046385E6F8B895C9973758B805B5E376F7A95383DA479ABA4A4B0B58E8AA58186ADAF9889
+G0 X100 Y47
+G7 X-0.3333333 D8A9CAE9EA1889C9994ACA19EABAF82AB707F9B907093354FAA6657447976778D7A9C7E55577FA183716F9281A097A378939A90879BAF7B969FA288A39AA3555D728B92390D
+G0 X74.667 Y47
+G7 X-0.3333333 D5699A5866E5B77A7989CA2A45B3B8A9A9198A49DA2AC8F99AFB56757819386AAB6A88AA59973976CA0B2B9BDB98F6BADAEBAC1A09EAAB9B2B5BABA9A96A9BB6E6F8F9399A5939EA4B2AA9736628087919FAB759594879468847E6C6783916D4A70ACB0BCBFBEBDB3ADAFBBBCBF832E12
+G7 X-0.3333333 D21599A8F978DB09E959492918E9D957D9A92938D9C93789399A8A996989B94A59B7B91968E868C849594BB9DAAAEA9B69782C1C3B0*03556E8F6D91B0B4B0C3758E84BA9596ADB5BBBCACB4ABAA9DB4A8A2A194A09F9F9D699C756A9497739C94876F5D0896A9998E998333A2AAB29C
+G0 X0 Y47.333
+G7 X0.3333333 DA1AA979A5E96977D93948135373F4541796E8196ACA6954B5394ABAF8896959DA28F9EA4BBB0B2B7B9A192849769A4A2A68796A8743D3BB1ACB3AFABA0C69189B09DAFBEB9B4977F857F809BA18C8E9EA39AA1AEA69CA19CA47B889390999FA98AA1ADA9B0AEB3B4AFB29FA39B8C79B7
+G7 X0.3333333 DB5B7BDBCC1B0A3ADAE8FA08B6040405869657E7A7A6472645E80AFA16C63A9A18F4E7F5B4982979BA99E99A2948B997799A3928B808A96B4B4B9ADA38AC3A97C888CA0B3C19191AB878085988577B099A89771281F7FA7A4B89D9CA4A09FAEB0A699848C9FA0A0938CA163738A96A260
+G0 X77.667 Y47.333
+G7 X0.3333333 D676F475472A6A6B49F89896C80B69FA1A9AE6994A77C6D6C62619E9D7F798F94A7955C4B556555142C6B9394928D75AC7BA4AF97A7B0BB9F9F9086B9A29E9A9BAFAC82
+G0 X100 Y47.667
+G7 X-0.3333333 D859EA59C9C999EA47697A098A098A6B1B29F6179A790A4ABB47E573B4B5F4D5B6E7E9F7695A5747F7F7C845B1F679F9F77779DA6A870745A5F959A9CB6A6A465131B593F
+G0 X75.333 Y47.667
+G7 X-0.3333333 D3B192F9A99597FACAC718AA1A0A29F83969CA7B59280989DA8B9AB5B89561C4DAB8F7A5E5F737D6D66A977559BC6B58F494A807AB087A3AEAFB2BF726C82756A86A57C72788095999FA07A7F7F282166726E789EB67C7BB8AA9563555574949D98889633668988795DA1A16D6F86B0B2
+G7 X-0.3333333 DB5B9B3B1B9A9AFB0A295A0A3A399ACA79E92867695AA9F89879399959CA6B2B39FA8A69BA4A19D8E878F9CA8A9BCBFA29DA2AFA496AEA997B4C08E5271A2AE5F8C8FB0A685988EAD8E9E93ABADB0A2A69BABB2968C78919E8C519FB6BC97789383A4824B39799D91999A8AA4A8979478
+G7 X-0.3333333 D9AA6
+G0 X0 Y48
+G7 X0.3333333 D91708E9898A9998895A8A4A49C6D95A8B1A5A38E8090B5B7B5AAA9908F949BB0B0A4ADA2B0ADAC8A6E7D9B99A5A297A38BA29C82A38697B2B57A85837582ADB6A2ABA9AC8B8B8FA29D8A9D9BA5A6ABB1B49BA4A7A08F8E93A18B869A988B5E4A8087A49A6F8D946586A8BFB0B9C0B38E
+G7 X0.3333333 D75917670747185A9ADBFC28A988E16809EA59A8B89846377BE9986A5BBB791712532532E477381868D8893907070637BAD74777F817ABCBFB0AFB0AF9D6B6DD4763866B9BD984F4E7B806287854D1F714365140798AF85AAAEB8B09A8280938D595D7E8BA6A3A0853E88BAAD8F918B47
+G7 X0.3333333 D419120
+G0 X77 Y48
+G7 X0.3333333 D043D462F67A5A0A1B29D8F976A56858A9CA590819E86A85B56706F76968A70A9774A9A6A6B4B6769374E997D7863679199839DBEC1B1B193779E999CA99C8C8987AFA38D7B
+G0 X100 Y48.333
+G7 X-0.3333333 D8692859F877A6C8FA89D9B928695B2A2AFB0ACA499A3837F898D8D788197735F3F427D5F8082927F968A583B88A27A58AEB2A290868FA35E81A49F9480939D9E6F695B
+G0 X75.667 Y48.333
+G7 X-0.3333333 D237E5D7CA6ABA49786822B738CA9A1264F3D2D8A69619DABBABDA7987AA994440F06196F3C696F7954856F8E78A2ABC0753C83A7656C85A9ACB0B5B8C49D7078808281408B7D6EA196847E9EB1530A7C5E28706C7897A0B3B9BAAC998E7A858B90AA90755785858C7F95BDC0C9C8C2B9
+G7 X-0.3333333 DB4BA997294BEC1A9A8AAA6A192737C8D8875896785809987A090979F9F9E939B99A4A9A2A49EA5A49F9392919694929FA69F92A39A7E7E96978992A3ADB4977A5E689C8E91A8B0A9A097999E9C979B9BA1A1B79C8C958A87B38C5DAAA58E95A1A2A0AEAE876EA09E8B9F97899DA7A69C
+G7 X-0.3333333 DA09189
+G0 X0 Y48.667
+G7 X0.3333333 D979F969389A49B9A9F9F94A5A084A1B4AAA1A69998698AAE57588D81A39C759095A0A2808A9E94ACAEAFA3A29DA58F73909365A88172A09C849496A8998D7FAB909CA2B0A29BA29999B1A69F9CAB928A8595B0A697AAACA78D9F8A889C8C7B64898289A9B39CC2C5A0A1BCB4AA9C9CC7
+G7 X0.3333333 DCEC3C3BEC0C3BFAAA769058274759B897E958D98808296ADBBB8AFB2A8818B9F8822
+G0 X49 Y48.667
+G7 X0.3333333 D3A529BABA7A585868D65626982448681756687C1B6B7B0B2A37F5D6C6052419BC2B3A89B8E8774357D7058667B364585723B0990B7A087A0BCB0A18C42
+G0 X69.667 Y48.667
+G7 X0.3333333 D38302885A0818344788A86827E8AA3B16E1B
+G0 X76.333 Y48.667
+G7 X0.3333333 D08183F8693A9756F779E73589FAB85608964767BA9AC8F737E607D6868788FA187756D826E52647B759F79464F95665C562C5FAA7E496D6D94B3AD9F9A978F8FA254589EA3A4A8
+G0 X100 Y49
+G7 X-0.3333333 DA8A1A56D69638EA3274F979BABB171728235298BA529
+G0 X92.333 Y49
+G7 X-0.3333333 D2B124565467A8C8E927C717E5955546CA0B78C8AA8A7988C928C917368675E685386A28C739199777086AA94A1B4AF9B84839C9D7B5D4896A88B6E6943868E9390634D683F38A394B9A16C7492AD7E084961918987845855814F4D797C8D9486AACAA3344C4E616C7CABA7A8B7BAC39F
+G7 X-0.3333333 D6368777F57A84F4D638D78A29D8DA480AB873C3068A1AC9D8291A3B8C8CFBA9F969A98969A9F9A8A858376A5545676B2BEBF*03C2C3C0B9ACA4ADA6A7B0C1A9B4C7A07F9F99A19E91A47A84988D9CAEB2A68C8B7F8489AFA3A7B4B2A49C8F83B1AA9EA0A1A19D9DAA95AE9D9D86908D
+G7 X-0.3333333 DC4C0B3977687ADADA08C869A9B9E9BA591768E99A48D85A38C8282987B7E8682A5806AA0ADA493A2A2A39D919CA093A49DA1A0A69C
+G0 X0 Y49.333
+G7 X0.3333333 DA8A69DA29D9B979BA1869DA79FA7A4A4A2A243728AA685717B7F91918BA392819F8A7986958B9A9F96949992A2A0AEA1999BB2AFBBAA845D9499A69DA4A79FA7A3A9969FB47293A39CB3BEAEA4AC95818A7A899FB19E958D908B7B847F83899DA3A4A5C19D95A4A5A7ADACB1C0C4BEB4
+G7 X0.3333333 DB5B9B5B6B5A777736B72B2A068697882A09EA2A3A4A9A0BA949A8996A0AEA2827A8BA18194909861697E7F8771809C98739F948F8681BDBEB5B0A3A790876E8E613BA9D3BE7E758289A04D40747C474F71907295A5A2959A9A60607C8D96A09A7B7C7B7497949780335F7B83617E4C37
+G7 X0.3333333 D0415446082714E67488C4B7A77306F93837A917A72706D727F48638D758AAF9AAB8AACAE855F696E698958638FAB9B868586443B3C54AF99877E8092786398A28EA1192E6F9F6F807C9DA3A3
+G0 X100 Y49.667
+G7 X-0.3333333 DAAAEA19B9668719489849D8890454245A248407693AC8E8A878A9691949A6E253A6F92776766827C82B49D9F82A593646B6876878677687F988591856B5D557B755E851A7B385E30
+G0 X74.667 Y49.667
+G7 X-0.3333333 D30244E6C7A9B604D688E9E9865708E7C95868372749182948F9B996B937CA18C716A6774676B6D9086A07D89AB9E3E41978CA19392ADB0B2BCBE5F7A949BB99880668539587D6B5A606A8F9A868D92838FBDA98B80799C879AA1A4B0A19AAD9C899596592A632D031C1A4F93B8A2ABB2
+G7 X-0.3333333 DB7BC9D9FABB6AE98A6B5B6A8A9AEB7B8C0A47579977D7797AB929796A4A46C6675A6A19EADC0B3A1A79E90AD9786B9AB8B84AEB3B0AB8F8E869189B3B6B3C0AA939EB0BFBBB0A694918F91ACB6998799A18F8985876B668592AF8851A8A4A79EB4A694A8AAB59F9096A39A999F929CB6
+G0 X0 Y50
+G7 X0.3333333 D9D96AEABA2A1A5B096A1BCC3AF989FADA7A5B7644851ABB69F7E8983906D918D929A9EB5A59DAFC2B09BC3C7B5BABFA79D99A9C29DA1939F8E87ADB6BCAB95698690739CAAADA4ADB2B9B7B8B6A5A49C687FB2A3A0AAA1A3A7806F5A6E94ACBFBBB4BBADAAB1A8AEA9A8AC978D98B6AE
+G7 X0.3333333 DB8919DB07C2319425A794B287E8D9798AAB4949FA2AFAAA19FA4828E8F889899A1A59389928C6A62719A96661940596D58859D9B6568C4BFAEAAA18E8F9D856746579A81B2B2C3A4A465777969747D8C9A89849E917C799E9A82928570875781687F796B836350494E52A3923215540C
+G0 X75 Y50
+G7 X0.3333333 D4A0C
+G0 X76 Y50
+G7 X0.3333333 D3A583D562289A9888378665B6D4B866D4D60636D736D70A3AB86A2817879915C69433F577F81873F0F3D7E8C91A6BCBCAD9D957E7043647B7B605A9AA09EAC92AF6966959CB9ACAD
+G0 X100 Y50.333
+G7 X-0.3333333 DB4ADB1A2ACA38A9A849EB5A0798A65692139635E544A5B98ADB0AF652A4A827D4C666C6A4E3F6951626A68828885818E9A767F956A393255582F2567827B886B748F89526E33126A4F497A13
+G0 X74.333 Y50.333
+G7 X-0.3333333 D232B8CA2865C6A6C85646D688880718D6D8C7E958D879D7B5B6D8597877E8EA788827B88828B9DB2C6BDB1706363535486AE7F95A4ABA3B6CD787290866972616D4A648092858678859398A5A8AD9A84999696948D9CA2A4B1BA9DA09AA7B0A1867D8B875C876E585358A2A4A4B4B9A5
+G7 X-0.3333333 DAC9798A4988F9F8998AEAE9FB3AAA29CA8A6934C65698C9BA49A99A6A78E829B9DADACBAA1B096A7B6AC9FA19A7669829C9CAFB19992A0A29FA4A5BDADB5D2C9B3B0B6C5C7C5B8BEB9989EA47FA2938E9987A186B3B6ABC2AF6682769C9D8D9EA8A7AEB0A3ACB09798B4ADA4A7968C
+G0 X0 Y50.667
+G7 X0.3333333 D90999585B3B18088B4A2A59DABC3B194A19F8B666EC0C49382AB76679E9F9F80A4C08BA3A39DB7C5C3BDC5B1B693ABCCC8C6B7B291A2989E979EA3A79FA7939594A7ADA098AAB2889B967EC3A7A3989B8D89A5A39EA4A49C8E78687694888D7593A5B39FABB58B92A4857E979D8F9CB1
+G7 X0.3333333 D98A097A6A676747E5B7F56708A768A9FA7A09FA9B1AEADA6A4ABAC98949EAE93979381B1AA9593948C5859715263716BA28B969C9693CD939CAD9E9786AEA1714C607D697BACBEAAAA645C8E849CADA1918389AB8A9793749084878D858B8298807B727A6962B0AF906B6C8C9B7A21
+G0 X75 Y50.667
+G7 X0.3333333 D2C46BA8628825581A1918B8785989B6E52528D7151557A90716F99626C7E707D8D675C816E3E5453757C7384864476A5B8AF896B896A5C2B
+G0 X94 Y50.667
+G7 X0.3333333 D0F213F4D7B338DAC957DAE8E9BB1B7ACADB6
+G0 X100 Y51
+G7 X-0.3333333 DB3ADA39CA1ACB5B89E98A597512A622E3A5414799796A97155937A83976F7793740A5A565C4D37495B61726968584B66AE7760807C7F59A1A5935D788B8588684A6B8C967B8F638FAC1E152D67A0B0959B846DA5B9AA937969838C8A848B80987772879792949E9F818A90907F9AAC7F
+G7 X-0.3333333 D887560949BA9AD724760544974929C838DA6B99B82B495AAAE8B9DA19992798199426AA0A9978F9BAC8C7672467EA299B5B2ADAAB0989AAFABA79EA99D9C99878D923C6895817E96A58EA88F8DA2929695998D9388899FAAAA96717773768B9C8D7DA79D95AFB2B4AC9C8892A887A0A8
+G7 X-0.3333333 DAF9BA1988699B2A49C9B94A59B8B8DAE94B4977B9A8CA08BB4C5AFB3B9BA979895B9BFB2B4ACBAC2B6B6C88FA2AAA396876FA1B8939AB3BE9F6F93AEA8B8BDA9A9A8BCB19376A3B17C8F9AAD
+G0 X0 Y51.333
+G7 X0.3333333 DA29EB2909E838B88A5A9A3C2BAB4B1A08AB0A5B6B8A7979CA4A9AC84889B9FA7A2BBC1C0C6BDB6AD9FB8C89A8AA0B2B7B6B3C2BE959F98A481959F949E7F98A8908A9AA594A9AD869AAE9CA8B3A78FB1ACA3A99DA5B29A949FA3988D6E6B7A978C8B80A4AB80773E8A8276798A9796A5
+G7 X0.3333333 DB0A4BAB39C91A385777E9FB284A0A399A3969FAEB4A08A94A5ABAEC0AE95435B63738C98485C9A5F75B198B2A487B4D4BAA6908F8D95AB7899B5AF857A9F9066585A7C5E64B19266996A789CA69F82849599718994918F819992749C88868489A49C764782BE92A1AD818C87985C528C
+G7 X0.3333333 D95555388A5838C9C9B612016518B8B777E827868758A716194659B997F636C68354B2B4741375566941D3E9389AC957D6B556B69A88178989B6C6F6F6D5180A7B0A494AB9F9DA18DA8B1B2B7
+G0 X100 Y51.667
+G7 X-0.3333333 DBEA7A39F939688789A9597AF857F848B87725258856F7FB79E8C929B7D99A97E76B198A5949184813B2F3D3C6372726D539464815E667354638B7B96937A5B85171552623A443043524845481D061A5A6D959EB6AF7B9D884F71A187786A766972828E9A9B877A977C6A9EA29B8F8984
+G7 X-0.3333333 D7D8280805A80AD526C72617287AA947E8FAD958B9AA9A39D8A9DAFC2BDA29DB0B18B93672282746C839EAC807A92998EA2B6BFAD9898A1ACB0AB97999295A09CABACAA916790A9C2B6886279819C9F9950849F7A5E6A8B95A2AF99708990717F8E98AAA8988C89909DA1B2B1ACB3A8BB
+G7 X-0.3333333 DBFA5A1AF8E8388A09C999B94909C99A59E9B9F8D929A9A98A7B2ADB7ABA1A0A6AFB9CEB9B5C3CAB2C3BFBFB5A4AAB8573B83ACAEB9A291A2AD9C9E8F93AFBDA6A3908CB09BA6A296A797816D
+G0 X0 Y52
+G7 X0.3333333 D62979198A2A59CA8A591AF8EA2CAB9869F96A1A68586AB9FA2B26675B2B6A1A8C4B5B9ABA5C4BCB1B5C596ADBDA595A8B99BA2A3ADA29D91837F9CA0A59A94A199A39E9BA09E9B918D9EADAFA9A49CA2B3B5AF93947C89A6AF958B96A38C7B6C8C93989F97847F8990978F7CA3A38B6E
+G7 X0.3333333 D7B4F77B3ACBEBEAEA9A59A95999C9D9BA1A79BA8A48997B6A9AEA8997BAA9D6F84A07F798894845B8197B1A8BAA49E97A5A27781A3A9B09385AE8F908095B5AA5D5580563782867D7779A1525F7898B17D747779866698968481975C33527AA47783796F8A9184BDBAA58B2C723A0F67
+G0 X75.333 Y52
+G7 X0.3333333 D3E1201531F
+G0 X77.333 Y52
+G7 X0.3333333 D1E504F9058
+G0 X79.333 Y52
+G7 X0.3333333 D3C91612E3DA3708B7664415F564C6B5E4F5E6C52285B8EAEA999A7A9AF767AAB8D84877B8A95AA9E859264647B676C8E70859F837F907191A59E7D91A4BC
+G0 X100 Y52.333
+G7 X-0.3333333 DBC887B8091959E8C83898E8C56657F2B645A717E7A8DA28AA2885F7E8B859D947298979DA3A7A2817D41685E3D4B5644344F415F593383B0983D3E6459383B167E78
+G0 X77.333 Y52.333
+G7 X-0.3333333 D2C873E2F4E321A4878272E1B398AA7BEC8A3786D6E75567D8A6C674A606D8569777D757B70685A54A18A6881A39E836F7F879760127D6E6E90B3A37A8F8C9A968D9DA9968C8C8A90A2A3B1CCA1BCB799989792976B618790AE78837AA1A290A3A093AEB0AD93A8A9A3A8ABA899A6B1C0
+G7 X-0.3333333 DBE9D9A9A996A538F8F8B79A896788592968284AAAAA294B7A06D8FAA969895A0BC9F969AA9B3B7B4B0A4AB92938DA276868882979C92999A9FA68A8993A3949F9C9994B59695AAC0A3B1ADAE9E8F999FA0B6BEB294C1ACA5A4B1B5C3A8826B8EA1A28C7F94AFA09892A4B79C8498AC96
+G7 X-0.3333333 D91A098989E936F37
+G0 X0 Y52.667
+G7 X0.3333333 D518C89A29389928E919394AB9FA49E69829EB3A19BA44B6A73839DBDBEBEB5B7A994AC9CB2A7AAAEBC94749190B7BBAFB5BCBCA79A95849192AB99968F9FB39FB386969789836F7A949087A5B7B0AAB2B6B4B6B1A487B5B9A6BAB08DAD747E9A9C9EAEAEABA2958997A39BA1AEB0B8B2
+G7 X0.3333333 D9A878384969D8092938FA5AEA694A69F9CADA1A0ABC0B4A1A29B9CA5A1A29D555F897C7B8B82ACA1ACAEB0A2B6B3ACB2A7999F8D97998A8C888E8E8772ABB589987E9070766E87717C90A6AEA37C73838F8873737D9C7C887E6B2C1D031D518596858361698BADBEB8B68A4D21
+G0 X74 Y52.667
+G7 X0.3333333 D0C2019246478381B977D185EA56F540F2E48215E686CAEAA8F6D666F41604C464E677B5A566894B8A580697A7C86A0987A855D5272697762534D5E74605B6F2F827A8D896D6A849E969F9F97A5B8
+G0 X100 Y53
+G7 X-0.3333333 DAAAEB3B29E989D8D8A908D6E929E6C5D154089809160658C8689534573383896AE8783787F898F765463428A9770444551593E3E76B1B698857273476F4C15457B8B9A808B976E775D
+G0 X75.333 Y53
+G7 X-0.3333333 D0C
+G0 X74.333 Y53
+G7 X-0.3333333 D0E333770A3C0C1C2B3956C69899473350C
+G0 X67.667 Y53
+G7 X-0.3333333 D3F363D989F7C818184838A7A7191A2967A8277829A4D5C8A7F767C92A39482896FA8C0998D847B74A7AB8FA5B0B298A1B79291A090828D828A67607B9E9FA3A9A7BAABA7AAAFAF9AABAE9F8F9090A7A2A08D819CB29E978B839CA8AAB0BFA68781A7917E809BA4AFABA2AA95977CA58F
+G7 X-0.3333333 DA1BEBFB6A499B5BCB9A4B1AAA9B3B9B099868AA090B0999EA990A8A0ACB09793AA9B9198827C83A5B5AAAAB8B2B5B78883A6C5C1BDA3A2B1989EAECAB8B4B4A78E964A0943B4A8A57E967A38A1B5A1A5A5969D75894F799C95867D
+G0 X0 Y53.333
+G7 X0.3333333 D83AA8B6D9371869B987F92939F9C946C9BA1856A91BFAF78A5BDB7ABAF99BFCBAAA3B3AAA5BBB7B2B9B2ACA2B5B9A3B6BEA49EAD9359738C9C8F8F8CA1AA978399A3A89B9C92A5AD8E96A1A3B5ACB0A4A6A3B7B8BAA4BEBCB8B07DA7A78EA895A6A69AA7A1A3B0B2A4AC9AA38D82AD92
+G7 X0.3333333 D8D8C8CA19F8FA391A3A1A9AC9689878EA0B4AAA6B0A0A9A2A6BFB3A3979B9AB297758288938F92877D93A68598A2928C7E918E7A784384ADA4956E899F959BA17E8485857E1B7E84777F7655848F7F6C5D707A7E849D662B39674B02
+G0 X69 Y53.333
+G7 X0.3333333 D1A72817E7C8377A5C4C1BFB03930607E4D22
+G0 X75.333 Y53.333
+G7 X0.3333333 D05729F8B9CA29663304F6A746B94A77E689594A48D60634B66605F858382634955685950737A8A9A998B8B54225D4883AEA8A7927940697A5411409892486DA8A889948E6F7C97B9A8AE
+G0 X100 Y53.667
+G7 X-0.3333333 DB4A28999866D85967380A49746811D3879869278664470BB8E74A86A452E787B90966D6478937156665D5F514073777B60788854516A707D777E8EA58790B090671B6C9AA3A6A8AA8B717583703C22
+G0 X73.333 Y53.667
+G7 X-0.3333333 D5AB8C0BCB37B22808F5A4B565103
+G0 X68 Y53.667
+G7 X-0.3333333 D0A6559351F449D796C6E524F7E888A7F877A7E838286798A75836A84978C938F8CA4A7A58830488D897B797C9E918AA29579818899A89C968E778DA1AD9D8D9495A7B1AC989BA7B69FB0B19F9098A09AB4AE97ACC2A6ACB8BCB2847F97A3878EAAB78E87A6BFA7ACA595B0AFA0A78EB1
+G7 X-0.3333333 D8614A1BDA7C4CBBDB0C6A4AFAAAAA89A929A91947FBAB1BD999B9E916C81878D998F8A908B8272A1BCBDC5C4AFA7AD9EB0BCBBAD909BBCB1A2AEBABDC1C6A6B7AFBFB3AEAD91A3613CA8AEA99A5F9BA3963B3A5F687D7C64305B8190
+G0 X0 Y54
+G7 X0.3333333 D9A136C24538F6F55630D2B2590B1B9BAA9B4A2728C8D8F999FA7B0B6B0BFC7BEB2ADA49296A6B7C1B99FBAB4ACA9B2B1ACC1B3B2A3877E928C7092899A969CA49990ADA3959FBA9D95A4A78E8B979CB1A7B8C7BAB1CFABA0C9B56877AB9FB4B5B79194BBBBA39C968683B0A1B4CEBFAF
+G7 X0.3333333 D93A4B6B8C1B7A0B9AB899C8E98A1A8ABA1A1A7A8A49D99A28782A6A0A677A6BDB69883A5A9A6ADA5928189B19F837C918A8C88A076917C5590AE978A839CAAA286687086969493848B91927C6097874E776067A492546D65654571180C
+G0 X68.667 Y54
+G7 X0.3333333 D1019032C4B6E434A86C3BEC1B6A62E
+G0 X74.333 Y54
+G7 X0.3333333 D210E3066976F8EA6A790936582A6AAA08279939E8A923B584B40425D5B4F4B61604F3A6C662A6B7D4B759E9A87676E6064B3B18388B16A74A4A372627F150F3F745D5E3D719272819A9775A3A8
+G0 X100 Y54.333
+G7 X-0.3333333 D9EA4748D95778883834D471C1C362A4343427F899EA9A5AFAAAD96B29548817CA7ABB7855C686D3B59684D48536D615B7B64403A5A41338A96A0783E7E90A7AA96968E90A5A5977A9D6338
+G0 X74 Y54.333
+G7 X-0.3333333 D078AAEB5BEBFBF9B78050701
+G0 X69 Y54.333
+G7 X-0.3333333 D191F3F665345779587545BA78F8E675C598C556EB39F85878B8285907A7B90B09EA69E8AAAADA1C2C9B38A736D7A96948A8F7F7EA5998D94A8AA9D9C8A8FB2B4A7ACBA988E837DA5B9A29F9B999CB5AE7493A78F8388A4A2A7BAB6B99BB09CB8C3BAC1C1A5938D9BA9A6B29FA69FA1B5
+G7 X-0.3333333 DB6B7B1ADB7C0C2AB9BBFA4BDAFB3A8969799A286909BA7BDB0B3ADA8A4A1B7CFCCA69F77927A8C8E826D9DB3B3B4A0B8A2AAC4B9A6A8BCBBB4B99D95A7ADBAC5C0BBB1BCB3A58F8E797A908796A7AEA8B7B093747C478D879BA67059792096
+G0 X0 Y54.667
+G7 X0.3333333 D8E73727D9DB5C2A25E95989FABB2A0A2ADA96D6F918C93949C9FA29CBBBBBDB9C5BCABB4BDB8B9B9C6B5A6BABBA38CA8ABB6BDBDBBAEA28181769B86A7C5D5C6C3C6C1A9A9BAADAA8EB3928AAAAEB2928CAAA1A9AEA59CB4BCB7B6B0B5BCB9B7AD9292ACB6AAADA19AA3B6B5A28C9086
+G7 X0.3333333 D99A39AB1AAAE967798807BA9A69A808E98969B9696A2A3A295759492A38997BDB59CAE9B93AEAD9C8C99A590938D8C908881698CA0AFBFC19DA59E8BADA297A5897559456C889385828BAFA6817E86B19CA07E754280516C6B2F214370110F262705
+G0 X70.333 Y54.667
+G7 X0.3333333 D034C4087C1BFBFB6A7B945
+G0 X75 Y54.667
+G7 X0.3333333 D1438AB9B9483839B9CA995B18B8B88717896946B4B5A95634B6A5A726D5C4934545D799C7B686682769FB1B2A697A09F68A192ACB2A49D7FA7941C344C33
+G0 X96 Y54.667
+G7 X0.3333333 D5A6A98A8B1868AA08C678E99
+G0 X100 Y55
+G7 X-0.3333333 D9D9B52838BA484BBA49FAB97602518
+G0 X94.667 Y55
+G7 X-0.3333333 D0FA0B481A6ACA79AA4B3A9A9ADAF9A8395A66477705C639397676757345D5C5D83725A5B51605E82898A8690859385AD90A3A7987C94879648
+G0 X74.333 Y55
+G7 X-0.3333333 D05649EAEB7BFBDBDA02E5A2933333E755F128638344B28616C866A727079A495A18C7FA4898E9E847F8C893C4187787E90A1A26947A79FAFB1B0B1B29C85788E95A0A17C79878DA3939A9188BFC6C7C7BDB5AF81A59B8EB0A697A59E98897C969C90A59D94928E827B91A0AA9B9B9F76
+G7 X-0.3333333 D659F958A9FABA7ABB4ADB29C808BB7B5B3ADBDB0A9B1AB*03979BA6928E8D99B4987494AEB297B48F94A9B3C0C6ADABC0CFBA888EA5A09796AEB9B9B1AFAD9CA9AFB8B6C0BEC0BFAAA2AAA8A8B3B6B4C5C2B79E5D879FA28F829D82AABAABA0A2A687977F7D729EA9B2C39874A081
+G0 X0 Y55.333
+G7 X0.3333333 D556688C1BC8E51B0A48E799C7FA9ABB0B3BA8454707A808E9D9BA298A3C7C0AD9FADB3AEA7A49AB0A9ADC2BEB8B7BAADB0A6A3BCAFA0A8B7BFB78B958C869897BCC6BBBCC693A0C1B7B5BDB4847796A29F6364A29DA0ADAEA4AFB1BEBAABAB978C8F9BABA6AFAEA8A497869CBB9B929C
+G7 X0.3333333 D9E98929A899796808798A499A68C9EA0969BA6AB9D8698A19CB7C1C4C5CECACEC5BFA996A1B08892908B737C95A39F87779290A1A9AF99A09BB91454A4AA937F7B8F838E9987817FB0A393957B86687352628072576A867A808619698D7A706F3D2B4247
+G0 X71 Y55.333
+G7 X0.3333333 D52B0C0BBB8B4B1936E520716
+G0 X75.667 Y55.333
+G7 X0.3333333 D3FA09EA29D8C93848D979AA0917AA19E91848465635D65688854484A63873E64996C465686623A886A397C97B2999EB3B09792B8988BA863
+G0 X95 Y55.333
+G7 X0.3333333 D151D8AA9A393957CA5A47999969F81
+G0 X100 Y55.667
+G7 X-0.3333333 D90A0A29899B1916E8E9F9CA761
+G0 X95.333 Y55.667
+G7 X-0.3333333 D24331E7A8D958BBBA9B2AA8EB5BBA58AA481697C56507A844F4B527C538C928166587462456386607E8F92AA89838EAEA588767191A4A4A3A5A435
+G0 X75 Y55.667
+G7 X-0.3333333 D3B67806A7FB6BFC1C3BD902C331E5E5D4D582469806742669D948F63565F594C60AD776E888787A1A471899B61436C778F9B8FA8844B3EB291918BA59C8E9CA9A6959BA185836E899DAB97A4AF9FAE8A54618886B3BFC5BFB59E96ADA3868796A0AD856DA1A2969585788C948A7B7998
+G7 X-0.3333333 D8C88B3A7B8AD8D9EA3AEACACA2AAAF97758BB1ACB8BCB9B3A39DB1A7A5957A7F9FAFA58B8E8BBDCBC3AE999590AFBFC6B285877570A17A94B9ADBFAA9AA6A2ACBDACB0C9C0B4B7B1A2A4A3A4B5B3BAAEADAEB7BC9B8F7C9B908793764A6B967DB4B6C0B5A0A4A8A063731B3D9AA4B236
+G7 X-0.3333333 D66
+G0 X0 Y56
+G7 X0.3333333 D8D7DBBA48A1B598564A5ADB6B0B1C6B1858A9D61624395959396758B7697989F99BAAD999DB0A6A19FA6A9B1B3B9BAB6B8A8B7AFA2ABBAA0AA9B7E9DA883988EB1A3A5AC828CB5BCBBC0B4A9969A90ABBD95928A8F8A96939B9E8FB1B6B5B8A98A92ADADAFB0B1B1A6A1A0B1B6B5AC7C
+G7 X0.3333333 D86838B8B8F9A9598A0A6A3B1AA829BBAADA9BDC0BCAEB4BEB5B49BA66B
+G0 X47.333 Y56
+G7 X0.3333333 D37523082C0A3A59BAAB2A4807F97A3A4ABB3A796A393A6AD8F9C9CA2797B91969B979B7C846A8AA36E73ACB4848673686391484F4D6A6F8083767775856E20
+G0 X68.667 Y56
+G7 X0.3333333 D353B6042243070
+G0 X71.333 Y56
+G7 X0.3333333 D9DBAC5C4C6A272698E7B1D
+G0 X75.333 Y56
+G7 X0.3333333 D1464949198ACA9958F928688859687659998966D6E5F6B59404257817968618172655582AA766B636D6D86948592B9AE89ABB39DB0BCB5AC9A706D0C1E88AD8BA4B6AEA890A7AE93A3A0
+G0 X100 Y56.333
+G7 X-0.3333333 D9F9E8FA7AA81A5AF969FB3B86B29929E9DA9AFB7ACA98FB4AB9BA8A2A28A667F8A806C63648A98AC8F525C57704B5C717E61897D4C636E5C869F747794959B988185999AA8A181853F
+G0 X75.333 Y56.333
+G7 X-0.3333333 D165C87718F8CA0ABAEC9BEC237553A
+G0 X70 Y56.333
+G7 X-0.3333333 D1C24
+G0 X69 Y56.333
+G7 X-0.3333333 D093A6B706C3E3B648C7978815757427B82737C4B8CB2ABA6A9A9AD9BA68D8797AF9D7C83A4AC8F99A8A6A194A57F9CA8ADA8ABA8A9A3ADA3A0ABABA4A5968C9325
+G0 X47 Y56.333
+G7 X-0.3333333 D20663C3E4667A8BFC2C4C8C5BDBDBCC2B4B4BFAAA0A3A1AFBDA2A9BFB4B4B0B5BB9C9AACA1ABB2AEA9808A98A1A9B7B1ADADA5A59A888184858DA0A8BEC8A78F96C6B0A2C0B7AFB5AB6F75839AA3AA98B0A08EA39F9E9F9D8BBCBFA5A7B3BAA1B4ADA8ACB1A4929D7F9DB7B795969F96
+G7 X-0.3333333 D978F979E90A48D6D908A7F9583B0BDB6C4B7A8ABA8A6A09AA6B19AA094
+G0 X0 Y56.667
+G7 X0.3333333 D90983C9BB1C5929BBBBBACB7BCB6C4B99EAC8FAE9E949FA98CA7A9A59F919BA9A9B1B87F867F669FACA9A3A6B2B3B0B0A3A8A2A68D9C84B191927993999F97A07D6A8B7973997D7F767E9FA19F84AFC3BFA575936BA49B8F92A6959FADAEA39294899B7F96B5B2AAAEAB8BA9ADBCB6B8
+G7 X0.3333333 DB47D5C7A6F748796A5B3B3A3A0A8A694AAA3A2AAA49E8B34737C2C0E
+G0 X47.333 Y56.667
+G7 X0.3333333 D3E868EA086AAACA1B2B59AB0B0A5A6B1BAA89E8FA1959BA1A19991A7938B82A1BAB08B96B69EB1B4A8B3AEA49D6E9078575B38577C84807D9278422544323F58603E1C2A114F2485C5C6AAA8A792969E69839D4D3A2F6E9BA88C929A918A9893998D8488939C8C703B629ABA7E7E503A
+G7 X0.3333333 D7378707699B0AF8E786A7B7EB4B4B27173A38591AB9EAAB0A693AAA7A76743627C9DA6B67B8CADACA1AA97998FA2
+G0 X100 Y57
+G7 X-0.3333333 DA090A49B9A9EABB28776A5616D3813327AB28B9C927FB384899CA7B3AE795E8E9BAD6C6C988C9BA7AEB4AAA8B1BA7C5F8385C36D26356E928D7C9093959591A5A79A9F7E7C9D97692B
+G0 X75.333 Y57
+G7 X-0.3333333 D77908981938E91BF8598C9BFC34B01181F4274605E686C66777E867C7566696468654E6A9378939FAFC4A6A0BEAA84A89D959AB1AC9F958AA38D9DA99398B8A5B1B1AFB5ACABB0AFAA93C7B098ABA79AA99D9C82553E54689B91628DA168777F8DA092798A9490AA8B9E806D7E7A9080
+G7 X-0.3333333 D90A6A9A3AE8E8BA6AAAEB0B8C09F8BAE7593928BAE9A9F8297A0B7A561817D92ADBFAD8F93897E938488788993717CA5A87A979787A1917E9D9DAB92A0AB6F7B97A4AEB0B2AD9B96A4A3A78E845E9EB5B9AAA4946E9DA6A2A7A3A881A8A5B8A7BDB6C0BEB7AABDB5BDB6B2BAB29F9C8B
+G7 X-0.3333333 D9E89
+G0 X0 Y57.333
+G7 X0.3333333 D5A7B8B89A4B7CA99B0B0B8C2ACB9AEB19CA29CB1B0A06F8FACA5979D95786C9EAAB2A79B6886B9B9AFA3A2AE8F93ADB6ACB9ABA096A4A6AEAFA9919B9EABB29E8E8A908E9E92715F8C94999BAABB96A2C1AFB0B3AE77A3A7A8A49B80768C8FA39784A48BADB5A692B2A8B8A09EA69EA3
+G7 X0.3333333 DB1A9AB84AA9E8098947E9094A58A7C999F988881959F85A38073917A92A1A29FA7AFAFAD9188629CB2B7B6B0A08AB3AEB1B6B2AA90A3AE96917682938D979F9AA6A9AD735FA08198A7B6B88E7777875E726B6F5F4276807A7D5D3B5A47767D8A8E755D4AA8C3C1C8B282A5A7985D70A2
+G7 X0.3333333 D7A873C2E9C37789F867CA8AA879182929F888086796B574A7DB1B790ADC1AFADAAB3A5678EA585A464779686818CA9AB977F807B749590AA9B9486B88C1E4F6687944E46B2A1A29A9EA39DA2
+G0 X100 Y57.667
+G7 X-0.3333333 DA98E97839BA79BA7A69A8D9CA00E21B39A849E9F848B9EB46F6F2C7BA59C93959F999DAA9E87867E8694B3B7A4ADBBBBADC3B19E6169688776758CAE785F6870757C768495836C6E3497828C9C856B9F99959EB0A4BDC1C3A57E7E3936649136617C411217605148716F728193826694
+G7 X-0.3333333 D9D7A8E99A6865F6D8397A5A7AB9D74959C9B96A2A9A7AE92AAB198A1B5A8B2AF92BAB9A6642B8E8689B3B1AEA6B0B0A38491718F948DAA92946E72986A9896B8A2765280949790A58EA2AD9893979894A1BB82A8938A8E91879D8D9CACA3887A7B808CA1927EA3B5A78BBAC4C6BCC4C9
+G7 X-0.3333333 D929DA07D51899268938F7E949B8FB6A1B69A98AAAF8F8F8BA07E7E9EAE9092A0AFAB9EB4A6A3A7839EB0AD8A766B4B839B79A1AA959F99A590979399B09FACB5C3B2B7A49CB69A98AB8B645C
+G0 X0 Y58
+G7 X0.3333333 D8EB0A69FAEAB8C99B9B8A4B89FA0A5B99092A0ABA7AFA89296A085A476275F86A7A3B2A4A5ACA59E8F9EA8A8AEB9C0A8786352818D9499AEA99498B6BDA983979DAB8B8B8889887A8F949EA8C2C8BEB5BECEA7907C98A6B9A891708682829BA19F9FAAA0817896AF8D76BDBB997C876E
+G7 X0.3333333 D57B9A1B3ACA1B2A299889DABAAA672AAA7969B96879595A58582825DB6BDADACADABB2A3B22C058388ACAAA3A6B5ACB9A1A6859BA9A7B0BAAEB3A1AB938DB2AC84978494987C887FAD6F21808B70779B6969676D323B67030D477483559362525F6794C4BFC49A6C57719E8C9993999D
+G7 X0.3333333 DAF90998E76858D999A8A526288925E759D91687F5A2377799EA79DB4C3A5A292A3639E959BA3AAAFB7B8A4998E7C798984628F6B85A48F7FA8A47F89AB595CABA27E80A598A7908C978E9A8C
+G0 X100 Y58.333
+G7 X-0.3333333 D84979B9DA48AA76E2A5F7C949DB3AD3E7A8A9E9D9C9F8786A4917E7C50376E738EA9B2BFB5A895A482A59096B0B28FAEB66992A4A1945E575864738781568786616799A4A384979A8E979CA38684B6A6AFA78A854175C5AAC0A35C8D6E6C79906D531F2515434A234473748193966760
+G7 X-0.3333333 D836B588165747EA5A7938A9A9BB2ABA9AD95A19AA6AE93AE8F7EA5BAB4AFA695B9A89E838C895E6DA5AC92AAB1AFA999ACA79F98A09FA0958E89A0A89B96A380A29FA8A1ABB9A2928A8DA3937EB3959DB2BA898CB98B569193A89A919B987B5258727995ADB1AA929DB1BDB6B7BEC0BD
+G7 X-0.3333333 DBEAC8C876E929DA47377868993A3AFB3A6A49BABA3A69E8D7B81A27A97B0ADA6989582B49A7291AE9CA893B7B06D4C899A808F8157AEC2ACA49EAA94A998A395A7B6B79F91A7B69C987087A3
+G0 X0 Y58.667
+G7 X0.3333333 D9F958DB37686B0A48FB79C9C8EBBA18E989C969DA6B89B4E9F7B668085767898616D90A79F919EA0A7AF937DACB7AAC6C5C3A49C9CA5A594A69DA9B8A8AC9DA77C504F6C867D7B6EA39BACA8B1B0BDBDB9B3B3B96688AD9B5A618A53547AA79E9283938D877BA1A69F92A5A6B09C9EB6
+G7 X0.3333333 D9F639594AFABB5B6A59FA39F7F82918B8E94A19E94A4A8A48A92B0B3968DA19B93A288A6ABA2A4AE9D9EB8ABA6B2B1B9B89386A8ACB9948EB6BA9F87B3B4A5ADBB6C6AA379A09F775680B08D9EA3938B693A303E5232
+G0 X66.333 Y58.667
+G7 X0.3333333 D0827115075877C7A698F83AE9AB1AD90A49AA0AFAB9EAA829D85806F84849F8695AFA38E617B5F535A5E6235707682AFB7A4A291999898A9A6AAAFA4897095A5A69BA69D916C743B47577596928D9994889B92804D759279B3767B782380774FADAAABA9B6
+G0 X100 Y59
+G7 X-0.3333333 DAAACB1ACA995989E87AE6A94A140759A889996*03866D8E857472764F337A5E7DA7999A9DAFB096ADA1A2ADABB3A6A19FAC9FADAC9AA980925B47875E583B4869A0999D92717B37447E7E81969D9DA0A4B4A2A3806C92BCADA78B8E60436A94726843540922130E37100526658C9AC0
+G7 X-0.3333333 D9689AC7E66899D9084716CA8ABA19C9784B7AB9F9983B4A5ADAAA6B3B5C3B29FA3B3B9B7AEB1BAB8AB91A5719D9F949BA89EADC2A7A8A493A3998B8E8E94A19B99A5A18FA7AAB3B7A1A4908CB69B999DA59A91A6B1AD8F8FA5968091969692A0A4B3A7839BA28D95C0B7BCBBB1B1AEAE
+G7 X-0.3333333 DA9A398999A81769B5F2A56849EA5AEB1ABB2B09A93A89698B3ADBEBEC7B4B3A5959EAC9E9091828D9B8C976B74878E6D6190ABA589A3B89FA5AF8F867F839592B295B0988D9A979FAEA6A796
+G0 X0 Y59.333
+G7 X0.3333333 DA3A9*03B8A99B85979C89AFB69D838A937988A4A2AD968FA5A9AB75876C405D9379848A95828698C0A59A9AB8BAB6B2BAC5987DA4A4A7A498A9A488A7B0B99FA16E2B226E801C6C85A5A4ACB0AEA6AABEB5BAC4D3BC87A793B0B8909D8177779BA99F9AA299A8BAA4939B9B939DACB79E
+G7 X0.3333333 DB19CA7BABAA19572A2AC9EA0B1B3B19C9499A19CA4ADABA19EA8AF8687A5A3A3A9B2AAB4C0BDABAE8FA0B5ADC0C7ACA8ADB3B0BD878BA197A49DA3839AC2775EB2A57E9F9B9370778D8BB095787E66231D575A1F544A37556E4C7A9E8065899F8C9CB2846B85749AA3B08D68918D876D
+G7 X0.3333333 D7EA02608341E817990A05F2151737DA68084777A7476B1A67395A698ADBCC3B49AA8ADA39EA0A6B39282445F5E646C3F668E9D79757A747E95A0938395A69CA285A48287B4B4B9BABE9B98
+G0 X100 Y59.667
+G7 X-0.3333333 DA5B4C2B6B1AAAB8259A6739AABA27F8B91946F5975827E6671826A5C6A5A57636168819A8F89ABB1B2A789A5B5ACAD9E847D77869D937179707AB2986E6066424D787E8746164E0F0EA3A68E96A19E877F9099A197928685A59D87929184929B73463958746388367E93873071A17A79
+G7 X-0.3333333 DA197708B5A6A929AAF987E6F8EB9AC9DA09594878E956CADA4AFBBA5A9B5BDBAB79E9BA8ABB2BABB9A94AAB0A6A78061BBB0979AACAF9EAAB0A69385A5B5A5A5ACB4ADA5A29CA8A5A9A292B0AEABAF98B99E93ABA7979C9F8DA6B689908C889B91B7B9B1ABAEC0C4C7C6B2ABA29E858E
+G7 X-0.3333333 DAA9F7A5B53695C716DA4938DACC2A1A38CA0A4A7ADADB99479BCBDB0ABB5B2ACAABCB696B29382A193876595958A778995888DB8A89AAEA5BBA096BCBB9E749AA5868F9FBBCCB4A8BEBCAA9D
+G0 X0 Y60
+G7 X0.3333333 DA0ACC2B5B9BDBBC7BDA99399839AB2B5B4B393A291A1A39DAA7E7AA6B5B3B5827A9EA5968B90B29698B9BCB28F7697A4A8B0B9AAA29C9CB3B0A0A499A39EACA8A3ACB3B2849E87652D579F869A8A608DB1B3B2B1B4AEB6B59CB2BABF9E9E98A18392B19F9B8C9DC1B79488BC8FADAEA6
+G7 X0.3333333 DAA95A8A0A6B5AEAEB2B8BEBCB8AFB19F89A7ADB5B0A2B0B5A79AAFAA80A7BBB8BEADA19DA7BCB7ACA3B0B7B4B7BAB9A1B1B5B3ADAC978F8FA193ABAC9D9DA0BA925C977592855B61968D7A8E829DB19C6995949698A7768E5B453F096696909787949F9E937F9BACB09CA291A9A7979C
+G7 X0.3333333 DA4B3A95165603C5390756D6E6C54418D93A3785578A8967883A3827793998492687FADB7A8B7B3AC828D69667B6586746E67736644587D785A898F908A8D8F967971A994A2A0A292A6B3BA99
+G0 X100 Y60.333
+G7 X-0.3333333 DA5B1969D8FA3A2A197AA9D747B94987F8D8269544E6A74535E8189989167667D4772ABA4B1BDA57FB2A9834B7F746E759499999898A59C8770466B8299834352557E9C8075866B90A4A3B8B0ABB49DA1B1B2A7AFB2AC9A98A2959F879CB6A849514B71714D9FB7B482985A77968B9D9D
+G7 X-0.3333333 D9A75928B725A625834896A879594A9A3B9B9ACA9AB9D98A5ACABAEA8B3C2C2ABACBCA8A8B3C1C4A0A49FABB7B3B1B196A0BBACB0B8AFA6A8AFB8B699B1A69FB1B3A2B5B2B0B0A5ABAEB393AA8F9EACA78F568790B9B27984A99F839C93A1C2A8ACB1A0A6A9A6AFA4A2ACAB9A67307C97
+G7 X-0.3333333 D6AA18C76726FACB67A84B7ABB79EABB5A5A2A5A7AA969CAABDB9A8B8A8C292A18F8F938C86B6A48D7DBC98598C8F9CA9A194A0968B929C9093A4AB99AABC8E7A8588B1C4C1AEACB0A3BDBBAB
+G0 X0 Y60.667
+G7 X0.3333333 DB0A4ABAAB0B6AAB5BFC2B68277979487A39FBBA5919F7E7896839D9394B183AC836A9D8E8E6C97C097465E999D6BBF875FB8B2B0B6A79397A7AABBACB5B3AAB9A7A992A19B94887594889AA484843E062DA8B4AAA8B4B49FB3B3AF9AB5C09A75AB999A9D827D899974988794B59698A7
+G7 X0.3333333 D9C9FAEA6A889AEACA4A5939BA1A8B2BA9AA8B88E9DA3B2B0AA7CA2A971B29886BAADA5B7C6B8A0BFBABCBDBE98AFBCAD97A9AC8C617D9F8EA7B29FA7B0A69995906F924654645D8D7B8A9299875D5B8434886E5B9EA6753F555671827595BE9E908997A2A3A6A3B8A4A7B1BE9290B1*03
+G7 X0.3333333 DBA9E9291947F62817963576F7C8A798B6A699B9BA6A2A0A898A2A87D857B7A5280B59D9A979994A4A9864F76775990A76060817075815B5A76431A7F96976B7EA9AA8A87A9889CA6949F9E
+G0 X100 Y61
+G7 X-0.3333333 D849A9C81608DADA18791A364616596452757494D5172846B7D8B927381605941897D878895A19DA093B17C4D707B93A39CA39E96ABAF9A7C85AD677C83639786898561947B81928C919EA2AFB2A49DA6A6ABA0AA8BAFA3A28289898C9FC29E634B63665C556B9A8B762E97889E514346
+G7 X-0.3333333 D7D809A9E7835556871A199968587A1A99AB0B3A1B0B3A099B09CAD8E96C18D97BABCB6BFB99B8EC5A65B95C1918BC075907769B5A0A7B18B79ABA8A699B1AB98B4AD99AEB4A9A2B6BCAAA0A8AEA49DABAD9FADA68E8AA29F8CA19F9087959FA1A0BAB5ACA5ABBBA9A8A0984255619084
+G7 X-0.3333333 D7A3E48A38970A6AEB78BA3A6B2C1B5B1AEB0B8AC958FA8ACAEAE9F768DA09B749E745E89B2947C8FA39B938F6F7A95A993868F977A87989691A8AFA9948AA28E86AAC1B6B8B8B2B1B0AB99A3
+G0 X0 Y61.333
+G7 X0.3333333 DA08E96AAA7AFB8ABBDC0A25A83A590ABA876769BA08399AFA5A15886995D7062798CADA7B2B48B7583638A98828771929860A1AAB3A58895A9B6BCBDBBB3ACABB1B5ADADB8B1978FB28E5D51554B0561809298A3A9B0A8A28F99A7999A9187899E869B8F9AB5A6A7ABA99DA4A9A1A9A1
+G7 X0.3333333 DB5A07D9EB4969EB1BCA7AAB09CACA68C9F98B79B8E9E808E919C896284968E9CB9AD6876B06C99C2BCBBBDAA8996AD8597A5ADA8A891B3C8A69EB080A3A15A8F9899A77C705F4F83A7887B7E42774A9EAE73516BAD9866768C7331
+G0 X68 Y61.333
+G7 X0.3333333 D4BA9BE908390484F87A7B1969986957AA2B4B0A89C8A9F9C9E8F5F7B874A443F819580777091888083A2B1AF99B18845887348705B85A9A7948EB1A0727B79413887804C82C08C7158859B6228
+G0 X94 Y61.333
+G7 X0.3333333 D3076443E526A8598956677B2AE69677D9365
+G0 X100 Y61.667
+G7 X-0.3333333 D52655963957E8C474598677C6A3F131B44
+G0 X93.667 Y61.667
+G7 X-0.3333333 D2457809686858A9BA27686A48A765A5A9595A0806ABE8A56725E4E3A817B8F99A69992AA8273699580797BA87A40535371A6758DA290A6999EA09C9A89*03799CA1AA92691130665A8FA4B449
+G0 X67.667 Y61.667
+G7 X-0.3333333 D7264779A77548A717D8D858F8673395F9E9097995F59847E897D8576527D8982ADA29F938A849889B1AD9299A59B98BEC2B9B8A9658F9D759BBA8F716896724F90ABA269708177729A5382A2B2A7AAB59EB6B5B1B0A2A9A099B4B8B0ADA1B2B0909EA7A9A09F98A1A48BA0999E9F9CA8
+G7 X-0.3333333 DA99A8B9FA3A3949F996D56242C18506BB0B8938F879BA4B4B6B0A6A4BBBEBFC0B099A69B9EA4B89A7950AE9E4B3D61839A958B4E7C9D9DA7ABB19A62736B8F90697794A19090ACAA928A9BB08A8C867FB7B89FA4AEA6A4A69E8B8C
+G0 X0 Y62
+G7 X0.3333333 D8782BAAA9B86AAAE9771B09C8D7B80ACA0A8848F9C7E675F6F48608E9959696698A5AEA7BC7380643E7E91838A72618EB07D5D88A597A7B5AB8FAFCABCBEBFB2B0A8B8B5A7762D7498619B982E5662
+G0 X26.667 Y62
+G7 X0.3333333 D279D919181968B96AA9B9FA89AABAB9F9C98A6999EA7A8A1A09096B2AA8BAEBABABE90AE9C9BB68C84B2B3A4B8C6C0B29877847E96946C858E91958A6F8B8A6B8D8C9C94A581879BB7AEBEC2B194AEA7A09FA997827682836D9C9F9F947B83718163717972585067849B85623F5A9977
+G7 X0.3333333 DA18B646A7887AC7587633A3CA0A38E765825120F4D8AAAAAA9889B8364597395B6B5978895A1A89169537B8B6E7A76858C8F984D72AA8688A98A8BAC825D5A7C4F567F6F7B8E8D8695616C8D6C999073978E8F8F8366776E754E1C313452344E5F71536B6F536DAA968C5E43
+G0 X100 Y62.333
+G7 X-0.3333333 D4C849E9677988A7B393E4B484B4112283C5080452C78073279749BA68892868773997A768182A9AA7F5F7B5A4F7888879497A28A90889B603C818981767B64808E86767B7693A1A3868AA8BA938545469B807C859D3D526E254E9B7963A4A792944F6C6D6CB2B2AF877E7FA44A808A3C
+G7 X-0.3333333 D5F797B726B69807A747C8B66778E8B97A8A5AB998E7A75859F9E95AAAFB5A6999BA7BCB5B0B38A9D8CA36C5B6E8F9F99AA989067716E527D7D749789A1BEAFAC79A4968499897588AB7FA2AFB6A087B68C8FA89AA1B8AE9AA694AAB6939CB1919DA4AFAFA9989C918C885F05
+G0 X26.333 Y62.333
+G7 X-0.3333333 D12769FB2342683376A3E58B1848CB7BFB4C2C7C8B9B0A5B0A2A8A9968D8D8E97BA9476879F791587A8819A999B9680667033834E577A66556F72887A8A8F9FA68C8C9E9E7A9A94997C8F93BBB99A87
+G0 X0 Y62.667
+G7 X0.3333333 D4B59A49DAB853B8E91A361747E8A94AC9E8A76527062576364664C4A696D6B4661809BA38C8DA39068667281619AB3C3BFABAEBD8A7C919C9C9DADBEBDBDAEBFBD9779955373A61D365E225EB39F39410902738DA1AFA4AAA7B5A49CA0BAA39AAFB987A49AB2989C9CA98E8AADBD8A93
+G7 X0.3333333 DB59DA1A99884777C906E5A78A17CAFB9B1A8A788755F7263877E889CAEA2777D6C8188A5A8ABB1C0ACAE826D8DAFB1B7AE999391A092969196A59A988D8A8B8D7F83735142656C5C6256746943886D4180859691AB9FA48B8D87536E7BA56C5884A57976422345889498666F376D9AA5
+G7 X0.3333333 D9D94A39E9AA1ACAAA6A59B93A68C88847D94684F665295793F889D82759D7A544A4E6D7E76A49786799D9650905572A1A78E4C5B3B2E4F
+G0 X93.333 Y62.667
+G7 X0.3333333 D047861313F61793F3A2D2B388F967E6484725B70
+G0 X100 Y63
+G7 X-0.3333333 D68554D768B729A8321
+G0 X96.333 Y63
+G7 X-0.3333333 D291E228449174D23281D5034402066899C96695C693977975584A68F813D414F4041757D49837D6F5B83975055696D7A9999A5A8AA9A9CADB59E937E91A09DA392A26F70675E679CA29393171F7670655E344A99855C3281837B7893AB7A7C8D8641455C568594859E775A386E6C877A
+G7 X-0.3333333 D7E818D90919A938D887C9596778B8C979FA793A8906972A9AFACABADB3A7A6A68E7C5C677E7B87865E5C958D9F979EA49FABA48F8A673F4B807E899BA0998FB1B29282A7A9A882A195A0909B969A8BB48DA7AEA9B0AFAE9EA4A894A286758D5C3E8DA490722135820F10453D157EB9B7
+G7 X-0.3333333 DB6B3B2B2A8AD9BA1A6989493A1BCACA7AA9C7FA6A78E7F8E7986B597A6AF9C8864454E675D4B5D7558786F5E7B95798988897A962640917980B1965054A57371B4
+G0 X0 Y63.333
+G7 X0.3333333 D7F9DB09D64477A7B9576817973A3756B737889887776918474796C2F4679476D8B95A89B94A18B85A2927F84A793836A7396919D84BFA3A3A096A5B0A3A6AFA6A1A89A524E5E7959
+G0 X24.333 Y63.333
+G7 X0.3333333 D2D
+G0 X25 Y63.333
+G7 X0.3333333 D225D3B828AA79D9A5870868CA494ABACB9AB8492B59C949A64838E9AA0AD9092A5A9949097A2AE97757D8783613738476E6F8F81974B808C9CA8AA9D8A727767747E677A8FB2B2A1A8B0A08FB4AE916D7D9EB3929DA0938980488D8A9184857D879EA28087828C8F7B6F576D86B8968F
+G7 X0.3333333 D91662F68688A8A6952AE8E726E7D7296846B8C44414E3D653B4B3686AEB86030798F6972839498A998B079847598A37696A69B81C58C7F77514469A59B8C7D67746053634B546B4B97A56E946D6A9F90646469756A8E68180E19646C7428321E124B4136511F
+G0 X96.667 Y63.333
+G7 X0.3333333 D04084C6A808360785771
+G0 X100 Y63.667
+G7 X-0.3333333 D85938C81755E6E896624
+G0 X96.333 Y63.667
+G7 X-0.3333333 D15443009042A19200C488256
+G0 X92 Y63.667
+G7 X-0.3333333 D172C463A656D77865989738277809E9E3869A250505D495C6A627EA097A67F68542A697FA77EACB2A06D5E8A6498A4A7A5996B719294647A571F7681957285715F946D4A0C396B7A8E765879AC7C6D977186938787A27E9C556B959E8D7D9C86778F848FA58E7986676D8871748A9D72
+G7 X-0.3333333 D86A897A396A7B4B8AD7D8596B49C817C9C958FA087939695724B7D7079568A8AAE76826C7A899A8F4C3F383C453C725E6B7F7F8799796F8C73879A9BAF9C92544196859FBB857FADA297A58F8E9187816D91A8A299825061
+G0 X24 Y63.667
+G7 X-0.3333333 D559F387862A0A39EA8B4A497A0AF938C8D99B08B817F85A1A27DA89D8E838EA37572A09BA6AA9DABA3915B2314744A4F5D647C73353A77648582836457948F86253F5B864FB3B6B2
+G0 X0 Y64
+G7 X0.3333333 DA0AC9A89888597998538274A28254B7E531A
+G0 X6.333 Y64
+G7 X0.3333333 D32800E
+G0 X8.333 Y64
+G7 X0.3333333 D1A8D5B4C548A63A1A5ADABAB8D95AB918299808FA18A93A192838FAA9E9091A5ADAFA6A1A3A3A293A3A9A6A09CB23D2D11
+G0 X25 Y64
+G7 X0.3333333 D2C597D90A7AEAA8D68637B98818C978399AFA079A590878E576C8A9B9D9B96806F584F766F82867A60745628665E6F8190837A83A0A28981A37E8E8A6C69788F9483828057549C883F557F7A997F8DB7C3AAADB59B9FA3A5979D777B58795781952A4477A57C6C89767A8EAF74817C57
+G7 X0.3333333 D6C8BB0A281696487786E475689663C498A68593B0A308F8D89879087857891655D5D687D9EA57F9EBE9E535164967482A0A5997F8C85472786A678947E8B5D2C45396F6E42686C9C515B72979B533F736874665D4E576A681532520D2C1D
+G0 X95.333 Y64
+G7 X0.3333333 D194F08
+G0 X96.667 Y64
+G7 X0.3333333 D07678F90936D69A0A3A5
+G0 X100 Y64.333
+G7 X-0.3333333 D748F9282808E8156
+G0 X96 Y64.333
+G7 X-0.3333333 D572E
+G0 X93.667 Y64.333
+G7 X-0.3333333 D2E0C101A306D8A6F8279564979775A7974A1A86A3449835D73765B7F844C557A79789D9298747663657C7C6FAD98A491865D4C90A8B6907D9A83448F8DA49C897E7E7B779CA9869647
+G0 X69 Y64.333
+G7 X-0.3333333 D2B594D57464070946437385070575D6C7F867578728C8573C0A885969886598D5437617AA16064589D5A779D828EA4B19DAA7E8AB6866A818A5473415F7D59628E74918F8E8770316F7D74858F83898888638179A37C68724B585F79716D7C6F50316C7294787B837791858566998C7E
+G7 X-0.3333333 D9BBAA29C9794929593874C65909DA3AD967E501C468AA5AAB59296B1AAA897A394ACACAFB9A6A19A96957987A78C889778A6AF726466A1C19178B4B4A18B887874410D11360E
+G0 X7.667 Y64.333
+G7 X-0.3333333 D40
+G0 X7 Y64.333
+G7 X-0.3333333 D433C
+G0 X5.667 Y64.333
+G7 X-0.3333333 D2325017C8C34
+G0 X3 Y64.333
+G7 X-0.3333333 D74B9A0AE959F9AA89B
+G0 X0 Y64.667
+G7 X0.3333333 DAF969B*03A491654204
+G0 X3.667 Y64.667
+G7 X0.3333333 D1F48620F
+G0 X6.333 Y64.667
+G7 X0.3333333 D066821977908
+G0 X9.333 Y64.667
+G7 X0.3333333 D075B317E766387A0B3928AB3A772646596748381828FBB9590B78684959CACA9ACB28C9BA0B6*0375559E9CA0C9C7A86997B9B49BB58B74687F71518595798F8883A5B38E8F9086968C3D57537290837157648D9A5B8B85845F4F8D86807C51787E75598575758C5361787575738D8777
+G7 X0.3333333 D8A89796669735C694B957B6885864D53AD99A7A978789855748C3F36A0A4854F424F81909D9F9FABAF83838B957497785C657469636E5E503142656266633B585A1B15758379B5A7737AAC8F85A4AB82A2856E7A7D8C9F8E796770869EB4917A728D4A4D6B89828A9C968280475C5687
+G7 X0.3333333 D8474654560674A67A28868727E65655D587E8478AA96610A
+G0 X93.333 Y64.667
+G7 X0.3333333 D0E
+G0 X95.333 Y64.667
+G7 X0.3333333 D6336
+G0 X96.667 Y64.667
+G7 X0.3333333 D011D3683827C967F6276
+G0 X100 Y65
+G7 X-0.3333333 D928B7E91798C89885A1E09140F6932
+G0 X94 Y65
+G7 X-0.3333333 D2E02
+G0 X92.333 Y65
+G7 X-0.3333333 D2F867789969E95756B81714B55625C9076615D803541866E614A485F676B718C918E7B4F6C496E767AB193A3997D63608F92B28A6E696189819EAB9997A79693A9B2859E6D2C375D615E5D6A4D5853527E47457E7D697B705A8B81639A926E8AA3869891BC9C2E5A609A84A671546E63
+G7 X-0.3333333 D65806F75A096AABD7A355E7C7C8F917F633E46865E6F8B6562717E59766F7A7B768D77795B808E7D4F463A549C6D546E917B648E71867E713472867A56291C6A6473876F718980528490849E843B7D9492675DBE9AA276A3839AABA59DA4A4B493BBC9AE95909BA7A198A4817498ADC3
+G7 X-0.3333333 DC28B9F88485F828373938097B8BA99AFACB39494562C4410
+G0 X9.333 Y65
+G7 X-0.3333333 D0A56
+G0 X8.333 Y65
+G7 X-0.3333333 D3DAB99596F05
+G0 X3.333 Y65
+G7 X-0.3333333 D1A5B3C679890A3667EB5
+G0 X0 Y65.333
+G7 X0.3333333 DA79F898E999888927141
+G0 X6.667 Y65.333
+G7 X0.3333333 D6C8A9199754D81
+G0 X9.667 Y65.333
+G7 X0.3333333 D073961A78175B3AEB2B5A9B19685999A9DAD9076988095AC779DB39B79A2949CA7A69AA2A9C3BFA4B4BB9599638F767A8362918FB9AD965E867D86848A96A5AC98641D385C676C4C5C554A7880A276375D4327489B81897A43544A86654E7977A4B3A867A780364E774E4E6466584E4C
+G7 X0.3333333 D697C455B702241779E626A5562466FA3B4AC9D969F777F788C73677C8193AB8D7D3187C9A5A293A78D93A3A0727285666C875A547B7071708A5652764D5C49362E4C417A9480B4AC92949DA4A8A394899D5C7A8496AAAFB29FAC969A927A80675F334C6D748B4E79977A4F3F584F4742
+G7 X0.3333333 D415A5778956754545E506946433F627A6F6D9B8173785403
+G0 X93.667 Y65.333
+G7 X0.3333333 D1D1C
+G0 X94.667 Y65.333
+G7 X0.3333333 D063A44
+G0 X96 Y65.333
+G7 X0.3333333 D2F3F96857765658369527D93
+G0 X100 Y65.667
+G7 X-0.3333333 D955B437D8C6C57569E774E2E13316C030523
+G0 X91.667 Y65.667
+G7 X-0.3333333 D1D507A8677949C644B3D2D50596B3A4352708885614D555A3B3C4F4C7A914955806858644B5962547B7C6B8FA58499BC91548C946CA4A49EB3A7A59FA5AAB2C19479656047092E0C153980764E5B768AA18638728A4C83848E979694A1A77A87A6B3CB9F436C8C89A06C5D8A9185587B
+G7 X-0.3333333 D95A07DACA6A4AA976760697C505A9467434E2A3B5663645143223D576961615982B8AAB7B7A4A3A3343C86534A384F868D6440395D404C7F8F4954605C6F7E825E4162548D7C859F9D8869827C6E78ABB39F6C606D727899AD8F9D97AAB0B6BFB9BAB591AA9E7FA7B18E99815B87818B
+G7 X-0.3333333 DA98D8A63A08BABA17F81A2A0B0AEA2756E8774692A
+G0 X9 Y65.667
+G7 X-0.3333333 D3FA3A59C9E91602E02
+G0 X4 Y65.667
+G7 X-0.3333333 D034975AD9385AA979497A2A3
+G0 X0 Y66
+G7 X0.3333333 D829F9E908DA4ACA6A7A654
+G0 X6 Y66
+G7 X0.3333333 D108BA08BA4B6AE3E2237
+G0 X10 Y66
+G7 X0.3333333 D046959626E738AA8A7A1A2918671A99F822E7D84A7899C8F827A9EA779987C8FAB90A5ADC0BCB1B09D99A0AEB9A8786973607598AB9E949D998E8086769CA5A58C75484452804365616460786C7A4D3E564F404976604553434B6E529BB0A4B6AD9DAA845254757A4D605E43838E7553
+G7 X0.3333333 D705258638E855F7F9496908C84A59B97AFB09DB09D713945976941628A5DA7373BB9CCA59C8D62A09C878AAA91906D6B7F694F7198857D4E7B718B1F084B687F866D4A79899EAC95B5A7AAADA095AA898182945A7FA8885F8F96968D68525D637F624D4D7C5D7070507E6A55535E6F3B
+G7 X0.3333333 D474D58515247555E5B554F5B7582A26C766B615515
+G0 X94 Y66
+G7 X0.3333333 D2A03266E
+G0 X95.667 Y66
+G7 X0.3333333 D0F
+G0 X96.333 Y66
+G7 X0.3333333 D587C8C595C663663611E5D
+G0 X100 Y66.333
+G7 X-0.3333333 D6550617E40578885725C123047
+G0 X95.333 Y66.333
+G7 X-0.3333333 D0B77
+G0 X94.333 Y66.333
+G7 X-0.3333333 D2422
+G0 X91.667 Y66.333
+G7 X-0.3333333 D0A605E5E649B998F6E6B5C34626D744A4B7A7E70746F7661535A5A60476B814F6164685B92626E77768E7D6BB69F83906C697A4C7996929BA89997ACB0B29E85908154409D827185471E87757248566773716B4783A97A9B919E978A9E96938B78B4ACAF4966A96F584A21476A4A6E8C
+G7 X-0.3333333 DB5AA8EA9B6A89770669E8D80979A97B4B55C9757727085818D857B5774915E4C556DAD9EA3B3A08393966F693A4048464F4431515094698184A2789A6C562E47434C4D4E66949A858BA6A6A9968A9AA7AE8F5B6C5D7295B9B9ADA4939AB4BAB9C0A19CAEAEA28C6A65B58E8C8E899894
+G7 X-0.3333333 DA07CA883A2AE9294A7ACACAB9D7A6F753E1846646904
+G0 X9.333 Y66.333
+G7 X-0.3333333 D646275AFA69FA59F4301
+G0 X3.333 Y66.333
+G7 X-0.3333333 D2D7E719A887F88958877
+G0 X0 Y66.667
+G7 X0.3333333 D8E9C8F9597767C6202
+G0 X3.333 Y66.667
+G7 X0.3333333 D11
+G0 X6 Y66.667
+G7 X0.3333333 D045997B493A2B28A6DB2292D271B1E
+G0 X11.333 Y66.667
+G7 X0.3333333 D0D4984688FA7A0A3ADA58DA2ACB8BEA5B2C1A5769389759987536AACA3AC8FAAAEB0B7B5A6A0BBB0AFB29A873E585C3F6675A18F81ACC1AE9B8B92A38D6F8C52386A5C84949D8C9A8B8252713F3E58432F596C695E5C8D6A979EB5ADA29C5F7AA9B099A571444693BC7D868A94749999
+G7 X0.3333333 DA9AD8C71747786A3A1AFBCA0A89D8EA2A59AA696766459907EAE8A877B8F55A16B7CA39B9B91A38E838DA89C5C477C733D6766715C598C9E9C84879A5B7376667E9CB79D9FAC8D9DA7A99695A33F60524361638573729082643B46777D4B666F6B54878C845150645146524D53A95558
+G7 X0.3333333 D3B6D5D5B51386B91675885A3754318
+G0 X91.667 Y66.667
+G7 X0.3333333 D1629
+G0 X93.333 Y66.667
+G7 X0.3333333 D1A2F
+G0 X94.333 Y66.667
+G7 X0.3333333 D2D4C
+G0 X95.333 Y66.667
+G7 X0.3333333 D010B54721B2859450E307E64896F
+G0 X100 Y67
+G7 X-0.3333333 D577140412D0A1A
+G0 X96.667 Y67
+G7 X-0.3333333 D11452F240D
+G0 X94.667 Y67
+G7 X-0.3333333 D5913
+G0 X93.667 Y67
+G7 X-0.3333333 D381B
+G0 X92.333 Y67
+G7 X-0.3333333 D22583403
+G0 X90.667 Y67
+G7 X-0.3333333 D504C8E71597557503E4C5A48785D7258715B86854F63467878979B915E69645D646B6F3F6E624C6F82715E51525F373664856B90A7AB9A939484A79983567086893D93984DA9B084895E5E5F71556652426D72B39481909F9A999D907A897E
+G0 X58.667 Y67
+G7 X-0.3333333 D659DA4A6B0A5B47E929FA6A68C786B969D9B9DA7*03A88984918B8C9C82B09C97A48F94AAB89E8D8A607CA8B3BD9F6D87A4A46954535A6F414C53624D38366F7066645F7981839DA4826F7D504C86B687759E9BA088818EB78D8A9A7F8F8C6766636099A6A5ABBAADAAB3A5B2B4AEA5
+G7 X-0.3333333 D9C94816B7F9284958F70A9AA8CB19FA4B4B59E9497AE9B989FA7A19321
+G0 X11 Y67
+G7 X-0.3333333 D032C2F1758BBB88197B9B9723313
+G0 X3.667 Y67
+G7 X-0.3333333 D0C2A0136808480A9978449
+G0 X0 Y67.333
+G7 X0.3333333 D4F6A7AAB5B1531
+G0 X5.333 Y67.333
+G7 X0.3333333 D0F3B
+G0 X6.333 Y67.333
+G7 X0.3333333 D12692EA6BE78717BB290729F1E
+G0 X11 Y67.333
+G7 X0.3333333 D183A098A9FA38B98A896739AAEAFA694876965AD8F899AA1AE9F565D70948DB5AEA4B3A098B8B8B5B7B19DB2772D4D8C707561777894963F2A658E7B9B8BA4B4A2656A6B83779B9D7C8D666679858595646D60553148444B60776D5481837C66A0B3B1A37764AAA87EB2BDB9B7A8A5A4
+G7 X0.3333333 DAB9D8D868AB6AA9AA58B8B8897807DA0768291A8A3A5B5AFA098B5BBACAF764470829B858C9BA1A5AE8E989B968267827B7A9B9193A47C697C9C609A9F957671776F93848598AB867DA3AB937870645E4E63729E8F705A7681714E46524F56414D314A76776B546064713AA6C28A6BAD
+G7 X0.3333333 DA8736B78806D666F75793A5CA16A78325F9B4D
+G0 X92.667 Y67.333
+G7 X0.3333333 D124A
+G0 X93.667 Y67.333
+G7 X0.3333333 D037C3A4B74562B
+G0 X97.667 Y67.333
+G7 X0.3333333 D2D
+G0 X98.333 Y67.333
+G7 X0.3333333 D0C2D55122E
+G0 X100 Y67.667
+G7 X-0.3333333 D443B2A58641E0C2F
+G0 X95.667 Y67.667
+G7 X-0.3333333 D05052D22538C71758304
+G0 X92 Y67.667
+G7 X-0.3333333 D24796D708C7774170B828F47808E8FAFA1979EA6B5B1A9908484A46953505E531B425E62325381805C588A96516C8E8151546839638D8CA0999F7F758C998C7A857B6B678A94996C6D9076937DA19DA2B48F8E8076719891A18C88A4B0A08774849D8B8FAA9C849EBD8B9DABABA1ACB2
+G7 X-0.3333333 D8D9983907D8D8F6D9694857274A5A87580B4B0A9B97EB3B59FB5B0989F7E96AB9CB197537B947784585C7C608F715E564571888A89715B8966747F6469668E8780867979A27758728E8B6D6D6C7793766555908F55598DB59BACBBB9B9B8ADB2ADA1B09D8F8F9D384D98A49F9691A89B
+G7 X-0.3333333 D877263849E999C788292B6A59B84886A16741617429B8468915197ABAD7A9548
+G0 X6.333 Y67.667
+G7 X-0.3333333 D417D19
+G0 X3.667 Y67.667
+G7 X-0.3333333 D0504
+G0 X2.667 Y67.667
+G7 X-0.3333333 D09250E92AA6C829C
+G0 X0 Y68
+G7 X0.3333333 DAAA2929279493326
+G0 X3 Y68
+G7 X0.3333333 D183C28
+G0 X4.333 Y68
+G7 X0.3333333 D0A19320A867C0C934225B0B1C3C1B19A93949E96793D3B563B77A3A7AEA2A77C959C8F8392A4A15DADAB8D98A69A9376A4A99882B1B8ABA6AAB6BBACB2A1915889694B79AE7A6B7B9881627B918E8B763354955A605F768A7551655A827673877D7885767A80506A7B897C5C5E556966
+G7 X0.3333333 D9CB38C7982B0B1ACABB198948FA3B5C5A17D999AACA09FA4B4A7747DB2BB98B3A79A95988192ACAEB0A69EAB9DA5B67490B48D919B8D607C94A1AAC4908EB5A0906F889C91A49F93989669A79A7A7491849687654C667C89A78D958C858B798E9680515C5C42775F5F8994734E748682
+G7 X0.3333333 D856E4F5C4D59512E6B695F84837E6C5DADB4B38079B09C8C9A76413B72690F381948A175173C
+G0 X92.333 Y68
+G7 X0.3333333 D788C403CA760121838452E323D4E526D58727A523D2C
+G0 X99.667 Y68.333
+G7 X-0.3333333 D040F1603
+G0 X98 Y68.333
+G7 X-0.3333333 D0502172E3F5147514F5470424148
+G0 X93 Y68.333
+G7 X-0.3333333 D088F71307E1F809E6B386D4989545D4F7E979C8CC1838EA09DB0885362965C59899682*034F55626965654C65505969817E7668575E7E92697786656C9A95A69D8D90897C5782B1A1A191969FB6AC6D6C8B7F9BA7A49E7A6B7874A698A8AC998EA88E798AACA976A69D80ACA6A7BDA0
+G7 X-0.3333333 DA3B5B4C2A0969B9F9B9C985EB1AFA7A5B9BFB0868AAB92796AC6C49BA98E8AA1B0A395A7A2928877A190676F7B4F60616A727B7E5E5A6369907885978B7E7E75866A7B747F7A517B79385B7C666F665441856D9687576C76997C86B8A6ACB7B1AA9FA39489818CACAAA8B2B0988E9376
+G7 X-0.3333333 DA29A95799D93505F8D8E90AC98B69EA87A3B44
+G0 X11.333 Y68.333
+G7 X-0.3333333 D69A6B3BBB7B6C2B99979A765448D94A83E5284588925A06219
+G0 X2 Y68.333
+G7 X-0.3333333 D4255887F94A3
+G0 X0 Y68.667
+G7 X0.3333333 DA35053A57B29
+G0 X2.667 Y68.667
+G7 X0.3333333 D05
+G0 X3.333 Y68.667
+G7 X0.3333333 D5C7B8E9C6D8DA689AAAC979DBF404C6DB0B4B2B4B6A88751
+G0 X12 Y68.667
+G7 X0.3333333 D01554F9B9FC1A3955671607C2B8E8BA2A3949D718B9B8EA3ACB07971AD9B8E9AB5B0B3B8BF9E969BB49E8C9C71598576806241697E9B684A735B5D28595A4B61568B929773797D6D624977403E77503939655E604F579E878D68698A7E8F898A75A9A0A586A079949CBEA9A097A27C89
+G7 X0.3333333 DAFB7B1A5A2B6A764606D86A5959FC2BAAEB1B4A8AEA49D9AA0B7AFA3A892898798A0A08BA8908E95A29F94BFA4A5B99D807E50497BABA189793D6D8694507B94969F7F7C9B77657B825164834B5C5F77A3818A7652484A3D5E685F766D9296857C8A9A447961507CA39E7B7DA3A6A790
+G7 X0.3333333 DA398AE9F8939A487443F7F9D8E84A9AF871D2B5164
+G0 X99 Y68.667
+G7 X0.3333333 D482059
+G0 X100 Y69
+G7 X-0.3333333 D8F4F5E
+G0 X93.333 Y69
+G7 X-0.3333333 D736A16
+G0 X92 Y69
+G7 X-0.3333333 D3D85BC845E312A6E689168658CA2B9ACB094B4AEAE989CA8AC9E8D6C739E8D859084819E965443607364525F757F5F69686A826A4A6C596F6B74703C77586C74A68B5A8057554792B9A35866433163957F94ADB37D939F94809B968AA68797A9898E9E6E78B0B4ACB09DACB2BCB3AF
+G7 X-0.3333333 DAB*03AE999C8189AAB9B3AAABA7ACB0A79075ACB1AF8C7EAA7A8C9883A6A6977181908099996E5D6E76AE896465674B5267555C5D2D354C5C50625F6DAA766F6F7A7045434D75455045547F948D5F72817C6E47836D80B8A6A4A2A0BBB8B1B3B5957886A58676B4ACA398A28C8BAE81
+G7 X-0.3333333 D852A4E7357742C513E969D75696C2341
+G0 X11.667 Y69
+G7 X-0.3333333 D097F9F9FA1B8B0BEA2A63812A8A9A79FA9A9836D8EA6B0978244450B0B772D713A58A0
+G0 X0 Y69.333
+G7 X0.3333333 D9172
+G0 X1 Y69.333
+G7 X0.3333333 D4E60758FA2A0A2C07E6FA9A2902D3463877795A34245AEB8C1A999A9B25A7E4724095E5E5B5C6AAC8444334A4455625A548588B4A891998D86A8B1A3A7855B68A7AEB5B8B1B4B4BDA9A1B4AB5287367696867E5D747A43326F747167796B65898F9A9377A56542647B375F7078807072
+G7 X0.3333333 D9192374D6D666A5E54768E7E8B8F83A2A58A98A89F8FA4A776B2967D8EB5BCA49DA9A6A497939ABABD9E718FA297AA9CB2ABB4BBC4B6B09FA7A2797A9490AAA7A6926073A199A29E9EA9AC9D5F9EAB7F8095652F4E6B605E90ACA29B6180ACB09F945261773C7A574B543E5348475D70
+G7 X0.3333333 D796477684F525E76504B76587F8E648D8188899D92485397A69EA4B2B4ADB68C73ABB0A585888B6C6977525F5D79886028
+G0 X92.333 Y69.333
+G7 X0.3333333 D319410
+G0 X93.667 Y69.333
+G7 X0.3333333 D273F
+G0 X95 Y69.333
+G7 X0.3333333 D1B0A
+G0 X98 Y69.333
+G7 X0.3333333 D0E14
+G0 X99 Y69.333
+G7 X0.3333333 D44A756
+G0 X100 Y69.667
+G7 X-0.3333333 D387D86637513
+G0 X95.667 Y69.667
+G7 X-0.3333333 D5F32202F7F5A
+G0 X93 Y69.667
+G7 X-0.3333333 D03825C69597FA982495D8EA96C5C8787ABA89D5E86B4A9A6A086859885589B899BA4805B5D6D808D758D723A60566B7074888C657B746D69575B78785F843F408168947898B9B0999BA1A78B82676E7076A1799D59789F8A97A1B6B1B39E9287AC7079ACA891AC986A59AF9F9BAEB0B3
+G7 X-0.3333333 DB2B3B9BB908168797E5B80908E82899394A6C3A76B8FBCB79B8D988F92B4A088989C98A29FAB796D7270824C5B617292A2576E9C8F98A2AEA4475566645E628A719697796E8289725B8CAF987F65704E6157627280617385AFA79EB68190ABB4B098AAA7675E80A6ACAD8B898CB6B5A0
+G7 X-0.3333333 DB49B9EA27E4B8AA7692738A59FB37A579458446383745BBA8193B48C71C29EA8A299999139
+G0 X5.667 Y69.667
+G7 X-0.3333333 D45A7AAAB7D6CB2A8B5B5B48C8775393C34
+G0 X0.333 Y70
+G7 X0.3333333 D3A869B8587ABA09593AC5E9FA0A7623B
+G0 X6 Y70
+G7 X0.3333333 D5FB6A5989CAAAEB4588BA3B7A9B17A7893721D2C946E58B4A19B6A75A9B1AB9F89AFA8AAA27DAE99A07558A9B6976756768F90869CA1968F86A4A8A28FAC757C67634F595144664B979A887D827C937E809CA09FA28C8C8A758871778F8BA6AF888A9A979B959F6F7A6E607D9D846FA2
+G7 X0.3333333 D8995AEB1B27281A05D859378A59D81A2999D888A9F7D7E7284858173718B8A96C1C1B0B1B7AFB0AF9E9D937E7275A0A7AEAF8E94926D6EA7B1B4B98B93A1A678687A8CAA8A5940717D76729DAC9FA0A1A77A6F7A71494E6474605560575678905C6698B49B65A18C666A948D687E7A59
+G7 X0.3333333 D57729F9A93949EA1918A965C6AA4A278664C788A8E837931738773744E74B1A6A4BBC0902402228699988A7972
+G0 X98.333 Y70
+G7 X0.3333333 D1F989B2240
+G0 X100 Y70.333
+G7 X-0.3333333 D74263E6B40
+G0 X96.667 Y70.333
+G7 X-0.3333333 D197C877D885D2835869E90A9BBC0C6B794ABA3ACA97D7A2C3B476C94935A4A63588FA05D749F899F9F9E7B61879F72753C5BA88D7883828894AC8F99A07B5A4B7792835B6D55395E7296855163819FA7A9A183ADA35A4F82C46D4E6D8BB4687A9BA59D9FA5925595A47C87878EA3AC9C
+G7 X-0.3333333 DA7C2A48286939AACB3B1B4A993A4B9A5829CAA8F8C918386807D70A178697B9F8C6A78964C61878D9E8B809CA6A5938F875C5E82A788744B7E896C7FB1B0A197AF8F8E959F863C4F837294968BABB9A081828C7E869F90884433465C9C8D625636699F75A9ABABC0ACA4989DA19AADB1
+G7 X-0.3333333 D795B81AF9E9887B7765E8AB5C3A4B8A4A29AB0765489744E726E8F7E3C4D3F9E87B59297B9B49BAF919AB59A8E9D9D8F908C41A7A4894FAB968394997B9D8558AD39
+G0 X0 Y70.667
+G7 X0.3333333 D9D701E749F92837D82ABBF75A097A984998F8EA9AE9483B4BCADAF488978A280A2B9844396947146897369A389573A8E9F9BACC2B296C461
+G0 X19 Y70.667
+G7 X0.3333333 D949BA58684A39C9B7B8792A499A9AEA8B8B99BB7A09BA36C63778BB299737361879398A2A8A1AE9E97B3B7B2A098607083692C94B3A58B96919C97989D9273AC9B835993A1806597A69591736575849597A89761465280647696867F707D86A9A893848B8596A8836452A0AEA7A5B6A7
+G7 X0.3333333 DB2B9ACAF85A6A2B4A8AAB49B9F86988F75906E7EB8A39AB480808D9B8378727CBBA8AA9B9F9B819DB69EA6A4896C67A383682D7880838A9D9180447492898A71857D75AA7DB1A9412F9F7B89655E7E8D977D6B9382707395756F2D5F8681441A5A6E85AEA8B0AA965FAE9C4863AEB593
+G7 X0.3333333 D0D
+G0 X94.333 Y70.667
+G7 X0.3333333 D36
+G0 X95 Y70.667
+G7 X0.3333333 D1735387F8E75574148643704511F6F
+G0 X100 Y71
+G7 X-0.3333333 D6F07664450B6ABA156570B4C5B2A7855A75D7AC3AC30
+G0 X92 Y71
+G7 X-0.3333333 D04769583A2A4A9998484938B7445738F4D838480477F90959089A9758E7D7E6E879B735455817F837C4168666E66AF7E5A98AFA3A47D6E9D565A6D8E868A907799A59C9B8E9A9EBACB9E81816B728295AD9BA7B4A7A2B79886B58F909CA0AD9AB7B1AB8497A086ADABACAF8BA2A7AB91
+G7 X-0.3333333 D7C6C939EB2B7A2918291A2AE897B76588B958A7D7E67557DA5787F8B7A83807291A6AB8A5284B0A3A9B580938F8AA6A37E79969E9EA8944A8B78555A709A90B6B2C0B0B3A89FADA1A69CA4A0ACB8ACC4C1A5AA9C9BA59CBDB1BFBDB0BDA993A5A48B899FA4AB628CB077A05D58B289BC
+G7 X-0.3333333 DC3B9A7A2817C75A0B688A163657CAEAF98A6A894AD6E3E8B7198B29CC0A6A3BBB39C9B99C2AB83948CC1BBACA3997464877F4855
+G0 X0 Y71.333
+G7 X0.3333333 D067F82550E
+G0 X2 Y71.333
+G7 X0.3333333 D59A6A198A7847A71938275ADB1BAB9A6BEB18DB2A77E86A1538AA7A6ADB0ADAC7965528362B7897D897D97ACBAC0B2A9AD83B3B7A7ABAC6DB2A6A49A7F9BA99FB3C3C0BEAABA97A19C99B2B2A9B7B4B29E96A79C909AA49FA2AD9A97C1AE8EA085804B207B8D3462A19499C394929288
+G7 X0.3333333 D9CA78FBAC9C59CACC5C38A86A5838A78808C928F6696A5987F6F77825240769DA18C8F7FB99CA5B5978E9D85878A859F9B93A3ABB5A88F63939996BAB5A2A9ACAFA299BAAC97BDBF8592B6BBABA5757E6D836C838DB7A7ADB7AEB1A8B1A47D8AA4828E64665D6B5A5899A6A4A19496A7
+G7 X0.3333333 D6C8E584F528B7E887F52A07E59859495A39789866395827B918272728476937564688C6D507D959E9D947E6917
+G0 X92.333 Y71.333
+G7 X0.3333333 D32212764A2B2B8909B6FAA522F662D50969BAA9AA3764B
+G0 X100 Y71.667
+G7 X-0.3333333 D98B29A905AA48B605D838D7A919F939999AE6B0371578650730122553D5580896C5157606B6C6477665C735A736776A8A8738A7F9CB099AB87896A6D98885D747E7571577D999B7D99A586767D867A56365F717A8C8D918B89B9B0BB96B397788D598B8871847A709F9E9FBC9AAAC2C7
+G7 X-0.3333333 DA89D9F9DA2A3ABA9A2B7B29E8B718392A1A0A2A4968D9FA19D8D94855994B1B39BA9A3888C658AA183494482687BA4B48B788D8AA38C937C84626680B1B0A08FB0CFC9C1C2CEABABB8AE799486764D3EBD7D414C796C707B86B0A5A7B8A49EA4888FA2B8AA93A4A8A8AEB2B4B1A59AAD
+G7 X-0.3333333 DA48C9EB2B7AD95AC9A7CA8AFAE9C5974979F919D99B4A2A3AEB19EA28E7B93A5A57D957935937065B39FA7997A4D4D3236ABA39CB4B1AE9BB995AC9498C2A584A1637B8C97
+G0 X2 Y71.667
+G7 X-0.3333333 D2625
+G0 X1 Y71.667
+G7 X-0.3333333 D0E0D
+G0 X1.667 Y72
+G7 X0.3333333 D54238C978196A7A6A6BA9DAEB5999E8BC1B2ACB7A79F30097A7284548F88A697327AA9808C6B8EBBAE6573B5ABADBAC2A7BBA994808A98716F8EA99AB9869C8D77B6B2B08399AAAC9CABA8B0B3A6B4B0A9B3AEB6B09AA9AEA7AEA3A9B0AE81865A3C6962668DAC939584879771A8A09F
+G7 X0.3333333 D95828098B2A1B28C7F98937F757C4D6E997A7A8391878484A165706D507E8688AA9775788A7FA7A8ABB69C7589869AAB929CA0769992969C8974928D96B69A8A8A9CACAC7C9AB5B7BEBFB0AF9FA69E90979F8A92987A835A5FA098ABA8A893A9989D9A4A705C6380A88784959BA08A5E
+G7 X0.3333333 D7C7D556954695936919BA96D9AB285A7A5ABB3956D8AB48B86645B384B5C4352785A5462522B447A621B601E
+G0 X91.667 Y72
+G7 X0.3333333 D66A9A081A9616A898E908437759790859274413D55998C8BAB
+G0 X100 Y72.333
+G7 X-0.3333333 D8283*03A4490401877B739632254995B465706CAA9FA3A4945731122C3169A88E7167695C674D82896F414940657F9DAAA3909BA7A7B49D76898B876EA6AB605D564B7160555D76779CA782667179828B5C39417F9099A69FA4A1A4A3A05C423A7BA0959D9DA4959CBDAAA9B9B3A19D
+G7 X-0.3333333 DAE7853A19F9593949AA889A4B5A4898F89969E5F958585A5907DA6A5ABB3B6A19C637592928AA9A66F7E64355541665E7B7D98787E6E8569727B8082817171BB9F828A96541B4F78728EB4A6A8A49F9C968B7440635F656683AC918B8AA9AABAB0A2A1A0B7BCB5B3A2A8BFB0AFACA4A2
+G7 X-0.3333333 DAC997D9DAEB19F928D6F9E80729D437D9A808F977FB28DA2A69AAFA94180B2A172819EB6C1967ABB6A385361B8864E2E48929DB5B4B9C29691A3A79C8FA4ABB1A962
+G0 X3 Y72.333
+G7 X-0.3333333 D42762E25
+G0 X1.667 Y72.667
+G7 X0.3333333 D36062A8A4555939BABA197AF96A096A7A3B5BBBAB2A3956B6EAC805B6F48
+G0 X12 Y72.667
+G7 X0.3333333 D68B4957497BEA5767F97AC6F75937CA98050823A997A88A16253615483A59984A2B8AEBDA48CA8A9ACB6AEABADBCA8888DA6B2A6AA9FAAA8AAA5998FA2B0B3AF6B62626084A799949BA0ACAF97A890846885462E87716F59A086797F9480A8A474695E7F7073384852553050668A8578
+G7 X0.3333333 D878B5D7A91867A85A2BAB1B4B8B48092A08F668782A4A98C8C919F9EAAB7AEB0816484AAA46E5A5578ABB09FA1A4B0A1A5695B677473653263719BA68E92A8A19992827E896D6675897E96605769A3864D677D61525F6B8381919A5F843F437295929DAAA7BEAC998B7165334F618685
+G7 X0.3333333 D7756756D618A8B8894476C2F
+G0 X91 Y72.667
+G7 X0.3333333 D3986775642A29E8E8B6F3D9F5D262F8E869772347049799C95964D
+G0 X100 Y73
+G7 X-0.3333333 D3FB1A99A944F203179997A911016AC6A
+G0 X94.333 Y73
+G7 X-0.3333333 D62A24335935260225319015C7F6AC77A90A9737F7C7E777B9B89693A655899A3AEB6A5AC9F82927D5C7F957076809F976E6D535B61434A9395648F7E644B734D69835E8F929E8E95A283769E76686B443A416A66676F9AA1A19BA6929AB4746A60759AA29B758495B9A7A2A9A499A49B
+G7 X-0.3333333 D887B849C766EA19588A9AFB7B5AF9B6B9A968D9E71798D7E7275563A1A727C5A504463604C61A5ACA5717C77867582495F949F875B7A78898B927597AFA1A19899A59A5D92AFA0AC9DAFBB9099AFA0B8B89D9CA9AD8F7988A7A0A69291B8AEA4ABA0B4B0A4A49796ADACB680697C8590
+G7 X-0.3333333 D70579743497B53918F9699A65E69862A6B935579B9AA16
+G0 X11.667 Y73
+G7 X-0.3333333 D21575E284498A293A1B4B2BCBD9BA8A79FB4A5986D418395889E8C183F18
+G0 X1.667 Y73.333
+G7 X0.3333333 D2F216D7B3D71A67F562C82AEB0AFA7A88EACACA1B8A1ACB2A27C364B2C45585699B1AF7C665F2F818064A39FA791945D745C8585564C8A7E8F84728E9DB49D9284AC9A819EA7ADBBA27AA2A08B829DA97C8AA28AB5B8C39A7380AAAC9C83A2AD9FAB8DA2A49EA5AAA49B98978A919286
+G7 X0.3333333 D7D6994A99864699487866E896E918E7C7E866F61705B5B7A5E4A7088694373927E90958870534A7986BAACA79C85667B6D7F84547279797BA0A69DAC989C93808EC18F8E909AA4B4B992809E9BA2AE838897906F465B7E86B4B2A79FA099747A7E9CAE6885674C56426E8A6850818E54
+G7 X0.3333333 D7E71573E5C92AF9A898BA6A0AC8E9D9E8CAB9BAB9FB09CA477454E829292A69393AEACAF9A9484BD9D749231836063B2A84C2E165C313324A09F7060348D3036
+G0 X98 Y73.333
+G7 X0.3333333 D4B9EA2B4A77C
+G0 X100 Y73.667
+G7 X-0.3333333 D9CA3AFB0691621183353
+G0 X96.333 Y73.667
+G7 X-0.3333333 D469FBD4D01867D5D88795B96A8976B9D2D3879ADB4427970899798A281C89670605331699FA89583A2B2A379A69596A8ADA2AEAEA47C8360345B7C7E556E7F7B73577B6E52749F9E97B2BB907496669BAEA49CAB855D6A6B5A84856689B7A89C9C85A78B7C76A8AFA889AD9D779796A9
+G7 X-0.3333333 DB295989A7994A09386708487553980AAB2AEBB916C694F5A726D6E6A98756342497D838A957C77786D986E427A7B746C859F83A398847A74788880849594989BA4A895B0B1A0A8A6B39F9275A09299907C89917B9EACB1B981899A71A797616F9AAE906CA4AEA57C5791AFA1965C8E8F
+G7 X-0.3333333 D562B6D814B755DA27E80735D575E7E838293848266576577938A71123E849489738E856EA29FB1AD9EA5BAA89BAAA5A69E715291838A560A7C6757
+G0 X2 Y74
+G7 X0.3333333 D4E64455F9E8C6F7B68819AA9B1BAA793939EB9A7AD969C5479872F6085539B715B7F8F919B88827E9B66737B593D937F7A8DA9C07D4F606D436F779275619AA18D7D7995AFB49C7C9C7F994A9093A0788996A2B9C0B5BEA3B47E8C9DA492BB7077A49FABAD93A3ADA5B29DADACAC94
+G7 X0.3333333 D8E8E958391A693999AACA993AA95718B876D6764A4A9ACA79F917E898598875F82605E487A8AA1A9A4B1ACA6B6855C6E5B6C7E9BA28B7881857885ADB0898A9F918D737EB8B668629BA98AB991A4B29A5A75874E455F6D859BA298A5986E855B9BB18DA6B2734D6F626E8BAA8F786167
+G7 X0.3333333 D6F7B6321516F79ABA99F9CABA1989CBB9CA1A09C94558F95634D4C827082AA8966698893836A4BA0B0763959A45C8FACA5684BBBB6A541
+G0 X95 Y74
+G7 X0.3333333 D14B1AE62405B4F7AA36E91B3AFA6A8
+G0 X100 Y74.333
+G7 X-0.3333333 DA9B2B7BBB6BBAD9D848591AFBB62
+G0 X94.333 Y74.333
+G7 X-0.3333333 D2D4F7E9372A1B2A09EA8162AAD7B4D71818E8387838F6E7389998546594E5F5E60B2B5828898A0A27BA2B596939A988662613968868CA1526D6C76859A8D676A888A759799955C675A877A83AFA095987B413270627292A283A2A3A38AA38E3873804F8BA5838E979FA6AB6B52738C58
+G7 X-0.3333333 D738A7B806F6C8D8F75978D959FA2AFAF745D3E5B6674675B9FA39D93988B98758F636A787099A7A3ADAC979EADAA9F94B0A8AAB1AD8D9DB5ABAFA2A4B49FA0ABAAB0A7A1988FAB9F7791B49CB6B9A6BFC4A892868283859B9256918D868B95947D81886164938C65706B7BA6587BA986
+G7 X-0.3333333 D779EA5826AA3AF6A3F58607ABCB7AD91819C7F8D949E5321936A33A08F83A39BA2A3BC956EAEB7B0B0ABAB9993848399A34A18490A
+G0 X1.667 Y74.667
+G7 X0.3333333 D042F7C927CAB9AB2A58386A8839AB4ADADB49AA9A890989CA488995F67A243618F872D428BA49290BBB58B3E49A7AABBA88EAEAEB3A696898597A17B6C6955807F6C7F6D644C9A8982977F62738453748994999BA4B2A4A0AF609DABA8A39A92848A97B0B394A79C93AC99A9A6ABA5A8
+G7 X0.3333333 D92A6AEA5AFACA098ADABB5A4B8BAC6BFAF8666783E698A8795A97682818B5E3E5D4A586D79ABB7B89A8A446895A4AB8483803E6A6D76706A6551647E999A898598826B4C6A53749C728A918A90939C6C5C684E32567AA7928C88807D6E7B99816B87B08A56966B7BAEA5806D6E707B86
+G7 X0.3333333 D7A6A635A4C24768C7F746D8F8C80958D977F669EA5845066694C3C6F908045779C8D876E73A48F86A0BBAD8B959FA37D9AA39E3D193522040243B8B8998A6286B3B4B9ADACA1A8
+G0 X100 Y75
+G7 X-0.3333333 D836DA4A2B9A69A8853A7A9B09C5E648A6A7F4A7C697AB1A5C1BEB7C3B6A8BCA37AA887619385757769799F9F6E544972553B5655879099A5935D8488725A3C322E184D65554B31403751716D76ACAD9F8C86679F8A726A78B4968D93787A7C8D97778C593B44587FAFAE856D736980A2
+G7 X-0.3333333 D725A756B63909B7F709498726E5F666E6666649272817176656A8F543789A18A888E71778E6C805E554071656380938F8E809EB3B1BCC4C2C2A996AA93A1B59998BCB3ADAAA4AEAC70A7A9ACA7ACB7ABAFA38882AD7F7D8297B69E9EB48099A3A18696A3A1A388936B6F64464A6F76
+G7 X-0.3333333 D6D6D7C687669605D746B766C476CB1B8A3AABFC6C2C6ABA4BAADA0986A6D718509339E6614
+G0 X13 Y75
+G7 X-0.3333333 D44A29898A3A19A99A5B29F93A6BDA78DABACA8B29675A697B7C1AAAA9A8881A8A726
+G0 X1.667 Y75.333
+G7 X0.3333333 D1085A77752929BA7958C9D93B3B6AFA9944C4F90A2AF99A485A9919A97A2997BA06D06154545
+G0 X15 Y75.333
+G7 X0.3333333 D206A8B8D8E836CB2BDA8B9B7C1C2C0B6AAAEB9995470685D705748575069495E70393E7383817D7C92A69C8F99ABA9A1ABBDB2B18C9696929B7C935C8EB3B49A9D9AA0AD9A9071A1A0A7AEB7A3ACA3B0BAA3A19E8E7EBBBBB8B3B4B2B4A9BD968DA199846A563F6473547279988A6784
+G7 X0.3333333 DAD7937767D5B6B857EA6AF9D897D4D56676777A09885868C936D707280779FAA8795A79CA3A29D4E807B819F917F9698939F928A74A1A680625566908F9BB8A9A6A77236535E4F2C504F515A7618
+G0 X78.667 Y75.333
+G7 X0.3333333 D0F4D525070786D70969B754E415461718A555A6D948C97856B51627370845E7A74C2AD4F807A4CA7A3AC9463A49E564C91A49795848BADA187A2BA918FAA6D6D
+G0 X100 Y75.667
+G7 X-0.3333333 D8699B67461A5B2949DA8AF9C8D9EADA99F7EB2B7BDB6916F8B316B4B51A2B06FA26F73774C59797173955E226F8F93A3B0866A7D445D5D728B889184545F5158
+G0 X78.333 Y75.667
+G7 X-0.3333333 D53925D586963764F51507179699177A29B93867B8565718FA98B8F979E9A9E976EA2AC9EA19B8290ADAEB5BEAA908A746D4F3F44667D87938394A664687CA06E7575907742446454444D7E213E79957A8B8D969C6A6790517773618098A4C5C09793988AA49F93C3A998B0B8AFAEB5B4
+G7 X-0.3333333 DADADAE9EAE9078A0A47A84885A7B9D8B8F9E5D57908D939BA78C658EA1A0B1A7A3A2918D9BB78B91837B69517D88755872514864745F7473755EA6BD97A5BFB9BAC0C498A9BAB1849F8D888A88
+G0 X15 Y75.667
+G7 X-0.3333333 D1B020C764A7DA7943F8E8F72909AA2848692AD9E91763B9F93B2B6AA9DA2969E5E608B7E828437
+G0 X2 Y76
+G7 X0.3333333 D1787759A958272A7A59DABB9BA933DB196A0B1B1968F8E90A8AC9B4482A197A6B3796096
+G0 X14.333 Y76
+G7 X0.3333333 D3949314C78649EA3B09FA9AEBE98B1A598BAA6877A70669A9B8B98B09985929158666968466B8282A8AB966A64A5A86BA0B4A6827467A18DA08D73806B7A608499AB8A97896A86A49D8FA9AA9FAB95B9C2B7B4C0B6A2ABB99E8CB9988F8475BFC7B59A5D4843525B70859886A07F73A5
+G7 X0.3333333 DAB955E857B70285E778E7B1322877B948A84677D7778818E986B866F433465A18898ACA9B2B29FAEA79E9EA8A398887B87A16FA2B9937DA3906B9FB0947494798B558149869661443F7368783E4B50774D563A7D747CA4AB848D5E534F8A94939FA58B85A07082706D67695F614C7886
+G7 X0.3333333 D729D857524
+G0 X91 Y76
+G7 X0.3333333 D366F6E675DA6C0C4C0B7B3A07F758A75ACA6A0B1B3876F7AA2A680
+G0 X100 Y76.333
+G7 X-0.3333333 DA281A09799AEB0ACBDB69F4B809F998E94ADBDB6A7956A293879
+G0 X90.667 Y76.333
+G7 X-0.3333333 D4F5F6D766B57795D5775695D779492A99782929DA2A08E9362818A868B9E968B928A996A4A2F474A18485457655B5A817B62592D5F3F726B98ABA9949AAD87A97AA988799150679C9C98AAA699A2A09CABA9B5AABA909F826A425A5E869574605984686186858683527D7A61787E154E
+G7 X-0.3333333 D6165859FB1BA9B8DA8A1A890675C7A8169417786B4CBB17D9F6D77B1A19CA9B9AAB1ACB4B2BBA486B6ABA3A3A59AA07A7D9C91B2A4788694827C94898AA9AF9A8D86A5B29D837FAA8B5A708E8E72858E47546754717AA48A99B28798AAB8906B5F5FA8A3B494B07199A5B5AF9AB1B892
+G7 X-0.3333333 D878D74499048839C98A4959BA89580A18EA17870689DB2AF7797B581ABB6B4B99D8EA19C958B86957C
+G0 X1.667 Y76.667
+G7 X0.3333333 D053570832B319B94999A9BB5A6A990A2B9897AACB1B2786E7570657C94A1A2AA94969DAA94A4998AA7B0A6A5B59B97AFBAB47878916990999D57737996A89B9DA69C7F9A925872836C8673704D55717A6D93B9BA8A97A99E979A8983ABBD91B0A5616097A8819DBA9B7774977D9CAC97
+G7 X0.3333333 D8CADA4A2B0A9B2ADA8A1AEA994A7C1946E98AAB2CEC191745C7E8992B8968388A2AA948AACA286867465512D5091A58A638A93926E6C8C6448846C747B5C64606B5676746B92A1ADB1A3A7ADB1A59D757C9B9A8E704B9554768C7C5A5AA4B8817970545751392B3C56415F6C2B407344
+G7 X0.3333333 D42494A6F3C4249728358898A9A8C8B7E7689859188A8A299ACA9A08B86777C80757C806B63616A5C4C4A68755C8F3A3B95918EB3BCC7AD9F97B08E94A2BEB993A1B99C9484B095
+G0 X100 Y77
+G7 X-0.3333333 DA2B0909FA2B3A68BA2A3899280B5A68DBDB1B6AE846DAEAB979DA1A4A18E4A56675954627B7C898358537D7B878BA58A918B668A9E5F4E7D906F6D52525068330E5F5A547A392265655B635E73694F63583F43645D49817C5E936B3280753B455D7C8F9B9E9E89758CACB2B5838EA3A7
+G7 X-0.3333333 D9FA6965B575F5A35738A526D6D836679908C8699AA74668F908B9332769FA1976E9CB5A4959AA097949EA1845B617E959DAFAD8AB3A88C8A94A8A794A5879797AC978B96999683819F97706C676B95867F8491758C9EA5B1A4B7B0979C949481889AA5B1AA985F656763648C909C8D7C
+G7 X-0.3333333 D79617778B0898CA99FB1BD7A3C4C698C9B8078A6719B9F94ADB1B2AFABB89F7DA78DA4AD7285A095949E9B868B8295A9BCADB7ACB6B4B79B93ADACAA998F798F85404F80330D443625
+G0 X0.667 Y77.333
+G7 X0.3333333 D0857777911031779A349896C79AAAF959EBB91AAADA1B5B1A7B2ACAAA7B2AFB79AADACA9A39CB6AFC5BE90B1B89D91A47F8C85799C8E8A646A736A4A484C978A79AF8C87A8B4B09B797D8B9B9E8EA173565B758EA985958B6E4580889AA88584A3A1988C9094786674835B888E6C607D
+G7 X0.3333333 D97B0A290A5A3756DA9978D886D8EAFAB957B9B88816D728DA29B73835758959B9B858DB3827B7B9EAD83819D8D7C6E958D758B7083A689698265716D726A4C74A4937059625A56619F9F7B9D9D6086AB9D778E8E6C9392937768724A5D5E4D6E8F5377888A82847C6989898E8C814A6B
+G7 X0.3333333 D6A6A7058484E505C756C487E5B37294D5C6B57467F8F776B606D93876D545B6F5E456154909578646D4E7FADC7AFACA08AAFA2879FA677AAAAA09EABAE7D7384949B90AEACB0AFAA8A8D
+G0 X100 Y77.667
+G7 X-0.3333333 D717091A9B1B0B59DA4BA977291A0A597A8B8AA80A0B19583B2968AAFA1A5BDAC685C87516D987E5A707F8967676E818F6C3F6B646B704A1B0E3F56472A597D362D4A384B585E7C64443C5F626D74877D98A57F6259AE8F6E6B72635F5C6B71727D46367F82799BA5ABA38270828FAC74
+G7 X-0.3333333 D7FA0737088A89E9C9E9D7544285F54304A68515F8A80759C9D83829E94979AA1A9879EA5977B7A8288B19C9F7369975F869B75894F7064916A7BB19DA3A38E9C92A68D8F838E838EC1B3989683635E4F72885A5E848D869892AC918A8894817E37586398999AA8AD83888E9DA1A39263
+G7 X-0.3333333 D778C9F9CBDBCB88C672E95B4AF564F99A3906A678B8654559E5A718A9B99A88FB9C0B99EB8ACB2B7BCA7AA959991AFB3A094AEA083A8B0ADA4AF9FB3AB9B949F64AC7E0B24128078727B0B
+G0 X0.333 Y78
+G7 X0.3333333 D44A28CA17D288A0D68899CB1A8AFB395A79A8DB3AF9E9E9AA295A8BAB4919AA7AAA3AEB8AC93899DB39EB39CAA9AB0AD748898777863566379668D8A8777A88FA0846FBAA7A9C6878488A7778B9BA69C999B9EAAA6A38B8E665461A0907B8792A5A19BA7A2856C6D60892B2D7F6E729A
+G7 X0.3333333 D9FA28567A26F667B918B918C84A594999C6A85A16B68729486747582879CB0B189A5A4976F81AEA57D8CA7B56188A8A76D739B9B825F6C8F936B61616D57537693A09E96A1BB92548D9C566B987A905E76978194A29E85743A787D59867C6E88696E914F82905D49759D917958505C5F
+G7 X0.3333333 D734B41584A5F5D575A4A0C0A195F483E1B10
+G0 X81.667 Y78
+G7 X0.3333333 D2325675039527290A57D9DA6829584366E64657F775992B7B5BEAD9AA69FA1ADB4A58D7DA3B099778E7DA88F868D7EA1B0A3B5A999967D
+G0 X100 Y78.333
+G7 X-0.3333333 D8AA29BA4929BA6853B609DB8B0838F7684A7A99DAC9E7A387AB5AA96B1C1B3AAA972646B5762723874977CAFB7A3A26E542C3A85430C
+G0 X80.333 Y78.333
+G7 X-0.3333333 D492C3111195B3F59674B3B718F57365B5465768D7D6464848B69578D819779878A94886C43728D8258768885937A857B615D5EBF814685818FA99FA97F82B5929EA0626C8F897D9E7C807A827C92889BA7A77F5496A3AF82AEB087A8A8A6A29599A99D808F8E9692887B6D7171757178
+G7 X-0.3333333 D816A9BA0868C98B68E7B51818B7CA196718B9BA86F36493381505C9AAEB297898D8095A3B49C95779BA197B5A999896FA5AF8E9B83B79A7570729E6C7972A4B5B4BD9D7E8C73669E73487F908978969CBCAF8DA0AEA3ABB79E86A0B8BFA98DA5AD9489B0A0857C8B7E9B9D8BA4A08A81
+G7 X-0.3333333 D93A1A4ABB6939B5A01827F8894999950
+G0 X0.333 Y78.667
+G7 X0.3333333 D1A848895928F8E55409B89A1A8A197A57491A7766765AD99ACB9945CACA2A3A89F9BB0B0C6B0879DADA6A49B7E96AC96A29085A180957A7A45729F849DB2BDC2AC9A87587DAF4C7385679D928A7A9EA6606D9C94A17E93A696A5B6A5A4AB9D9796A6AEB49C605B5B585561707C858D7E
+G7 X0.3333333 D9AA1796A4B796286B8B9956D917D677B6E6660565869A99E9BA4A09F9BA98E8A858A8B9FBAABB0AC9AB1A174929C9CA5AC96A58177887B84938B988D8291A8919FB75265958894979168507791564F8DA29091736B82834E70613B444D969096ADA39D9A885A709775698F9598654863
+G7 X0.3333333 D46355B8D92404E5961407B531D081554
+G0 X82 Y78.667
+G7 X0.3333333 D060F8E4B5743567993715C7AA889656266396086998A6FA0BCA4817095956B2959B8A181726D8F9D8DA5AD9EA46A6A9EAE8887988E82
+G0 X100 Y79
+G7 X-0.3333333 D8D8D8C9D90748369619195AC9E84A7AF6C5D65A8A45A68B59A567389A8B7A45F7D838B936A5D*037A87973F5A8E75738F6739801703
+G0 X81.667 Y79
+G7 X-0.3333333 D25
+G0 X80.667 Y79
+G7 X-0.3333333 D4D0B
+G0 X79.667 Y79
+G7 X-0.3333333 D3F6317749C4E33546E888B74441C5F4A5895788C8A7C6E517C948185808F9D9F73425A284467777F7787718A7781996B774D614A569B88908C727FA0B4B9A6A1ACB09F8770807F7793A285819AA59F94A1897FA3986E8AA0AAAA935E559DC1A2859B9C958A79A4A471486E6A73476765
+G7 X-0.3333333 D435C689CB1A77E4E7070847D989C908B978F5F635D615D9196B1ADBBB899A095B0AAA4AC9166899B915469A693749587856CA098547D7189A28BA69FB6BBA4AF98A67F887E2C6DA79E917F5E779F9D94A478929C8D7C7A83A0C9A49895929F879C9E7B8BBBAD4E8458998C77A59A9E87
+G7 X-0.3333333 D9CA0A59B9F748D9C8E7A86619118
+G0 X0.333 Y79.333
+G7 X0.3333333 D55AF7E7C6C5891A2AE898DB09FAC8A819BAF8C99A0B57C408986708EA94F6C93A07C85A0B99675567BA39894939483A4A15F37668FA47578787E7B4F97A08C8C95A19037316C7F65616D8F877379738E6B65986D68927B8960A6AC9CB1AA9DACAABCB7A7A2908393725C615D809AAAA3
+G7 X0.3333333 D828B857643438A7B879C9C79966A7655587F624F8095BFAA6D8A9CAEA369A69E99958F7D75A48B6E5978798F909E8E9D9BAD9F76748F7B7D7A748087A982AB8F78B3AB879B82999B8F2C34694A7658737A7763778B75688481334F3D3267939B8B797C5C5E7C575E78817F777B534D42
+G7 X0.3333333 D487468627E875E3321848C564826
+G0 X80 Y79.333
+G7 X0.3333333 D16904A292A
+G0 X82 Y79.333
+G7 X0.3333333 D032A7A67838F697B9B7083744E6C7B654F64736890A5B4B9B9B38C838EA5AE846494918E9B9A7B8C988CAA9070734E6F6881A68F7871
+G0 X100 Y79.667
+G7 X-0.3333333 D7A829A808687755C8D8AAF986DA18A7E617986987E85809587A88498B7C2BA9B95AB906D6158483F3F604F5A668374707F825E7664
+G0 X82 Y79.667
+G7 X-0.3333333 D1E372D6AA67129081C8D950D067A9E917488645B4C513A3B82774F6E8F4D6969457278858A717F7B473B444C69793C687A738E734B44746C6365564F80AC9EAAB38CA0BA5876977D808F8D9275737A827B6CA2B28F8196A0A4A86C7B8E9298A8A79AA6AA9798AA9FC1B3A6B6A5A6B89F
+G7 X-0.3333333 D7D5E53897E5973819C7A8490915B6A4E4F767295BCB0AEAE928B9E92729E69839EB2B0AFC0A8*03B88296ACA18E8188927C5A4A313B7F7B91817A646E5A434D4462ADAF96807BAB997C944F8CA25DA6BEB39D6E859E97AC9C9CA57C8768838B86A3989F908F865068644D675F74857B
+G7 X-0.3333333 D4F86A99297A7A6B27D8E7D85AC9C915C5288868B9332
+G0 X0 Y80
+G7 X0.3333333 D33A74D75AA6E81A1A9AA97968293BBB5ABA78AA59D41688C7E6A73468A7765547B9B67879B89A3998E8B7DB07B7DA2BD9D7E8A9597AB9B7BC3AD9B86ACA1AC99A69CAAAEA77B6B68627E4F5970848D594A656A706F6E809393A9A8958EA7A2ABB3BCBBAFA3928A6C5E668FB8B7A4B2AA
+G7 X0.3333333 DA5B6A9A19B716A68788F5C686C706F55606D857254809398999CB29CACB2A49EAFAFB1AC90ABAA8B6682A4B09A7C908F8EA3B0A9AA80748D755F7B977D71789B60A1B0B2B9B9B4AFA077799C7A7F5B6D50618892654C3E5B67315B5C6C82476B6E7C9689653B505C5D6C6A275F7C4140
+G7 X0.3333333 D54383867775B93AA79
+G0 X78 Y80
+G7 X0.3333333 D299E942E618433560317697128449D71607F977457556A4F6C6F6E5784987684A592A0B5B59D777E7D6585948F788B888B7CAF9A927594967C97679A968B92958279
+G0 X100 Y80.333
+G7 X-0.3333333 D7B588C9E8E9798806F838B9972887F9EA5AE9D807E99998C654890457FB0A9968C95969C99A99D869F3F1A4E50677D939A8D897C6D6A6B190723450D80A02966A57E76719D974F346B5755363A47575B295E5B49532F67688C5D7156626E9B72825A434F60475B5B7D8A6C79766B9C7B
+G7 X-0.3333333 D9F876881B2A7*03AA68887C884D627A716864838A8B85AE9797A8A199908495A49A6C6A96A8AAB1BCAC91A19C919695979788A3B88B8C86758290776C92935B59637D85767085A8A896919582ABAEAB8C90766F8D9798A8A9BFABA7BFB09CA5AAB59CA89885784C4254586637514172
+G7 X-0.3333333 D6866796E8281A3A3A0AEB69BADA4A37B4977A5A7767B9FB59D75749BB2A4506B838B8A988D8F9BA37B89AC6D9E8F7C9C695276637B7674AE9C9997A7B29A8574A78D8481A5876E745D5D68
+G0 X0.333 Y80.667
+G7 X0.3333333 D227A582C27729A637C91AE8A839090847B8E9C8F8B7B7195B7868F9AAEAABEB19157595D887E9287778B7F7A90A892909385A880807F897AAB957B5183748D9F957E879D9BC1866FAC79716B744035481332514A223F9B9C90A7A5AEA0A9AFACABBAB2BEB9A5787C7D9193A79B9C8375
+G7 X0.3333333 D8B90A0A78573416A58565C87A8777E5363656C798BA5A9AE9F9591A4999589916F81AA92959B8C967F837C959F8FA7A5A58A8BB2C396675F6F7269604C686A544383B5ACAA9DAC6E6D7698736855667976707172634E6A3D8185A9A190A882786D456C7257424258655E5A4743514965
+G7 X0.3333333 D968B681B96AFA44675AFAB6B869A8A2A87811604887B92A5BDAB948C7997604D8948848E9C78A4AB9296A3ACB2BF9771675573A2B2A4979EA5A5A0988F9087928190594D8E837B878F6C6A
+G0 X100 Y81
+G7 X-0.3333333 D638565666B63545A747A8895A18A88AEADAAADACA2AFA88E719E738AA6BBB3B2A59293AC937D8B8A5B6D756A375BA8A1A392876F83968D717EB4BC7B7F74A26D74929C6CA79D5C189AA0966D4F795C565B7C565F695B466862725C6B9DB4AEAC7A858F756A64567A805B4C4E687B7B8A
+G7 X-0.3333333 D937BA9B8B0A899A58682744E4661*0365635C3351B0C8A79083ACAA9DA2AAA7968E7D9386857D819384757681879BA39E6C86BB9FA4947B80816E4971506C4B61815E6C8E9583A8AAA38E7390A19E989B9F80899FBDB7A9B2B1B0AC9F9EACB1A58C948B7C652B4D5F1F06283D596271
+G7 X-0.3333333 D868696AB8C8F84957B6F73907985758889A0B457747F5C8096997C88969E827E707C7B7365687D637F7D7696A4B2917B9AABC5BA908F9F5A7690717990BCC1A69AA39C53754D2B22181112
+G0 X1.667 Y81.333
+G7 X0.3333333 D3F5D8A54908B80AD9997B9A4836E716A8F9E7D999EB29FAEC4AE9D66978692958B7E6C62898B806481788C889498848D7A807290A3B2967E92817497768480914D7087A384717E7B54876F4B45716E55384A6169868F8698909EA6A9A591B2B2A9ABA59C9895928CA19279A797A9A784
+G7 X0.3333333 D8E97815261886D58556582334C694C647F9D87826582A381958F5D6A73989F9A97807E6F85566A8BA8AF9F96AB9B9ABCA27B957F705B909883895B668B88777B868E9B7A738C757A888D534B4D49617D3031539D957B7DA28FB0B2AE71837460517C96889182618166819570346B874B
+G7 X0.3333333 D365A5D6F8E15394065989785A0B6A4A3777D666C8CABBCAC8D657E815864749B897F6DAC908BA6ABA4B0A99A92A38F9EAEB89DA4ADB0C2906397A0847E848A795C5F5C68494761
+G0 X100 Y81.667
+G7 X-0.3333333 D754E5D574759597B9FA081727F928C647AA0AB9478B8B3A9AFAB9E99A0A6AA9D95817C9D75988B858F796074A99C799B6F6D6378958181837C795E7A99A45A41581B527D5057545B5064427C6C4D72848680838DAA967C5275968F9ABAA5A47D3F49939C854551614C4D3C42527C7F6A
+G7 X-0.3333333 D9670666F9C88889A7D848A7A8E867C86916A669AC5A066A79CA17A77A09F84545169797D887592847F60748D867056807E8C7577848A7A864C3F623D31423D445A30654971A9987AA1B4A5A67F7D9D9099A3A07F8BAE9BC7BEA09CAF89899F9B93988F5D37486269737E728F9081858F
+G7 X-0.3333333 D7F576C67797E6C6486A5B46B41729191909C95B29D8E848C8F7A794B415A8E787E566F7686708A91676470899691B19CC2B9AB8D3F676F7C5F6E7F99944F718C938A6977958818
+G0 X2 Y82
+G7 X0.3333333 D6A9B8D6772713D39536E9877595B6A624A6B91999A9E9791718C9984406192956D787349265A775D59102960777B95937499AB9F8C899D8755558E906A5660826D5B373A2E707181798F626367607F3804208A9AA3A1B19A8B9FAFAF97ACC3C0AFA88DADA8AA87746481A582878D7A80
+G7 X0.3333333 D87746A4E4E544F623A32577988987E538683988C94904E566689A96F66756D7A7C8A7651838768848A798682A180866BB8AE7B608581889883998D999E909D9B8A8490525F62645E53475C5E70416C72846C938978577BA086C4AFA38B607EA4A48E76929BA37F6A51597C89792E4057
+G7 X0.3333333 D453F632C56397FA3A3898F6B356BB2908BB28F77696D62869A6777465977958E747E82696A778FAB9E9E9FA6ADA99EACAC948F78865F76836F7171799D89626F523934545C55
+G0 X100 Y82.333
+G7 X-0.3333333 D848A644F485F8679978A68884B4475827A6F78809C979395A0B397899D97A8A09E846359816857838D73485B6669622D54526469979F9FAB987CA29A7DACB46D63935A360B312D7B4957A1835657716D7E9FA19497A6A0A27897A9B7AD656E705E67601E
+G0 X66.333 Y82.333
+G7 X-0.3333333 D8A95A47F887D5C7A6F56545064626B58749675939C89938EA3A2988B5D7E7166A19B887D819A785662787679A6784E7B656F92957187876F88896EA8B7908A975B537FA77A606155605B464C5D757E796C6B66924C65917D687350947B8BA6A8A6B3B59994A6B5B5A8A18A8893827A41
+G7 X-0.3333333 D132D5C345D5E67858E7156534D342B2C4D998F31559058426368827C75AB869E745060447187797E6177574B3241514D526D875B5A8485758B6574809375527D93A096727F8B845F404D5E6784677E6B12
+G0 X1.667 Y82.667
+G7 X0.3333333 D0C3F230F5D7A6C836C65798C5E65769AA8A9929A939291753B8E8A8D935B7190614484A484596D6361689DB4A37C675F539182687C75887A7A5A4762704232B0752504
+G0 X24.333 Y82.667
+G7 X0.3333333 D1D4D6D5E766C6488726A3A272F16517954638982A8B29FBAA8A29DADAAB68AA6A27D73486DA15F6B8A839B725A5165825E5B627B7E58508A96A7978177888A8089B4BBA17C927C89A774949F6D43837A979A666A5B4A718069427D7DA288719A79328FAFA6B6A3809283666A8F956557
+G7 X0.3333333 D538C9B8F789EB4919572BAA89A7323436D6B816E628B859FAD955B96B48B9A6D7484787C765A475F71666F310F70703A77844563A78174B9B0918DA0B0AD935B5057386B50748161528C805A3868635B6AA1999DA48F98989AAAA7A37F646A86745F6C8B717E817F825257656A5E7741
+G7 X0.3333333 D518B74
+G0 X100 Y83
+G7 X-0.3333333 D4B5858324F68767E635C6F679B8D9B7A6875707E76928D98ABAB9BA7A397ABB09683959F919052465987777B516D5F9B5D486B6884978D8A848B86AC7E5B847A8C8E6F583F527E281B407A6361706D7C91976E567C5A9F6532648F91665F517298A183995370A5ACB072998B7AAF8E96
+G7 X-0.3333333 D8B6C434B5F6C655854787E6597A294AE8A76A1A1827587837650588A766853758A978C8D796D449EA1889F8996A2B6C79A8869816B888F757DAD7E7E76827F80AB91889A8B62665F5458805D6860653097A59193B3A49A949CB2A7A898A79D8E80808766325B17
+G0 X28 Y83
+G7 X-0.3333333 D305E41597C5280845E7C56216B8068B852
+G0 X22 Y83
+G7 X-0.3333333 D5678544644537B695F7887737F7F78676FAD939478537489948A9561798C838D81788B6D8487858387A7A0919A985F6A43715A6A565A6F686D26416033
+G0 X1.667 Y83.333
+G7 X0.3333333 D0819413B16497A473F411268636A93A58A8397AA8E8B9D7AAD897B5B607565767E716D617A777C2E637E7B9A90936F8794687D606B564E4F5C497232613B5FBC734696708C9F7B8F83849D4D34544D43968A6160B08B7E9974979AAAB1B3B6A2959BA37B6FB67D376B4A6E8174464F6C
+G7 X0.3333333 D819880659795888869948D8BABB28C8A8DA48A805F8A627C9FB2C1A4B385777C684674AA8AA273876EA2A19D7197867C787395ACACA6929D967A7E7D475D57513A2F345481949AA8AE8C81A394A5A1A28EA99D8B86918D66685A959A9D8D4F6F7E8F915084A66E5657608379805D033B
+G7 X0.3333333 D6C8128638E92AB88786490818693685F4F5D6F51484D99895F988A88646060586FA48192B28D9B9C9491818BA7B4727E97A88E9E9F9B7E88A18682897494B09184725568824836
+G0 X100 Y83.667
+G7 X-0.3333333 D324471697A679284667990949D8F8B8282A18F6D919D99747EACAD796599877B8DA0A17A659A63435B4850667DAF927C546840593D4C8572607386899696888195856665A873414A356976819469415A3E456B4C6A90A1834D85AF9FB889988F8EA999968AA9A3A5AEC7AB9FB6A9B7BD
+G7 X-0.3333333 DAEA5A2978C957959575C63738E867F8FA6A7A09389877F859C9987899FA884967251ACB6A8889E908EA8A9B1C39252537E7B668E7F7E797B90ABB8A48A846972737D8459879C7184A4967B96695C4B393F6F76A690A69EB5B29EA4949D807F716386A26D88607A8984456D8B8BB2BFBC
+G7 X-0.3333333 DB9BF875E65574E9D727239437F64694F495741616E81918175607C6650635D3070897D6A667A73888A696A7871A0A0A789978E91A98B88BA9C4F253C30517153222F111115
+G0 X3 Y84
+G7 X0.3333333 D2C15
+G0 X4 Y84
+G7 X0.3333333 D084670314A2E6978A7A08BA27445698D92988B648647447B7F7B75666B69544B3E694C30505E686568787062686857717D89A1A7AC70A0715A6B71435980B3ADA3A4A87EA080488875535B91607485777D9F639C8B9EA797A4AFAC94B3AC7F663F4B6B919680837D797B888B787D6C80
+G7 X0.3333333 D87865779A8AAA398727F61858C7F7F5C747C8D95B9B1B0A7AAADABAB899455657B9183918B7E88928A5D6B8189909EA4967993623F686962929E97A0A1B89F9FB2B0A4A1ABBDCBAEA8B09AA2A7A5A58196B09BABBAB78C64918076577B5D443B3F3F6A62426D3B24646E66B0604B746D
+G7 X0.3333333 D67B1AFAC7C486781604F55624B573B518C817658556B60404D5D765E7DABAF866BA2A39E8394A2907C918B67579E9E917F708C9C808F817E7E96677A8472461D
+G0 X100 Y84.333
+G7 X-0.3333333 D533E507572929681919CA7A39B8A738DA4A48F8364617E7B989388978C889376A7AD916372618A7F53526361524D5B838C597077A390535B88746E5C8285947A8389666673A5A9995A4A4B4D3E543C575A636C8F624B757A829690ACA7A7ABAA9C98B2939CA3A4939DB2A8C6C3BBAC86
+G7 X-0.3333333 D5D95BE86A59790AF8C7B80743E4F7C96A1857F8F84643B6D856B658383A5898D7466356391B2AE9CA89EB6B09698958A5F898C94916D9E699BB4947195506E6951729A6D52735474705C728A7A618266769BAFA8B5ACBDB49EA3999B8D7EA282607F7C537D4454B290547E967E9CA4AD
+G7 X-0.3333333 DA5AB7B629D8A6F8C6F76B8B29CA76F7A72586E6370345657626F354B4144615A58496E81545291775F4B58816B7D9B939D66516A68999C6E3E4E8D482C775F0F
+G0 X3.333 Y84.333
+G7 X-0.3333333 D09
+G0 X2.667 Y84.667
+G7 X0.3333333 D128070355256263547789AA76B5D74787E7897A89C7E7B73727C7B7B6F7162426D54615B4B6957154B4D5B604F3868826774664B704C6EA7AFA69288988087A7674BB2B4B6A9926283887C7A9945384D73777B6567665E7BA29F9997A1B6BBBAB18F6060487E77779B745C4C47663429
+G7 X0.3333333 D66A195695F5648948380AAA8959C727F8795868899AA9493BAABB0BA75947164634D747E667F95828F645D3D78887B8E9D718893868C65567C7F4F80A3A0AFAF91856671A6C4AA90A3A6B29C8F8E9FB08CA0A18CA2B3A7AA9F7DA0AF8862658C8A4B543C3547532659939F8C868C6348
+G7 X0.3333333 D686F635186726B4D356D8C824F8BAE977D7B6676676156576A6E4252A5967F9872709EB18180918E89A3AB7D655C673A617896B5A484759AA8AEADAF96837D4E4F4F111D
+G0 X99.667 Y85
+G7 X-0.3333333 D1D43576D8266728CB2A49F8B756D8CA69D807A9769698C8A9CA4836A7D8A759BB49476839095846F66876640504D4F705B858C7473977B98883E4355514360423D4543715A638386AAA88D462E473D3A4E4A46647A9499AFB59F7F829C9999AEA6939E9F9CA2AD988E7794A7ACC1B38F
+G7 X-0.3333333 D847D8E9397979180746C4F505172907F847D978C76807A38793F80AD8095839F9DAC8D8B757758A6AE9B8E9BA094849A8FAF818C9A9BAAAB837597777F5D6C84989B6D877076655072A2B5878197827378A1B6BCBBA6808586A88F6072635165674E8865475B4B687E658F7EA3A6B2B5
+G7 X-0.3333333 DB6799479895B939A767EA7B28F433C4D608A6971764E635C54674B2761525A406B664F60694F5A6F6F8B63654B67AE927A8C828570868DAE8F413B085A285C7CA6AC2B0201
+G0 X2 Y85.333
+G7 X0.3333333 D0F3F2993A296360B22023070969481967D89936F7A7B6F82591243693A464550655249746C695E4243435A6C5B7A63716B608363466A687A85A59C7D56969A6C607E88A3AFADA99E917B90729A4E3A4E235D965651475174637F9C8B7B9390A9AAA9AFB4975592A48394AC86696F7776
+G7 X0.3333333 D94946F92626C8764668495777BA1B3A9979F8DAC9A9F74979F93769396927D918694A17E97A5738D89AB938E976E897E7EA19186837967464B826E9DB077537B70878E94A79DA0ADB1BBB08F8590A2909992949AC0BF98A2A6818B9BB39FA08A4F5334525147694456669A7861798C6B
+G7 X0.3333333 D8873543C400C6C6D551025829167324A6D51719A837D6A59545D597693869A9AAC8B9A98AB9A6986863A799A958EABA291A1937C996F8680706A9D7F807853848868602C
+G0 X99 Y85.667
+G7 X-0.3333333 D17616B65657E76776F7D9AA49F507E778DA29B8C8995939F9F8C7264AEA9918D797E6F76ACA47B795B6879888E7489A06E507A511E486891640C1169633D592D835A5C8A6F67656E8C836B74605E846254585783A68C88979CAEA4A59CBEB9A4838F9CADA1998FAABFB5AB9FA3A99594
+G7 X-0.3333333 D9696A1A0877CA0735B764F646E84837F889678755D6A96935384B39E85A69468658F989CA385757A735D928B9494A9B0A1968391ADA3926989A3A15E8A7F547D4A679A7365847A4B63907C85938D9695ADA388ADA17D785B708E54492C352E7980562941313A7D8987789895AFA49FB2
+G7 X-0.3333333 D92847D959C998D9699968D8E58644F469456648B81707F7268687E5C6682665A54735C614F3F5B512D336E69527C8C6883758D89864E71780D33
+G0 X4.333 Y85.667
+G7 X-0.3333333 D5FA37582401E13
+G0 X2.667 Y86
+G7 X0.3333333 D24875780702A3A564B6F476A97876C728B7A7F5F62774D3E505F635A3E46776051937C80747156527545735F72735668836551627376A1AD9968759F9C96896F669E8274A09F8C627F8D7A8548424E462D41322D3259596879938570769F947E7B9FA47E7F586D99565E4E666D598864
+G7 X0.3333333 D7A8A81813F6ABA919E92768DB197A1A4B09BB3B2A971907F89717B6D97A993736D89737063A29B644972779B7C7375717A6348687242426155798C746B7E96947A5D5795A598A5A1C0A994A9AABB9E938093A9A8979D90A59A90718C8993947C5C746C616399657E8996887A7C828B7D
+G7 X0.3333333 D490D205E4210
+G0 X80 Y86
+G7 X0.3333333 D474B5B4C280327457E847A8F7E906963927381AF9981715E637D74A87C63748483A298967164A1B47177736EA5B09A957877705A5B69863E29
+G0 X99 Y86.333
+G7 X-0.3333333 D4E62393C7B425B856C8B879B8E76A06B60A59B708A90929E715F625B697097A67285788283877A687B68647C48737940565B0B1F280C2A01
+G0 X79.333 Y86.333
+G7 X-0.3333333 D1E3D4B3F536491925E758599624183739B9EAE94754C6A9BA4757B7D969D9787868571729E8A8F94A6978D9EADB2A5939E78807B437F93756D818886A5938A603E4E54645255695C7374858F849192866A6F604B638B9A8A8F98835EA0A8A7898DBCACACAFACB1B4AE988F746F8A9C66
+G7 X-0.3333333 D7C6489A2917F6D786E918D7A6C6E666373508EA4A591889890959F936C8405263B09214A24
+G0 X29.333 Y86.333
+G7 X-0.3333333 D1D57695B7A854A404057776A7A9D6C6E7986867A8F7673859E7F7F9A8141355F886D6C5C5D4F344473874C8DA79EB08772808E707D5A46666D746D555E676373725B8975604A3A8170434A6351648D0F
+G0 X2.667 Y86.667
+G7 X0.3333333 D224C765F524C645C7B412D4631457773656549715752687F696068768C98A29DA2A7BCB89981AA80105343725D67543B4F586782928C8C9485687B79708A645D526E4D56726C4D3D326C746F6F605C1A033A1F2E024D1C289E646E8E979F7883B6AF7E68687B66724469B09BAC697564
+G7 X0.3333333 D1C61655954616481755C4F7994A09F9F93AB9DA2AA9B7A96AA6D5C847371868C6B696D8665499079678C978575618F8D4D48516B4E6B768F8389858889726E88596D8496929D99AAA39F9A8D809490909877415860858192657A905A759D7C69765566A8A997757F6F7A9B757C8B776D
+G7 X0.3333333 D3A8C5F4D5A28
+G0 X81.667 Y86.667
+G7 X0.3333333 D11137984
+G0 X83.333 Y86.667
+G7 X0.3333333 D5682825C444D5E6D4A6F7D8F869D649884787A646D6B5C617F918A929494496E7E716D5E83876A815C55701B14372115
+G0 X99 Y87
+G7 X-0.3333333 D0F1108
+G0 X97.667 Y87
+G7 X-0.3333333 D4B64515B6F7187695F7A768E7E7184937B7D7360415F4C4D4B8D65605B65878F766D585A654D4686A057314E935E
+G0 X80 Y87
+G7 X-0.3333333 D191031665B7369688F96927595AC9BA37B939EA2936642737374854A3B8568567A8E5E6A6B393B7B9C626891A9A8AD83A29CA6A2A97F7755596E6D7B6C71828183989B5069A88394A27F64887C769357627C605A8F7966436A828399836A96AE816186A4A7ADB0999A9C7C7E96734F43
+G7 X-0.3333333 D486E6F494E5D4A3D7E485692A17F6D856F5EA675639F968476898E9D526A789F3C33520214
+G0 X30 Y87
+G7 X-0.3333333 D444C7B826E79677C636185644F68835A737262478A8A7F757E6A5D7CAD9C987D70385250536D9A7D9F9B98949EA28395AFB0B69B6E939A99763F6877585165527C9F8D7855777C888B6C25255B4350855409
+G0 X3 Y87.333
+G7 X0.3333333 D242543411508075E769972788695B58B604E717D526A4F56825D7C7C96A6A7A2BB986EB58985B0BFAB76776F5B65631757856078A470549E7E87725C47678F8A728A9C574996A598776B4C874D77A49B681A1A23343763816C4D5F9890999A7772637C859563729E978D897C636E4751
+G7 X0.3333333 D4A3E5A8C7C5B3F53547E97879B9CA28BAC859FB38B85799B9F858D9D794F534D6264524F515EA49187755C6D5674A09D9EB29D919F88707A83716B644C637774617D7993A4A0A5A296B09FAC976E6F827E7B6A76737D636D6A6F443E7187505B445C509BB7A07B8EA4A0805E7A898260
+G7 X0.3333333 D7B7A4D6B303F21
+G0 X82.333 Y87.333
+G7 X0.3333333 D39848C4C597E71343C572E4A79807E7C3B5A60577E6B4E69521C58936F6D7D8A748F9B82997E776E657251404716
+G0 X97.333 Y87.667
+G7 X-0.3333333 D14505956615D68605B636B7F78897266322150495A542A69835E615B525D606A7659657B4D456F525D58736E31
+G0 X80 Y87.667
+G7 X-0.3333333 D0A54555B505D889A873F6F9480619B8CA0B59589678D5057647F7D5F716A698E9B945F674E376A7B7B9AABAC7E9096B4A079A9A282A095897E5F7A90766E757C6E6E8EADA999999D9C8B7F6064968A8E9E7C605345507C61634950687C825D777B7D81BB8B92A27AA199A8916C6B5066
+G7 X-0.3333333 D435562616B604B72599D9B808994949E90523BA3B07D6EA7A2A790627E696E551B513A010F024A7371696258646B6FAB9AA882A3787A5086A387695F4B6E6F7D77706059474565
+G0 X18.667 Y87.667
+G7 X-0.3333333 D4B8BA6936C8DB193AA779CB2979E7B6EA3AAA4827F6B4955677A1366778EA945848949536B7C647E2D05130A2826
+G0 X3.333 Y88
+G7 X0.3333333 D25
+G0 X4.333 Y88
+G7 X0.3333333 D171D
+G0 X5.333 Y88
+G7 X0.3333333 D605E1A5C536A8B826EA3A06C7D7C947A4353853F6C779F98977D9FAEB6A98A99938390AFB19B8D50545D
+G0 X19.667 Y88
+G7 X0.3333333 D186E5C6B817674677A88885E83A3938A9992799F8B906E675E587E5878606458341C4F6D312847785E68A6A17AA6849FB28D406F98948F8593907F9A707B71765E6057819476738D8287928E9C89939C94A08B56746F53643E4E585D6065665150706A7E8368718677586A909DAAA4A1
+G7 X0.3333333 DA7A3B4B0A4A596978685A56C7392BFA07DA3B9977D9F9899979B9CAD8A724734615A699EA2A48D7C7F4567725F5C838F925481ADA4AA8D60786B514498A3945C7265564817
+G0 X82 Y88
+G7 X0.3333333 D14
+G0 X82.667 Y88
+G7 X0.3333333 D63844E4357423B61656F8588666D526B606B5E7F551A59685F2955564D80617A696D94597F6C544E5B4D314806
+G0 X97.667 Y88.333
+G7 X-0.3333333 D141F
+G0 X96.667 Y88.333
+G7 X-0.3333333 D26543054657360788F5960726459545958616A634D466D6673796E4F768580465E3C676F1E726F528163380E
+G0 X80 Y88.333
+G7 X-0.3333333 D03326C3464879AA3A46B434B54677596A69B7B4763978766698372797081AB8F7CA867445567638281A47F88A7AD7D9CADBEB5977188B35D3D5580768E9C8FA491B1B49EB2AD999B8392653F*035D687568617E76404E4D4C644067835941659D7C768A918D6E7A90848D9565757276
+G7 X-0.3333333 D827B5C5E658697917E8772A39083936A7579694A9B917798919AA0816470581FA270676D958C7F6179477D986A6987769485837D6D72AAA37D57515F5F50626553627F43
+G0 X19.333 Y88.333
+G7 X-0.3333333 D5D90738A885C6081747B8F9AA8B3AC9BA09A9F7F7C8F75422623566E928F7EA38C815B071715421C2D39262A
+G0 X5 Y88.667
+G7 X0.3333333 D0F3B381A2E28
+G0 X7.333 Y88.667
+G7 X0.3333333 D1543754B88686B7F75221B2A3D40165B4F969C8E64A3B2ACA9747F9BAC8643638152785F
+G0 X20.333 Y88.667
+G7 X0.3333333 D14316285757A8662584E598896767E895E7E9788988D7C7D4E6A8F74819D747073559285687E81889189948580906243795079646596838C9A8F4C8A8F7865625D645D725156619C97997E846E8F8483468796608A72696B34697C6E617D9D9C98A69F75723C3A416870749591A4ACA4
+G7 X0.3333333 D9D7E86AA9597708F7C79828577678A879986A3917B85806D6EA3A555598394815F879C99B97D6DA17D788E77674F398679878D7D554C55587084B29A93957343580D01
+G0 X82 Y88.667
+G7 X0.3333333 D09347F866B94A34C28223381645888663C557E844A687C874845865C38326C697F77516B6F684945391E
+G0 X96 Y89
+G7 X-0.3333333 D3A2B42747568674E7472614F5B435B9E5C607D816A737680766C6E73696E857D3C205580644D6A681F
+G0 X79.333 Y89
+G7 X-0.3333333 D0D315C839E8F81675E63516E7684875D4B7572506481929182A45C93AC969B885E728C6B6F71A3935E6D418A76588A8EA383739094705E81748B5A57917986898C9A96A19C90856B6A68517B827AA3914D8287958EA17686514E778B975B678A6B787F8B8F58648EA96557896D306374
+G7 X-0.3333333 D4A615C63596E4A89BEA2937B5A5469816F76619081A29671787F789A798F744C85846B7B949F7C846A6D6F809F9B9E97A38A8A936C7C7276606E744855885D12
+G0 X20.333 Y89
+G7 X-0.3333333 D01
+G0 X19.667 Y89
+G7 X-0.3333333 D153248266E285B9CB3B4A1B19CAA9E6912528F59194857
+G0 X11.667 Y89
+G7 X-0.3333333 D32603D537C56585C62706E5C3B
+G0 X7 Y89
+G7 X-0.3333333 D493E15312E16
+G0 X5.667 Y89.333
+G7 X0.3333333 D5213
+G0 X7.667 Y89.333
+G7 X0.3333333 D1A578C60476C6B7F824A49
+G0 X11.667 Y89.333
+G7 X0.3333333 D1338
+G0 X13 Y89.333
+G7 X0.3333333 D5574493140528D8CB4A7A49987706385526B2E4D0C4B
+G0 X21 Y89.333
+G7 X0.3333333 D2C8B66485886805F6177657E57517D897F7A84745F849481889288676E7A582F3D6E8F826C7D6E8F9FA2ABA27F70295F5E606B7C9295AA92836B4B4F68592610190D3C7F70568A85756A6A748C755B7144475573897E744C6A8CA2A2898E7F9687638D98684B79967B9A9B94886159
+G7 X0.3333333 D6969627A5C515C4F585B85635D5E7F8992824C6DA47C96807C7A887A5D676166A181739B8D6F7C656E6A676172583D407E8098857A8967697C5F7C8E835F0F04
+G0 X81.667 Y89.333
+G7 X0.3333333 D031138733F4C4B627B685D5A525D47427D76317BA17B5E6D614A5F9F91565F716D7B71664838635D231E21
+G0 X95.333 Y89.667
+G7 X-0.3333333 D3707
+G0 X94.333 Y89.667
+G7 X-0.3333333 D1C605E90938B763E6E876D693E69677A338F885591402512
+G0 X86 Y89.667
+G7 X-0.3333333 D1508
+G0 X85 Y89.667
+G7 X-0.3333333 D3552317B2E2A684E883F
+G0 X80 Y89.667
+G7 X-0.3333333 D4B2E3D5B708376607A96868C5D6B6D8751877262616B4F5A63645950696B806E8A7C497469484D524E5FA4A485959C708A8A728788836A809E827C725C5248544E86929F978896A49599906A6C7565576496A58B828B84788C766E6B637D615E4B5868785D54536C6F7E71658887480D
+G7 X-0.3333333 D160A
+G0 X41.333 Y89.667
+G7 X-0.3333333 D2A
+G0 X40.667 Y89.667
+G7 X-0.3333333 D0D4560757C69955F27262D2B7B70A59EAAA7A47F68978F7941658A594A61796B5B898D6285746C604A60726B5E67654054685E5A7E6961836A7E2A48042A66678192768A839D93697EA0B0604B335E288153
+G0 X11.333 Y89.667
+G7 X-0.3333333 D0C2F43717D5862605725402622
+G0 X6 Y89.667
+G7 X-0.3333333 D15
+G0 X7.333 Y90
+G7 X0.3333333 D070F0F2F5C3334552B13
+G0 X13.333 Y90
+G7 X0.3333333 D0E5D111617655DA194743D56682974A1A78FA0942C297855686360686968678A62585170776E54798C62826A6B6C606D54472E6173515669814E883A62726790978B9CAD8287764533245E83A36C725103
+G0 X41.667 Y90
+G7 X0.3333333 D01392E224CA1745D4E3F5F56493A3873774F2D6F8D727A69618B74646E737891849069688074505B8D695F8A8D847FA8B9B48669754D6C77A9A47D6F94897C88949166AF8C787EA99B5F4B7261748B9067825C64506B84658D6E5964524070785554638E715873808C995C6776675D5B
+G7 X0.3333333 D597D5104
+G0 X81.333 Y90
+G7 X0.3333333 D1C4587544921576D5409
+G0 X86.333 Y90
+G7 X0.3333333 D015C1F6F3E4B67676D8264616068767D3D2870837859280B
+G0 X95 Y90
+G7 X0.3333333 D2302
+G0 X93.667 Y90.333
+G7 X-0.3333333 D1E4E4E57293E6262868B537B925A646828633C6640
+G0 X85 Y90.333
+G7 X-0.3333333 D0110432D3C130717332103
+G0 X80 Y90.333
+G7 X-0.3333333 D266C6D596544538384969C535A6E469B7765577460577491675B909E9A7A5D676A7B61A39275899A73759D7A877283B065709A9A8370888695949B746F6B8A8B989C989A8080704850656D4C51688473708A3B6F9368465D756A6C6A5857704A494F555B202865524E6368516466442D
+G7 X-0.3333333 D3359
+G0 X40.333 Y90.333
+G7 X-0.3333333 D041E5585B054198962
+G0 X37 Y90.333
+G7 X-0.3333333 D4F89A181638C6455776054267A9A3F3553676268595C56687E61645E658EA174697369907C5A7F8E4F4B60505280542B49965885757B7695946E355B6B8491908D952E
+G0 X14.333 Y90.333
+G7 X-0.3333333 D045B0E01
+G0 X12.667 Y90.333
+G7 X-0.3333333 D07
+G0 X10.667 Y90.333
+G7 X-0.3333333 D1D17053743
+G0 X8.667 Y90.333
+G7 X-0.3333333 D326434
+G0 X9 Y90.667
+G7 X0.3333333 D327B1707
+G0 X12 Y90.667
+G7 X0.3333333 D202607194844363F9A9B887FA772239291958171648C4C856F4F445C7C6E605B624D436061855A8C91A57A8B835865635E7E806E837D646C5964560F129E8C8F94232767454C73698B745D40969D898E9D8A565930
+G0 X41 Y90.667
+G7 X0.3333333 D03
+G0 X42 Y90.667
+G7 X0.3333333 D7C6C1D6167535A5661635F6648130809263B3E4C6647868984895C5468898F656F8D746578694C6A6654677A7386818D92948482819B9E8484A487849085887A7C858E775B6B647C689CA882779397596C8A645F77909B8C6A728B8D4F506163658C9E3D4E6379696E766C44593C1622
+G7 X0.3333333 D09
+G0 X82 Y90.667
+G7 X0.3333333 D023B4F0E
+G0 X83.667 Y90.667
+G7 X0.3333333 D133331
+G0 X87 Y90.667
+G7 X0.3333333 D221426443D21267072308686717C48
+G0 X92.333 Y90.667
+G7 X0.3333333 D05
+G0 X93 Y90.667
+G7 X0.3333333 D10
+G0 X92 Y91
+G7 X-0.3333333 D276F68656522504624
+G0 X88.333 Y91
+G7 X-0.3333333 D1C290B0E
+G0 X84.333 Y91
+G7 X-0.3333333 D080C0D0501
+G0 X80.667 Y91
+G7 X-0.3333333 D0C15
+G0 X79.333 Y91
+G7 X-0.3333333 D136F81557E6A584D628677586180698B82775A43627673698D919B8B617293686A625A6696948E6A908661548394605E7C85729D988D8F939CAAAA91759FA671786E8A959D826F6B7A605A8088817B7977877C6B74916A685F5B515C5B204247
+G0 X46.333 Y91
+G7 X-0.3333333 D4A526B6A836138796D493F8C712C6F1E
+G0 X40.667 Y91
+G7 X-0.3333333 D0114154D656A9A9F948C6B8669607D652523536540425F79394C6C738E6E719A7F4E464CA2955B7F5A82A87D819393438D512A14213F7C60715A642549836D7E7167A48B81A2974226967B9263877A765D7C304D3C
+G0 X9.667 Y91
+G7 X-0.3333333 D37
+G0 X12.333 Y91.333
+G7 X0.3333333 D2F516E71729D7B7B9190765175A8A69693A2A6895E6C523CA95F6E616C6A561D1A4B5E6F5958948E75629E898881407E755A4C4F808476798B78474C38540E4A653C1010636A*037866878C90936E512C
+G0 X41.333 Y91.333
+G7 X0.3333333 D4D826E7070686A716A6F734F798B4A
+G0 X47.333 Y91.333
+G7 X0.3333333 D176260616A2558856E79765E495E65627D94B2A8914F677D6A656B999F8E7D8B8481917566837894937C6F878F86806E7054476F88998E7F72548291735E5C53656C7E4962869388476F6D4666656F69635850515051535E58696B815782885B063A7C3F
+G0 X83.333 Y91.333
+G7 X0.3333333 D10
+G0 X89 Y91.333
+G7 X0.3333333 D06233B535048161B0E
+G0 X92 Y91.667
+G7 X-0.3333333 D0B163464432712
+G0 X80.667 Y91.667
+G7 X-0.3333333 D3D66373E7486716D798F6A53605449777C57625B655B717A6F68533C688859586A88525F57486262636076677E6C7B86685E727D7C6B8A88596480816762622B397F8A7A7D5E7D92947363527A7240959285949E93626D7651868B91AE4D3A6B696403
+G0 X46.333 Y91.667
+G7 X-0.3333333 D4E7C61614F4369876366685F593C
+G0 X39.667 Y91.667
+G7 X-0.3333333 D082C534C9B6A3A738F726A79916D3F255454777372723E6370686A7F5D7549679F2B4269987B7876785F7B9E725D572E352E1C2C778D92907D85717854728081ABA097A58E977482939351609B817A423C24
+G0 X12.333 Y92
+G7 X0.3333333 D07431B4A448A7D4C6891979F9D9F928896988541A37B888B717B555FA0A16847501E0A1F6D7F76584169495447688C7F749A780E6B79667A5A2A804851766B617037
+G0 X34.667 Y92
+G7 X0.3333333 D0C1B4B736E54796E6F613B5C796615
+G0 X41.667 Y92
+G7 X0.3333333 D1B3F3445566681601858392F521B
+G0 X48 Y92
+G7 X0.3333333 D101D332743636989837891656D7D85A17A688B75704F587B929465836E6A8F6F3E5976614E586669716F906B6781434467445B65687A7F8352636A5845395B45647065707A4D4D5F6752779C704D4B4D55719187874B27768D907E7C665E46448B0E
+G0 X90 Y92
+G7 X0.3333333 D05101D01
+G0 X81 Y92.333
+G7 X-0.3333333 D21607636436A6479718789833E30769584305B594044658A886C5B5A534B545F404C4F48554E526A605B4A5E754E3F4F566C885C5367705B725D4F635A716D5C63826C657B81858892A399967A668A9F997F8F7D635A1647626C88684C0D
+G0 X49.333 Y92.333
+G7 X-0.3333333 D03
+G0 X46 Y92.333
+G7 X-0.3333333 D16
+G0 X45 Y92.333
+G7 X-0.3333333 D0D
+G0 X44.333 Y92.333
+G7 X-0.3333333 D3E6B6B37092910
+G0 X39.333 Y92.333
+G7 X-0.3333333 D26376C452D18276C41474819201C224012275B37
+G0 X32.333 Y92.333
+G7 X-0.3333333 D2D3B0B213F3568643F9085785E4865582E306F58395A7F753C4338476B79A5B368676D6C665867A02553908C8D887D718589504F7C8D82182E15
+G0 X13.333 Y92.667
+G7 X0.3333333 D1B5F559C8589570E56717E87A59E8E5385851D31469290969976547A8F4A5646044D7752414A62654A5A8535358256556E7C8E531A2B272B1E
+G0 X33 Y92.667
+G7 X0.3333333 D0509
+G0 X35 Y92.667
+G7 X0.3333333 D0433592E464408
+G0 X38 Y92.667
+G7 X0.3333333 D0B762D
+G0 X42.333 Y92.667
+G7 X0.3333333 D3527
+G0 X43.333 Y92.667
+G7 X0.3333333 D5046
+G0 X50 Y92.667
+G7 X0.3333333 D3980757943120F
+G0 X52.667 Y92.667
+G7 X0.3333333 D0E808A71819E907351868A8E755D8487765966605F6D7184687467507A5867777F55546B5058546B6144535D6C5455874332393B4959574E5C5C5F625D874847546B7F54698E595B4B736C6A72583C5F468B3E4B01
+G0 X80.333 Y93
+G7 X-0.3333333 D1B3C6070646A78651B827A46488D75898B7B9A57779C7D6054494A6E9A65486983634F787F6D747C6A4E7C7D788D617A36415B6E814F3F6370758EA3857B7B8F887B7F5B6E6E7483695A50878E44698F6A820D0B6867438069744226
+G0 X44 Y93
+G7 X-0.3333333 D0D4E
+G0 X43 Y93
+G7 X-0.3333333 D3766
+G0 X38.667 Y93
+G7 X-0.3333333 D332D1301
+G0 X37 Y93
+G7 X-0.3333333 D136906447C1A06
+G0 X31.667 Y93
+G7 X-0.3333333 D1C4F645E375A674D62915E374F123A484042344E7457101F69767D888B3A44A06F576D6C5391723194948D85766B6107529F7C503115
+G0 X13.667 Y93.333
+G7 X0.3333333 D0B4A366D6F2D185C606A7A6970916C66438094A871685948468D7077635A524A8069395C3505
+G0 X27 Y93.333
+G7 X0.3333333 D227E17061681346B624641321506
+G0 X34.667 Y93.333
+G7 X0.3333333 D05292D
+G0 X36.333 Y93.333
+G7 X0.3333333 D0E
+G0 X37.667 Y93.333
+G7 X0.3333333 D1F29
+G0 X42.333 Y93.333
+G7 X0.3333333 D3B61256502090A
+G0 X49.667 Y93.333
+G7 X0.3333333 D2A6C7A7758685E30
+G0 X52.667 Y93.333
+G7 X0.3333333 D053E78864E5066806E7D4133838E5D59816F7692905D98918B6E5C574C4D5D55574A1D68746A82746871786E7580573E86818876644B896140495E74ADA5A383A388717E71565766865E375772704F6F5C
+G0 X80 Y93.667
+G7 X-0.3333333 D072059505D6E5F73397B62444A7164515B938284A5A5633D50697E7F5F4F63788978576B748370768394978D5F5E52497964664F3A473A5F7E7D96876E95927B627782707987574E71845A416C6579833E4209
+G0 X51.667 Y93.667
+G7 X-0.3333333 D3060425E27
+G0 X45 Y93.667
+G7 X-0.3333333 D1252270E3E3C0C
+G0 X30.667 Y93.667
+G7 X-0.3333333 D1F404C0A5A6C
+G0 X27.667 Y93.667
+G7 X-0.3333333 D4223
+G0 X26.333 Y93.667
+G7 X-0.3333333 D394A61262376684F4C692F593E52502661A297A39C61826579A2827E78615D3A3948154321
+G0 X14 Y94
+G7 X0.3333333 D0A14
+G0 X15 Y94
+G7 X0.3333333 D35602A29679078707B702D4E7C8E858A9F67515B58613E5B7D483C554F3729344308
+G0 X28.333 Y94
+G7 X0.3333333 D11332701324F21
+G0 X43 Y94
+G7 X0.3333333 D4521
+G0 X44 Y94
+G7 X0.3333333 D2522
+G0 X50 Y94
+G7 X0.3333333 D0F0E34644F3A03
+G0 X52.667 Y94
+G7 X0.3333333 D0626666159705949674B7F8690837A63366180827D5E718E82855A4037473722778A59271952A477878893899B76737166789EA194A59A70574F5C6A778969637164854F5A37
+G0 X76.333 Y94
+G7 X0.3333333 D18563A64664B575D22
+G0 X79 Y94.333
+G7 X-0.3333333 D382A515B2745241744404A63616A76687669506F7B826E928B897C7F76526B71727D73586A75637481300C491964862733
+G0 X62.333 Y94.333
+G7 X-0.3333333 D2D435A6E86755C54887F5E58727370617278A18A79696F5A6D24072A
+G0 X51.667 Y94.333
+G7 X-0.3333333 D051B0106
+G0 X44.333 Y94.333
+G7 X-0.3333333 D0433010D
+G0 X25.667 Y94.333
+G7 X-0.3333333 D1740262C16223C1D494513113A3243939D926A6D57353E346C7E712906
+G0 X14.667 Y94.333
+G7 X-0.3333333 D0B07
+G0 X17 Y94.667
+G7 X0.3333333 D0A0E1D49716D8C9E6E5D54571116
+G0 X22.333 Y94.667
+G7 X0.3333333 D1019501E03
+G0 X24.333 Y94.667
+G7 X0.3333333 D0404240F
+G0 X43.667 Y94.667
+G7 X0.3333333 D4340
+G0 X54 Y94.667
+G7 X0.3333333 D2A65806E81506D5E67667F6954727863825F6D6565614126412A3A785C435E71
+G0 X65 Y94.667
+G7 X0.3333333 D356D5D6471444E576373718950647A8C8E87618A7F485F77573D4C34474D2E5B33121903343A4055
+G0 X78.667 Y94.667
+G7 X0.3333333 D0A
+G0 X78.333 Y95
+G7 X-0.3333333 D070B1B15
+G0 X76 Y95
+G7 X-0.3333333 D01
+G0 X74.667 Y95
+G7 X-0.3333333 D4D405D2C446D724E685B665E7B6C6E4A889A6D55616756535E3B2C3B174D5B78723D6A4A4E3E2D426D4B39645C83717E98696E837860525E6357386C3C
+G0 X44.333 Y95
+G7 X-0.3333333 D13
+G0 X23.667 Y95
+G7 X-0.3333333 D3B957B2F2A19
+G0 X21.333 Y95
+G7 X-0.3333333 D011C5A4682A1906537241301
+G0 X18.667 Y95.333
+G7 X0.3333333 D2F7C7A846F74571407714D3780415C2A
+G0 X54.667 Y95.333
+G7 X0.3333333 D19253A4E63566D58697168666F32807E510D4C3F4F200C
+G0 X62.667 Y95.333
+G7 X0.3333333 D2D4D47120E044E11044F5A42636042597158668A78736D4863806E5C3F495C4B0C386937
+G0 X77.333 Y95.333
+G7 X0.3333333 D01
+G0 X74.667 Y95.667
+G7 X-0.3333333 D0204
+G0 X73.667 Y95.667
+G7 X-0.3333333 D1505
+G0 X72.667 Y95.667
+G7 X-0.3333333 D2611365E4C565D72788A6272235A8275706D213C40
+G0 X65 Y95.667
+G7 X-0.3333333 D07
+G0 X63.667 Y95.667
+G7 X-0.3333333 D35
+G0 X63 Y95.667
+G7 X-0.3333333 D3853736E3742083C739675125A5A533658479480301F0A
+G0 X24.333 Y95.667
+G7 X-0.3333333 D0A5A75604E31106B31195F5C8F9B5C58460C0B
+G0 X18 Y96
+G7 X0.3333333 D3F50514D3D8B8E6D3F605757327A6C4C503607
+G0 X55.333 Y96
+G7 X0.3333333 D1058
+G0 X56.333 Y96
+G7 X0.3333333 D608552162D4B39594F577534291A614369735815
+G0 X63.333 Y96
+G7 X0.3333333 D03
+G0 X65.667 Y96
+G7 X0.3333333 D06444B688E916A32435561687B74553F5825
+G0 X72 Y96
+G7 X0.3333333 D1013
+G0 X72.333 Y96.333
+G7 X-0.3333333 D01
+G0 X71.333 Y96.333
+G7 X-0.3333333 D1644515553385C747A3A4F717A69744609
+G0 X63 Y96.333
+G7 X-0.3333333 D2E5E504E683043613C390916402E505D48698832
+G0 X56 Y96.333
+G7 X-0.3333333 D7417
+G0 X24 Y96.333
+G7 X-0.3333333 D1624171F1B0A1E430E25653E48455A0801
+G0 X18.667 Y96.667
+G7 X0.3333333 D04235B43132817
+G0 X23 Y96.667
+G7 X0.3333333 D0811
+G0 X55.333 Y96.667
+G7 X0.3333333 D045C23055847425749323E240A325A628B4F2F5D775119
+G0 X65.333 Y96.667
+G7 X0.3333333 D0B2159522764775C3F3125634B243F6819
+G0 X71.333 Y97
+G7 X-0.3333333 D0739704C2C8942064A274E52440F1138491A
+G0 X62.667 Y97
+G7 X-0.3333333 D1D78673B5161713308
+G0 X59.333 Y97
+G7 X-0.3333333 D03
+G0 X58.667 Y97
+G7 X-0.3333333 D0E1E3B244C2B
+G0 X56.333 Y97
+G7 X-0.3333333 D161D
+G0 X20 Y97
+G7 X-0.3333333 D4A26
+G0 X19.667 Y97.333
+G7 X0.3333333 D0F
+G0 X56.667 Y97.333
+G7 X0.3333333 D0420261D
+G0 X60.333 Y97.333
+G7 X0.3333333 D203A272F2A1E
+G0 X66 Y97.333
+G7 X0.3333333 D0C
+G0 X67 Y97.333
+G7 X0.3333333 D0252150911
+G0 X69.333 Y97.333
+G7 X0.3333333 D3A61141917
+G0 X71.333 Y97.667
+G7 X-0.3333333 D122E2B1832
+G0 X68 Y97.667
+G7 X-0.3333333 D104B0A
+G0 X61.667 Y97.667
+G7 X-0.3333333 D2002
+G0 X56.667 Y97.667
+G7 X-0.3333333 D060A
+G0 X61 Y98
+G7 X0.3333333 D1D5F11
+G0 X67 Y98
+G7 X0.3333333 D0403
+G0 X69.333 Y98
+G7 X0.3333333 D0E342E48
+G0 X70.667 Y98.333
+G7 X-0.3333333 D18
+G0 X70 Y98.333
+G7 X-0.3333333 D2225
+G0 X62 Y98.333
+G7 X-0.3333333 D040C0D
+M5
+G0 X0 Y0
@@ -0,0 +1,1611 @@
+; Dense short segments for the deep look-ahead planner: 0.05 mm chords of a gentle wave, with
+; a low acceleration, so that braking from the feed rate takes some 500 blocks. A 16 block planner
+; can't get near the feed rate, a 256 block one can, and the S-curve look-ahead sees more than
+; 127 speed limits within its braking distance.
+$120=5
+$121=5
+G21 G90 G17
+G0 X0 Y0
+G1 F1000
+X0.050 Y0.008
+X0.100 Y0.016
+X0.150 Y0.024
+X0.200 Y0.031
+X0.250 Y0.039
+X0.300 Y0.047
+X0.350 Y0.055
+X0.400 Y0.063
+X0.450 Y0.070
+X0.500 Y0.078
+X0.550 Y0.086
+X0.600 Y0.094
+X0.650 Y0.101
+X0.700 Y0.109
+X0.750 Y0.117
+X0.800 Y0.124
+X0.850 Y0.132
+X0.900 Y0.139
+X0.950 Y0.147
+X1.000 Y0.155
+X1.050 Y0.162
+X1.100 Y0.169
+X1.150 Y0.177
+X1.200 Y0.184
+X1.250 Y0.191
+X1.300 Y0.199
+X1.350 Y0.206
+X1.400 Y0.213
+X1.450 Y0.220
+X1.500 Y0.227
+X1.550 Y0.234
+X1.600 Y0.241
+X1.650 Y0.248
+X1.700 Y0.255
+X1.750 Y0.261
+X1.800 Y0.268
+X1.850 Y0.275
+X1.900 Y0.281
+X1.950 Y0.288
+X2.000 Y0.294
+X2.050 Y0.300
+X2.100 Y0.306
+X2.150 Y0.313
+X2.200 Y0.319
+X2.250 Y0.325
+X2.300 Y0.331
+X2.350 Y0.337
+X2.400 Y0.342
+X2.450 Y0.348
+X2.500 Y0.354
+X2.550 Y0.359
+X2.600 Y0.364
+X2.650 Y0.370
+X2.700 Y0.375
+X2.750 Y0.380
+X2.800 Y0.385
+X2.850 Y0.390
+X2.900 Y0.395
+X2.950 Y0.400
+X3.000 Y0.405
+X3.050 Y0.409
+X3.100 Y0.414
+X3.150 Y0.418
+X3.200 Y0.422
+X3.250 Y0.426
+X3.300 Y0.430
+X3.350 Y0.434
+X3.400 Y0.438
+X3.450 Y0.442
+X3.500 Y0.446
+X3.550 Y0.449
+X3.600 Y0.452
+X3.650 Y0.456
+X3.700 Y0.459
+X3.750 Y0.462
+X3.800 Y0.465
+X3.850 Y0.468
+X3.900 Y0.470
+X3.950 Y0.473
+X4.000 Y0.476
+X4.050 Y0.478
+X4.100 Y0.480
+X4.150 Y0.482
+X4.200 Y0.484
+X4.250 Y0.486
+X4.300 Y0.488
+X4.350 Y0.490
+X4.400 Y0.491
+X4.450 Y0.493
+X4.500 Y0.494
+X4.550 Y0.495
+X4.600 Y0.496
+X4.650 Y0.497
+X4.700 Y0.498
+X4.750 Y0.498
+X4.800 Y0.499
+X4.850 Y0.499
+X4.900 Y0.500
+X4.950 Y0.500
+X5.000 Y0.500
+X5.050 Y0.500
+X5.100 Y0.500
+X5.150 Y0.499
+X5.200 Y0.499
+X5.250 Y0.498
+X5.300 Y0.498
+X5.350 Y0.497
+X5.400 Y0.496
+X5.450 Y0.495
+X5.500 Y0.494
+X5.550 Y0.493
+X5.600 Y0.491
+X5.650 Y0.490
+X5.700 Y0.488
+X5.750 Y0.486
+X5.800 Y0.484
+X5.850 Y0.482
+X5.900 Y0.480
+X5.950 Y0.478
+X6.000 Y0.476
+X6.050 Y0.473
+X6.100 Y0.470
+X6.150 Y0.468
+X6.200 Y0.465
+X6.250 Y0.462
+X6.300 Y0.459
+X6.350 Y0.456
+X6.400 Y0.452
+X6.450 Y0.449
+X6.500 Y0.446
+X6.550 Y0.442
+X6.600 Y0.438
+X6.650 Y0.434
+X6.700 Y0.430
+X6.750 Y0.426
+X6.800 Y0.422
+X6.850 Y0.418
+X6.900 Y0.414
+X6.950 Y0.409
+X7.000 Y0.405
+X7.050 Y0.400
+X7.100 Y0.395
+X7.150 Y0.390
+X7.200 Y0.385
+X7.250 Y0.380
+X7.300 Y0.375
+X7.350 Y0.370
+X7.400 Y0.364
+X7.450 Y0.359
+X7.500 Y0.354
+X7.550 Y0.348
+X7.600 Y0.342
+X7.650 Y0.337
+X7.700 Y0.331
+X7.750 Y0.325
+X7.800 Y0.319
+X7.850 Y0.313
+X7.900 Y0.306
+X7.950 Y0.300
+X8.000 Y0.294
+X8.050 Y0.288
+X8.100 Y0.281
+X8.150 Y0.275
+X8.200 Y0.268
+X8.250 Y0.261
+X8.300 Y0.255
+X8.350 Y0.248
+X8.400 Y0.241
+X8.450 Y0.234
+X8.500 Y0.227
+X8.550 Y0.220
+X8.600 Y0.213
+X8.650 Y0.206
+X8.700 Y0.199
+X8.750 Y0.191
+X8.800 Y0.184
+X8.850 Y0.177
+X8.900 Y0.169
+X8.950 Y0.162
+X9.000 Y0.155
+X9.050 Y0.147
+X9.100 Y0.139
+X9.150 Y0.132
+X9.200 Y0.124
+X9.250 Y0.117
+X9.300 Y0.109
+X9.350 Y0.101
+X9.400 Y0.094
+X9.450 Y0.086
+X9.500 Y0.078
+X9.550 Y0.070
+X9.600 Y0.063
+X9.650 Y0.055
+X9.700 Y0.047
+X9.750 Y0.039
+X9.800 Y0.031
+X9.850 Y0.024
+X9.900 Y0.016
+X9.950 Y0.008
+X10.000 Y0.000
+X10.050 Y-0.008
+X10.100 Y-0.016
+X10.150 Y-0.024
+X10.200 Y-0.031
+X10.250 Y-0.039
+X10.300 Y-0.047
+X10.350 Y-0.055
+X10.400 Y-0.063
+X10.450 Y-0.070
+X10.500 Y-0.078
+X10.550 Y-0.086
+X10.600 Y-0.094
+X10.650 Y-0.101
+X10.700 Y-0.109
+X10.750 Y-0.117
+X10.800 Y-0.124
+X10.850 Y-0.132
+X10.900 Y-0.139
+X10.950 Y-0.147
+X11.000 Y-0.155
+X11.050 Y-0.162
+X11.100 Y-0.169
+X11.150 Y-0.177
+X11.200 Y-0.184
+X11.250 Y-0.191
+X11.300 Y-0.199
+X11.350 Y-0.206
+X11.400 Y-0.213
+X11.450 Y-0.220
+X11.500 Y-0.227
+X11.550 Y-0.234
+X11.600 Y-0.241
+X11.650 Y-0.248
+X11.700 Y-0.255
+X11.750 Y-0.261
+X11.800 Y-0.268
+X11.850 Y-0.275
+X11.900 Y-0.281
+X11.950 Y-0.288
+X12.000 Y-0.294
+X12.050 Y-0.300
+X12.100 Y-0.306
+X12.150 Y-0.313
+X12.200 Y-0.319
+X12.250 Y-0.325
+X12.300 Y-0.331
+X12.350 Y-0.337
+X12.400 Y-0.342
+X12.450 Y-0.348
+X12.500 Y-0.354
+X12.550 Y-0.359
+X12.600 Y-0.364
+X12.650 Y-0.370
+X12.700 Y-0.375
+X12.750 Y-0.380
+X12.800 Y-0.385
+X12.850 Y-0.390
+X12.900 Y-0.395
+X12.950 Y-0.400
+X13.000 Y-0.405
+X13.050 Y-0.409
+X13.100 Y-0.414
+X13.150 Y-0.418
+X13.200 Y-0.422
+X13.250 Y-0.426
+X13.300 Y-0.430
+X13.350 Y-0.434
+X13.400 Y-0.438
+X13.450 Y-0.442
+X13.500 Y-0.446
+X13.550 Y-0.449
+X13.600 Y-0.452
+X13.650 Y-0.456
+X13.700 Y-0.459
+X13.750 Y-0.462
+X13.800 Y-0.465
+X13.850 Y-0.468
+X13.900 Y-0.470
+X13.950 Y-0.473
+X14.000 Y-0.476
+X14.050 Y-0.478
+X14.100 Y-0.480
+X14.150 Y-0.482
+X14.200 Y-0.484
+X14.250 Y-0.486
+X14.300 Y-0.488
+X14.350 Y-0.490
+X14.400 Y-0.491
+X14.450 Y-0.493
+X14.500 Y-0.494
+X14.550 Y-0.495
+X14.600 Y-0.496
+X14.650 Y-0.497
+X14.700 Y-0.498
+X14.750 Y-0.498
+X14.800 Y-0.499
+X14.850 Y-0.499
+X14.900 Y-0.500
+X14.950 Y-0.500
+X15.000 Y-0.500
+X15.050 Y-0.500
+X15.100 Y-0.500
+X15.150 Y-0.499
+X15.200 Y-0.499
+X15.250 Y-0.498
+X15.300 Y-0.498
+X15.350 Y-0.497
+X15.400 Y-0.496
+X15.450 Y-0.495
+X15.500 Y-0.494
+X15.550 Y-0.493
+X15.600 Y-0.491
+X15.650 Y-0.490
+X15.700 Y-0.488
+X15.750 Y-0.486
+X15.800 Y-0.484
+X15.850 Y-0.482
+X15.900 Y-0.480
+X15.950 Y-0.478
+X16.000 Y-0.476
+X16.050 Y-0.473
+X16.100 Y-0.470
+X16.150 Y-0.468
+X16.200 Y-0.465
+X16.250 Y-0.462
+X16.300 Y-0.459
+X16.350 Y-0.456
+X16.400 Y-0.452
+X16.450 Y-0.449
+X16.500 Y-0.446
+X16.550 Y-0.442
+X16.600 Y-0.438
+X16.650 Y-0.434
+X16.700 Y-0.430
+X16.750 Y-0.426
+X16.800 Y-0.422
+X16.850 Y-0.418
+X16.900 Y-0.414
+X16.950 Y-0.409
+X17.000 Y-0.405
+X17.050 Y-0.400
+X17.100 Y-0.395
+X17.150 Y-0.390
+X17.200 Y-0.385
+X17.250 Y-0.380
+X17.300 Y-0.375
+X17.350 Y-0.370
+X17.400 Y-0.364
+X17.450 Y-0.359
+X17.500 Y-0.354
+X17.550 Y-0.348
+X17.600 Y-0.342
+X17.650 Y-0.337
+X17.700 Y-0.331
+X17.750 Y-0.325
+X17.800 Y-0.319
+X17.850 Y-0.313
+X17.900 Y-0.306
+X17.950 Y-0.300
+X18.000 Y-0.294
+X18.050 Y-0.288
+X18.100 Y-0.281
+X18.150 Y-0.275
+X18.200 Y-0.268
+X18.250 Y-0.261
+X18.300 Y-0.255
+X18.350 Y-0.248
+X18.400 Y-0.241
+X18.450 Y-0.234
+X18.500 Y-0.227
+X18.550 Y-0.220
+X18.600 Y-0.213
+X18.650 Y-0.206
+X18.700 Y-0.199
+X18.750 Y-0.191
+X18.800 Y-0.184
+X18.850 Y-0.177
+X18.900 Y-0.169
+X18.950 Y-0.162
+X19.000 Y-0.155
+X19.050 Y-0.147
+X19.100 Y-0.139
+X19.150 Y-0.132
+X19.200 Y-0.124
+X19.250 Y-0.117
+X19.300 Y-0.109
+X19.350 Y-0.101
+X19.400 Y-0.094
+X19.450 Y-0.086
+X19.500 Y-0.078
+X19.550 Y-0.070
+X19.600 Y-0.063
+X19.650 Y-0.055
+X19.700 Y-0.047
+X19.750 Y-0.039
+X19.800 Y-0.031
+X19.850 Y-0.024
+X19.900 Y-0.016
+X19.950 Y-0.008
+X20.000 Y-0.000
+X20.050 Y0.008
+X20.100 Y0.016
+X20.150 Y0.024
+X20.200 Y0.031
+X20.250 Y0.039
+X20.300 Y0.047
+X20.350 Y0.055
+X20.400 Y0.063
+X20.450 Y0.070
+X20.500 Y0.078
+X20.550 Y0.086
+X20.600 Y0.094
+X20.650 Y0.101
+X20.700 Y0.109
+X20.750 Y0.117
+X20.800 Y0.124
+X20.850 Y0.132
+X20.900 Y0.139
+X20.950 Y0.147
+X21.000 Y0.155
+X21.050 Y0.162
+X21.100 Y0.169
+X21.150 Y0.177
+X21.200 Y0.184
+X21.250 Y0.191
+X21.300 Y0.199
+X21.350 Y0.206
+X21.400 Y0.213
+X21.450 Y0.220
+X21.500 Y0.227
+X21.550 Y0.234
+X21.600 Y0.241
+X21.650 Y0.248
+X21.700 Y0.255
+X21.750 Y0.261
+X21.800 Y0.268
+X21.850 Y0.275
+X21.900 Y0.281
+X21.950 Y0.288
+X22.000 Y0.294
+X22.050 Y0.300
+X22.100 Y0.306
+X22.150 Y0.313
+X22.200 Y0.319
+X22.250 Y0.325
+X22.300 Y0.331
+X22.350 Y0.337
+X22.400 Y0.342
+X22.450 Y0.348
+X22.500 Y0.354
+X22.550 Y0.359
+X22.600 Y0.364
+X22.650 Y0.370
+X22.700 Y0.375
+X22.750 Y0.380
+X22.800 Y0.385
+X22.850 Y0.390
+X22.900 Y0.395
+X22.950 Y0.400
+X23.000 Y0.405
+X23.050 Y0.409
+X23.100 Y0.414
+X23.150 Y0.418
+X23.200 Y0.422
+X23.250 Y0.426
+X23.300 Y0.430
+X23.350 Y0.434
+X23.400 Y0.438
+X23.450 Y0.442
+X23.500 Y0.446
+X23.550 Y0.449
+X23.600 Y0.452
+X23.650 Y0.456
+X23.700 Y0.459
+X23.750 Y0.462
+X23.800 Y0.465
+X23.850 Y0.468
+X23.900 Y0.470
+X23.950 Y0.473
+X24.000 Y0.476
+X24.050 Y0.478
+X24.100 Y0.480
+X24.150 Y0.482
+X24.200 Y0.484
+X24.250 Y0.486
+X24.300 Y0.488
+X24.350 Y0.490
+X24.400 Y0.491
+X24.450 Y0.493
+X24.500 Y0.494
+X24.550 Y0.495
+X24.600 Y0.496
+X24.650 Y0.497
+X24.700 Y0.498
+X24.750 Y0.498
+X24.800 Y0.499
+X24.850 Y0.499
+X24.900 Y0.500
+X24.950 Y0.500
+X25.000 Y0.500
+X25.050 Y0.500
+X25.100 Y0.500
+X25.150 Y0.499
+X25.200 Y0.499
+X25.250 Y0.498
+X25.300 Y0.498
+X25.350 Y0.497
+X25.400 Y0.496
+X25.450 Y0.495
+X25.500 Y0.494
+X25.550 Y0.493
+X25.600 Y0.491
+X25.650 Y0.490
+X25.700 Y0.488
+X25.750 Y0.486
+X25.800 Y0.484
+X25.850 Y0.482
+X25.900 Y0.480
+X25.950 Y0.478
+X26.000 Y0.476
+X26.050 Y0.473
+X26.100 Y0.470
+X26.150 Y0.468
+X26.200 Y0.465
+X26.250 Y0.462
+X26.300 Y0.459
+X26.350 Y0.456
+X26.400 Y0.452
+X26.450 Y0.449
+X26.500 Y0.446
+X26.550 Y0.442
+X26.600 Y0.438
+X26.650 Y0.434
+X26.700 Y0.430
+X26.750 Y0.426
+X26.800 Y0.422
+X26.850 Y0.418
+X26.900 Y0.414
+X26.950 Y0.409
+X27.000 Y0.405
+X27.050 Y0.400
+X27.100 Y0.395
+X27.150 Y0.390
+X27.200 Y0.385
+X27.250 Y0.380
+X27.300 Y0.375
+X27.350 Y0.370
+X27.400 Y0.364
+X27.450 Y0.359
+X27.500 Y0.354
+X27.550 Y0.348
+X27.600 Y0.342
+X27.650 Y0.337
+X27.700 Y0.331
+X27.750 Y0.325
+X27.800 Y0.319
+X27.850 Y0.313
+X27.900 Y0.306
+X27.950 Y0.300
+X28.000 Y0.294
+X28.050 Y0.288
+X28.100 Y0.281
+X28.150 Y0.275
+X28.200 Y0.268
+X28.250 Y0.261
+X28.300 Y0.255
+X28.350 Y0.248
+X28.400 Y0.241
+X28.450 Y0.234
+X28.500 Y0.227
+X28.550 Y0.220
+X28.600 Y0.213
+X28.650 Y0.206
+X28.700 Y0.199
+X28.750 Y0.191
+X28.800 Y0.184
+X28.850 Y0.177
+X28.900 Y0.169
+X28.950 Y0.162
+X29.000 Y0.155
+X29.050 Y0.147
+X29.100 Y0.139
+X29.150 Y0.132
+X29.200 Y0.124
+X29.250 Y0.117
+X29.300 Y0.109
+X29.350 Y0.101
+X29.400 Y0.094
+X29.450 Y0.086
+X29.500 Y0.078
+X29.550 Y0.070
+X29.600 Y0.063
+X29.650 Y0.055
+X29.700 Y0.047
+X29.750 Y0.039
+X29.800 Y0.031
+X29.850 Y0.024
+X29.900 Y0.016
+X29.950 Y0.008
+X30.000 Y0.000
+X30.050 Y-0.008
+X30.100 Y-0.016
+X30.150 Y-0.024
+X30.200 Y-0.031
+X30.250 Y-0.039
+X30.300 Y-0.047
+X30.350 Y-0.055
+X30.400 Y-0.063
+X30.450 Y-0.070
+X30.500 Y-0.078
+X30.550 Y-0.086
+X30.600 Y-0.094
+X30.650 Y-0.101
+X30.700 Y-0.109
+X30.750 Y-0.117
+X30.800 Y-0.124
+X30.850 Y-0.132
+X30.900 Y-0.139
+X30.950 Y-0.147
+X31.000 Y-0.155
+X31.050 Y-0.162
+X31.100 Y-0.169
+X31.150 Y-0.177
+X31.200 Y-0.184
+X31.250 Y-0.191
+X31.300 Y-0.199
+X31.350 Y-0.206
+X31.400 Y-0.213
+X31.450 Y-0.220
+X31.500 Y-0.227
+X31.550 Y-0.234
+X31.600 Y-0.241
+X31.650 Y-0.248
+X31.700 Y-0.255
+X31.750 Y-0.261
+X31.800 Y-0.268
+X31.850 Y-0.275
+X31.900 Y-0.281
+X31.950 Y-0.288
+X32.000 Y-0.294
+X32.050 Y-0.300
+X32.100 Y-0.306
+X32.150 Y-0.313
+X32.200 Y-0.319
+X32.250 Y-0.325
+X32.300 Y-0.331
+X32.350 Y-0.337
+X32.400 Y-0.342
+X32.450 Y-0.348
+X32.500 Y-0.354
+X32.550 Y-0.359
+X32.600 Y-0.364
+X32.650 Y-0.370
+X32.700 Y-0.375
+X32.750 Y-0.380
+X32.800 Y-0.385
+X32.850 Y-0.390
+X32.900 Y-0.395
+X32.950 Y-0.400
+X33.000 Y-0.405
+X33.050 Y-0.409
+X33.100 Y-0.414
+X33.150 Y-0.418
+X33.200 Y-0.422
+X33.250 Y-0.426
+X33.300 Y-0.430
+X33.350 Y-0.434
+X33.400 Y-0.438
+X33.450 Y-0.442
+X33.500 Y-0.446
+X33.550 Y-0.449
+X33.600 Y-0.452
+X33.650 Y-0.456
+X33.700 Y-0.459
+X33.750 Y-0.462
+X33.800 Y-0.465
+X33.850 Y-0.468
+X33.900 Y-0.470
+X33.950 Y-0.473
+X34.000 Y-0.476
+X34.050 Y-0.478
+X34.100 Y-0.480
+X34.150 Y-0.482
+X34.200 Y-0.484
+X34.250 Y-0.486
+X34.300 Y-0.488
+X34.350 Y-0.490
+X34.400 Y-0.491
+X34.450 Y-0.493
+X34.500 Y-0.494
+X34.550 Y-0.495
+X34.600 Y-0.496
+X34.650 Y-0.497
+X34.700 Y-0.498
+X34.750 Y-0.498
+X34.800 Y-0.499
+X34.850 Y-0.499
+X34.900 Y-0.500
+X34.950 Y-0.500
+X35.000 Y-0.500
+X35.050 Y-0.500
+X35.100 Y-0.500
+X35.150 Y-0.499
+X35.200 Y-0.499
+X35.250 Y-0.498
+X35.300 Y-0.498
+X35.350 Y-0.497
+X35.400 Y-0.496
+X35.450 Y-0.495
+X35.500 Y-0.494
+X35.550 Y-0.493
+X35.600 Y-0.491
+X35.650 Y-0.490
+X35.700 Y-0.488
+X35.750 Y-0.486
+X35.800 Y-0.484
+X35.850 Y-0.482
+X35.900 Y-0.480
+X35.950 Y-0.478
+X36.000 Y-0.476
+X36.050 Y-0.473
+X36.100 Y-0.470
+X36.150 Y-0.468
+X36.200 Y-0.465
+X36.250 Y-0.462
+X36.300 Y-0.459
+X36.350 Y-0.456
+X36.400 Y-0.452
+X36.450 Y-0.449
+X36.500 Y-0.446
+X36.550 Y-0.442
+X36.600 Y-0.438
+X36.650 Y-0.434
+X36.700 Y-0.430
+X36.750 Y-0.426
+X36.800 Y-0.422
+X36.850 Y-0.418
+X36.900 Y-0.414
+X36.950 Y-0.409
+X37.000 Y-0.405
+X37.050 Y-0.400
+X37.100 Y-0.395
+X37.150 Y-0.390
+X37.200 Y-0.385
+X37.250 Y-0.380
+X37.300 Y-0.375
+X37.350 Y-0.370
+X37.400 Y-0.364
+X37.450 Y-0.359
+X37.500 Y-0.354
+X37.550 Y-0.348
+X37.600 Y-0.342
+X37.650 Y-0.337
+X37.700 Y-0.331
+X37.750 Y-0.325
+X37.800 Y-0.319
+X37.850 Y-0.313
+X37.900 Y-0.306
+X37.950 Y-0.300
+X38.000 Y-0.294
+X38.050 Y-0.288
+X38.100 Y-0.281
+X38.150 Y-0.275
+X38.200 Y-0.268
+X38.250 Y-0.261
+X38.300 Y-0.255
+X38.350 Y-0.248
+X38.400 Y-0.241
+X38.450 Y-0.234
+X38.500 Y-0.227
+X38.550 Y-0.220
+X38.600 Y-0.213
+X38.650 Y-0.206
+X38.700 Y-0.199
+X38.750 Y-0.191
+X38.800 Y-0.184
+X38.850 Y-0.177
+X38.900 Y-0.169
+X38.950 Y-0.162
+X39.000 Y-0.155
+X39.050 Y-0.147
+X39.100 Y-0.139
+X39.150 Y-0.132
+X39.200 Y-0.124
+X39.250 Y-0.117
+X39.300 Y-0.109
+X39.350 Y-0.101
+X39.400 Y-0.094
+X39.450 Y-0.086
+X39.500 Y-0.078
+X39.550 Y-0.070
+X39.600 Y-0.063
+X39.650 Y-0.055
+X39.700 Y-0.047
+X39.750 Y-0.039
+X39.800 Y-0.031
+X39.850 Y-0.024
+X39.900 Y-0.016
+X39.950 Y-0.008
+X40.000 Y-0.000
+X40.050 Y0.008
+X40.100 Y0.016
+X40.150 Y0.024
+X40.200 Y0.031
+X40.250 Y0.039
+X40.300 Y0.047
+X40.350 Y0.055
+X40.400 Y0.063
+X40.450 Y0.070
+X40.500 Y0.078
+X40.550 Y0.086
+X40.600 Y0.094
+X40.650 Y0.101
+X40.700 Y0.109
+X40.750 Y0.117
+X40.800 Y0.124
+X40.850 Y0.132
+X40.900 Y0.139
+X40.950 Y0.147
+X41.000 Y0.155
+X41.050 Y0.162
+X41.100 Y0.169
+X41.150 Y0.177
+X41.200 Y0.184
+X41.250 Y0.191
+X41.300 Y0.199
+X41.350 Y0.206
+X41.400 Y0.213
+X41.450 Y0.220
+X41.500 Y0.227
+X41.550 Y0.234
+X41.600 Y0.241
+X41.650 Y0.248
+X41.700 Y0.255
+X41.750 Y0.261
+X41.800 Y0.268
+X41.850 Y0.275
+X41.900 Y0.281
+X41.950 Y0.288
+X42.000 Y0.294
+X42.050 Y0.300
+X42.100 Y0.306
+X42.150 Y0.313
+X42.200 Y0.319
+X42.250 Y0.325
+X42.300 Y0.331
+X42.350 Y0.337
+X42.400 Y0.342
+X42.450 Y0.348
+X42.500 Y0.354
+X42.550 Y0.359
+X42.600 Y0.364
+X42.650 Y0.370
+X42.700 Y0.375
+X42.750 Y0.380
+X42.800 Y0.385
+X42.850 Y0.390
+X42.900 Y0.395
+X42.950 Y0.400
+X43.000 Y0.405
+X43.050 Y0.409
+X43.100 Y0.414
+X43.150 Y0.418
+X43.200 Y0.422
+X43.250 Y0.426
+X43.300 Y0.430
+X43.350 Y0.434
+X43.400 Y0.438
+X43.450 Y0.442
+X43.500 Y0.446
+X43.550 Y0.449
+X43.600 Y0.452
+X43.650 Y0.456
+X43.700 Y0.459
+X43.750 Y0.462
+X43.800 Y0.465
+X43.850 Y0.468
+X43.900 Y0.470
+X43.950 Y0.473
+X44.000 Y0.476
+X44.050 Y0.478
+X44.100 Y0.480
+X44.150 Y0.482
+X44.200 Y0.484
+X44.250 Y0.486
+X44.300 Y0.488
+X44.350 Y0.490
+X44.400 Y0.491
+X44.450 Y0.493
+X44.500 Y0.494
+X44.550 Y0.495
+X44.600 Y0.496
+X44.650 Y0.497
+X44.700 Y0.498
+X44.750 Y0.498
+X44.800 Y0.499
+X44.850 Y0.499
+X44.900 Y0.500
+X44.950 Y0.500
+X45.000 Y0.500
+X45.050 Y0.500
+X45.100 Y0.500
+X45.150 Y0.499
+X45.200 Y0.499
+X45.250 Y0.498
+X45.300 Y0.498
+X45.350 Y0.497
+X45.400 Y0.496
+X45.450 Y0.495
+X45.500 Y0.494
+X45.550 Y0.493
+X45.600 Y0.491
+X45.650 Y0.490
+X45.700 Y0.488
+X45.750 Y0.486
+X45.800 Y0.484
+X45.850 Y0.482
+X45.900 Y0.480
+X45.950 Y0.478
+X46.000 Y0.476
+X46.050 Y0.473
+X46.100 Y0.470
+X46.150 Y0.468
+X46.200 Y0.465
+X46.250 Y0.462
+X46.300 Y0.459
+X46.350 Y0.456
+X46.400 Y0.452
+X46.450 Y0.449
+X46.500 Y0.446
+X46.550 Y0.442
+X46.600 Y0.438
+X46.650 Y0.434
+X46.700 Y0.430
+X46.750 Y0.426
+X46.800 Y0.422
+X46.850 Y0.418
+X46.900 Y0.414
+X46.950 Y0.409
+X47.000 Y0.405
+X47.050 Y0.400
+X47.100 Y0.395
+X47.150 Y0.390
+X47.200 Y0.385
+X47.250 Y0.380
+X47.300 Y0.375
+X47.350 Y0.370
+X47.400 Y0.364
+X47.450 Y0.359
+X47.500 Y0.354
+X47.550 Y0.348
+X47.600 Y0.342
+X47.650 Y0.337
+X47.700 Y0.331
+X47.750 Y0.325
+X47.800 Y0.319
+X47.850 Y0.313
+X47.900 Y0.306
+X47.950 Y0.300
+X48.000 Y0.294
+X48.050 Y0.288
+X48.100 Y0.281
+X48.150 Y0.275
+X48.200 Y0.268
+X48.250 Y0.261
+X48.300 Y0.255
+X48.350 Y0.248
+X48.400 Y0.241
+X48.450 Y0.234
+X48.500 Y0.227
+X48.550 Y0.220
+X48.600 Y0.213
+X48.650 Y0.206
+X48.700 Y0.199
+X48.750 Y0.191
+X48.800 Y0.184
+X48.850 Y0.177
+X48.900 Y0.169
+X48.950 Y0.162
+X49.000 Y0.155
+X49.050 Y0.147
+X49.100 Y0.139
+X49.150 Y0.132
+X49.200 Y0.124
+X49.250 Y0.117
+X49.300 Y0.109
+X49.350 Y0.101
+X49.400 Y0.094
+X49.450 Y0.086
+X49.500 Y0.078
+X49.550 Y0.070
+X49.600 Y0.063
+X49.650 Y0.055
+X49.700 Y0.047
+X49.750 Y0.039
+X49.800 Y0.031
+X49.850 Y0.024
+X49.900 Y0.016
+X49.950 Y0.008
+X50.000 Y0.000
+X50.050 Y-0.008
+X50.100 Y-0.016
+X50.150 Y-0.024
+X50.200 Y-0.031
+X50.250 Y-0.039
+X50.300 Y-0.047
+X50.350 Y-0.055
+X50.400 Y-0.063
+X50.450 Y-0.070
+X50.500 Y-0.078
+X50.550 Y-0.086
+X50.600 Y-0.094
+X50.650 Y-0.101
+X50.700 Y-0.109
+X50.750 Y-0.117
+X50.800 Y-0.124
+X50.850 Y-0.132
+X50.900 Y-0.139
+X50.950 Y-0.147
+X51.000 Y-0.155
+X51.050 Y-0.162
+X51.100 Y-0.169
+X51.150 Y-0.177
+X51.200 Y-0.184
+X51.250 Y-0.191
+X51.300 Y-0.199
+X51.350 Y-0.206
+X51.400 Y-0.213
+X51.450 Y-0.220
+X51.500 Y-0.227
+X51.550 Y-0.234
+X51.600 Y-0.241
+X51.650 Y-0.248
+X51.700 Y-0.255
+X51.750 Y-0.261
+X51.800 Y-0.268
+X51.850 Y-0.275
+X51.900 Y-0.281
+X51.950 Y-0.288
+X52.000 Y-0.294
+X52.050 Y-0.300
+X52.100 Y-0.306
+X52.150 Y-0.313
+X52.200 Y-0.319
+X52.250 Y-0.325
+X52.300 Y-0.331
+X52.350 Y-0.337
+X52.400 Y-0.342
+X52.450 Y-0.348
+X52.500 Y-0.354
+X52.550 Y-0.359
+X52.600 Y-0.364
+X52.650 Y-0.370
+X52.700 Y-0.375
+X52.750 Y-0.380
+X52.800 Y-0.385
+X52.850 Y-0.390
+X52.900 Y-0.395
+X52.950 Y-0.400
+X53.000 Y-0.405
+X53.050 Y-0.409
+X53.100 Y-0.414
+X53.150 Y-0.418
+X53.200 Y-0.422
+X53.250 Y-0.426
+X53.300 Y-0.430
+X53.350 Y-0.434
+X53.400 Y-0.438
+X53.450 Y-0.442
+X53.500 Y-0.446
+X53.550 Y-0.449
+X53.600 Y-0.452
+X53.650 Y-0.456
+X53.700 Y-0.459
+X53.750 Y-0.462
+X53.800 Y-0.465
+X53.850 Y-0.468
+X53.900 Y-0.470
+X53.950 Y-0.473
+X54.000 Y-0.476
+X54.050 Y-0.478
+X54.100 Y-0.480
+X54.150 Y-0.482
+X54.200 Y-0.484
+X54.250 Y-0.486
+X54.300 Y-0.488
+X54.350 Y-0.490
+X54.400 Y-0.491
+X54.450 Y-0.493
+X54.500 Y-0.494
+X54.550 Y-0.495
+X54.600 Y-0.496
+X54.650 Y-0.497
+X54.700 Y-0.498
+X54.750 Y-0.498
+X54.800 Y-0.499
+X54.850 Y-0.499
+X54.900 Y-0.500
+X54.950 Y-0.500
+X55.000 Y-0.500
+X55.050 Y-0.500
+X55.100 Y-0.500
+X55.150 Y-0.499
+X55.200 Y-0.499
+X55.250 Y-0.498
+X55.300 Y-0.498
+X55.350 Y-0.497
+X55.400 Y-0.496
+X55.450 Y-0.495
+X55.500 Y-0.494
+X55.550 Y-0.493
+X55.600 Y-0.491
+X55.650 Y-0.490
+X55.700 Y-0.488
+X55.750 Y-0.486
+X55.800 Y-0.484
+X55.850 Y-0.482
+X55.900 Y-0.480
+X55.950 Y-0.478
+X56.000 Y-0.476
+X56.050 Y-0.473
+X56.100 Y-0.470
+X56.150 Y-0.468
+X56.200 Y-0.465
+X56.250 Y-0.462
+X56.300 Y-0.459
+X56.350 Y-0.456
+X56.400 Y-0.452
+X56.450 Y-0.449
+X56.500 Y-0.446
+X56.550 Y-0.442
+X56.600 Y-0.438
+X56.650 Y-0.434
+X56.700 Y-0.430
+X56.750 Y-0.426
+X56.800 Y-0.422
+X56.850 Y-0.418
+X56.900 Y-0.414
+X56.950 Y-0.409
+X57.000 Y-0.405
+X57.050 Y-0.400
+X57.100 Y-0.395
+X57.150 Y-0.390
+X57.200 Y-0.385
+X57.250 Y-0.380
+X57.300 Y-0.375
+X57.350 Y-0.370
+X57.400 Y-0.364
+X57.450 Y-0.359
+X57.500 Y-0.354
+X57.550 Y-0.348
+X57.600 Y-0.342
+X57.650 Y-0.337
+X57.700 Y-0.331
+X57.750 Y-0.325
+X57.800 Y-0.319
+X57.850 Y-0.313
+X57.900 Y-0.306
+X57.950 Y-0.300
+X58.000 Y-0.294
+X58.050 Y-0.288
+X58.100 Y-0.281
+X58.150 Y-0.275
+X58.200 Y-0.268
+X58.250 Y-0.261
+X58.300 Y-0.255
+X58.350 Y-0.248
+X58.400 Y-0.241
+X58.450 Y-0.234
+X58.500 Y-0.227
+X58.550 Y-0.220
+X58.600 Y-0.213
+X58.650 Y-0.206
+X58.700 Y-0.199
+X58.750 Y-0.191
+X58.800 Y-0.184
+X58.850 Y-0.177
+X58.900 Y-0.169
+X58.950 Y-0.162
+X59.000 Y-0.155
+X59.050 Y-0.147
+X59.100 Y-0.139
+X59.150 Y-0.132
+X59.200 Y-0.124
+X59.250 Y-0.117
+X59.300 Y-0.109
+X59.350 Y-0.101
+X59.400 Y-0.094
+X59.450 Y-0.086
+X59.500 Y-0.078
+X59.550 Y-0.070
+X59.600 Y-0.063
+X59.650 Y-0.055
+X59.700 Y-0.047
+X59.750 Y-0.039
+X59.800 Y-0.031
+X59.850 Y-0.024
+X59.900 Y-0.016
+X59.950 Y-0.008
+X60.000 Y-0.000
+X60.050 Y0.008
+X60.100 Y0.016
+X60.150 Y0.024
+X60.200 Y0.031
+X60.250 Y0.039
+X60.300 Y0.047
+X60.350 Y0.055
+X60.400 Y0.063
+X60.450 Y0.070
+X60.500 Y0.078
+X60.550 Y0.086
+X60.600 Y0.094
+X60.650 Y0.101
+X60.700 Y0.109
+X60.750 Y0.117
+X60.800 Y0.124
+X60.850 Y0.132
+X60.900 Y0.139
+X60.950 Y0.147
+X61.000 Y0.155
+X61.050 Y0.162
+X61.100 Y0.169
+X61.150 Y0.177
+X61.200 Y0.184
+X61.250 Y0.191
+X61.300 Y0.199
+X61.350 Y0.206
+X61.400 Y0.213
+X61.450 Y0.220
+X61.500 Y0.227
+X61.550 Y0.234
+X61.600 Y0.241
+X61.650 Y0.248
+X61.700 Y0.255
+X61.750 Y0.261
+X61.800 Y0.268
+X61.850 Y0.275
+X61.900 Y0.281
+X61.950 Y0.288
+X62.000 Y0.294
+X62.050 Y0.300
+X62.100 Y0.306
+X62.150 Y0.313
+X62.200 Y0.319
+X62.250 Y0.325
+X62.300 Y0.331
+X62.350 Y0.337
+X62.400 Y0.342
+X62.450 Y0.348
+X62.500 Y0.354
+X62.550 Y0.359
+X62.600 Y0.364
+X62.650 Y0.370
+X62.700 Y0.375
+X62.750 Y0.380
+X62.800 Y0.385
+X62.850 Y0.390
+X62.900 Y0.395
+X62.950 Y0.400
+X63.000 Y0.405
+X63.050 Y0.409
+X63.100 Y0.414
+X63.150 Y0.418
+X63.200 Y0.422
+X63.250 Y0.426
+X63.300 Y0.430
+X63.350 Y0.434
+X63.400 Y0.438
+X63.450 Y0.442
+X63.500 Y0.446
+X63.550 Y0.449
+X63.600 Y0.452
+X63.650 Y0.456
+X63.700 Y0.459
+X63.750 Y0.462
+X63.800 Y0.465
+X63.850 Y0.468
+X63.900 Y0.470
+X63.950 Y0.473
+X64.000 Y0.476
+X64.050 Y0.478
+X64.100 Y0.480
+X64.150 Y0.482
+X64.200 Y0.484
+X64.250 Y0.486
+X64.300 Y0.488
+X64.350 Y0.490
+X64.400 Y0.491
+X64.450 Y0.493
+X64.500 Y0.494
+X64.550 Y0.495
+X64.600 Y0.496
+X64.650 Y0.497
+X64.700 Y0.498
+X64.750 Y0.498
+X64.800 Y0.499
+X64.850 Y0.499
+X64.900 Y0.500
+X64.950 Y0.500
+X65.000 Y0.500
+X65.050 Y0.500
+X65.100 Y0.500
+X65.150 Y0.499
+X65.200 Y0.499
+X65.250 Y0.498
+X65.300 Y0.498
+X65.350 Y0.497
+X65.400 Y0.496
+X65.450 Y0.495
+X65.500 Y0.494
+X65.550 Y0.493
+X65.600 Y0.491
+X65.650 Y0.490
+X65.700 Y0.488
+X65.750 Y0.486
+X65.800 Y0.484
+X65.850 Y0.482
+X65.900 Y0.480
+X65.950 Y0.478
+X66.000 Y0.476
+X66.050 Y0.473
+X66.100 Y0.470
+X66.150 Y0.468
+X66.200 Y0.465
+X66.250 Y0.462
+X66.300 Y0.459
+X66.350 Y0.456
+X66.400 Y0.452
+X66.450 Y0.449
+X66.500 Y0.446
+X66.550 Y0.442
+X66.600 Y0.438
+X66.650 Y0.434
+X66.700 Y0.430
+X66.750 Y0.426
+X66.800 Y0.422
+X66.850 Y0.418
+X66.900 Y0.414
+X66.950 Y0.409
+X67.000 Y0.405
+X67.050 Y0.400
+X67.100 Y0.395
+X67.150 Y0.390
+X67.200 Y0.385
+X67.250 Y0.380
+X67.300 Y0.375
+X67.350 Y0.370
+X67.400 Y0.364
+X67.450 Y0.359
+X67.500 Y0.354
+X67.550 Y0.348
+X67.600 Y0.342
+X67.650 Y0.337
+X67.700 Y0.331
+X67.750 Y0.325
+X67.800 Y0.319
+X67.850 Y0.313
+X67.900 Y0.306
+X67.950 Y0.300
+X68.000 Y0.294
+X68.050 Y0.288
+X68.100 Y0.281
+X68.150 Y0.275
+X68.200 Y0.268
+X68.250 Y0.261
+X68.300 Y0.255
+X68.350 Y0.248
+X68.400 Y0.241
+X68.450 Y0.234
+X68.500 Y0.227
+X68.550 Y0.220
+X68.600 Y0.213
+X68.650 Y0.206
+X68.700 Y0.199
+X68.750 Y0.191
+X68.800 Y0.184
+X68.850 Y0.177
+X68.900 Y0.169
+X68.950 Y0.162
+X69.000 Y0.155
+X69.050 Y0.147
+X69.100 Y0.139
+X69.150 Y0.132
+X69.200 Y0.124
+X69.250 Y0.117
+X69.300 Y0.109
+X69.350 Y0.101
+X69.400 Y0.094
+X69.450 Y0.086
+X69.500 Y0.078
+X69.550 Y0.070
+X69.600 Y0.063
+X69.650 Y0.055
+X69.700 Y0.047
+X69.750 Y0.039
+X69.800 Y0.031
+X69.850 Y0.024
+X69.900 Y0.016
+X69.950 Y0.008
+X70.000 Y0.000
+X70.050 Y-0.008
+X70.100 Y-0.016
+X70.150 Y-0.024
+X70.200 Y-0.031
+X70.250 Y-0.039
+X70.300 Y-0.047
+X70.350 Y-0.055
+X70.400 Y-0.063
+X70.450 Y-0.070
+X70.500 Y-0.078
+X70.550 Y-0.086
+X70.600 Y-0.094
+X70.650 Y-0.101
+X70.700 Y-0.109
+X70.750 Y-0.117
+X70.800 Y-0.124
+X70.850 Y-0.132
+X70.900 Y-0.139
+X70.950 Y-0.147
+X71.000 Y-0.155
+X71.050 Y-0.162
+X71.100 Y-0.169
+X71.150 Y-0.177
+X71.200 Y-0.184
+X71.250 Y-0.191
+X71.300 Y-0.199
+X71.350 Y-0.206
+X71.400 Y-0.213
+X71.450 Y-0.220
+X71.500 Y-0.227
+X71.550 Y-0.234
+X71.600 Y-0.241
+X71.650 Y-0.248
+X71.700 Y-0.255
+X71.750 Y-0.261
+X71.800 Y-0.268
+X71.850 Y-0.275
+X71.900 Y-0.281
+X71.950 Y-0.288
+X72.000 Y-0.294
+X72.050 Y-0.300
+X72.100 Y-0.306
+X72.150 Y-0.313
+X72.200 Y-0.319
+X72.250 Y-0.325
+X72.300 Y-0.331
+X72.350 Y-0.337
+X72.400 Y-0.342
+X72.450 Y-0.348
+X72.500 Y-0.354
+X72.550 Y-0.359
+X72.600 Y-0.364
+X72.650 Y-0.370
+X72.700 Y-0.375
+X72.750 Y-0.380
+X72.800 Y-0.385
+X72.850 Y-0.390
+X72.900 Y-0.395
+X72.950 Y-0.400
+X73.000 Y-0.405
+X73.050 Y-0.409
+X73.100 Y-0.414
+X73.150 Y-0.418
+X73.200 Y-0.422
+X73.250 Y-0.426
+X73.300 Y-0.430
+X73.350 Y-0.434
+X73.400 Y-0.438
+X73.450 Y-0.442
+X73.500 Y-0.446
+X73.550 Y-0.449
+X73.600 Y-0.452
+X73.650 Y-0.456
+X73.700 Y-0.459
+X73.750 Y-0.462
+X73.800 Y-0.465
+X73.850 Y-0.468
+X73.900 Y-0.470
+X73.950 Y-0.473
+X74.000 Y-0.476
+X74.050 Y-0.478
+X74.100 Y-0.480
+X74.150 Y-0.482
+X74.200 Y-0.484
+X74.250 Y-0.486
+X74.300 Y-0.488
+X74.350 Y-0.490
+X74.400 Y-0.491
+X74.450 Y-0.493
+X74.500 Y-0.494
+X74.550 Y-0.495
+X74.600 Y-0.496
+X74.650 Y-0.497
+X74.700 Y-0.498
+X74.750 Y-0.498
+X74.800 Y-0.499
+X74.850 Y-0.499
+X74.900 Y-0.500
+X74.950 Y-0.500
+X75.000 Y-0.500
+X75.050 Y-0.500
+X75.100 Y-0.500
+X75.150 Y-0.499
+X75.200 Y-0.499
+X75.250 Y-0.498
+X75.300 Y-0.498
+X75.350 Y-0.497
+X75.400 Y-0.496
+X75.450 Y-0.495
+X75.500 Y-0.494
+X75.550 Y-0.493
+X75.600 Y-0.491
+X75.650 Y-0.490
+X75.700 Y-0.488
+X75.750 Y-0.486
+X75.800 Y-0.484
+X75.850 Y-0.482
+X75.900 Y-0.480
+X75.950 Y-0.478
+X76.000 Y-0.476
+X76.050 Y-0.473
+X76.100 Y-0.470
+X76.150 Y-0.468
+X76.200 Y-0.465
+X76.250 Y-0.462
+X76.300 Y-0.459
+X76.350 Y-0.456
+X76.400 Y-0.452
+X76.450 Y-0.449
+X76.500 Y-0.446
+X76.550 Y-0.442
+X76.600 Y-0.438
+X76.650 Y-0.434
+X76.700 Y-0.430
+X76.750 Y-0.426
+X76.800 Y-0.422
+X76.850 Y-0.418
+X76.900 Y-0.414
+X76.950 Y-0.409
+X77.000 Y-0.405
+X77.050 Y-0.400
+X77.100 Y-0.395
+X77.150 Y-0.390
+X77.200 Y-0.385
+X77.250 Y-0.380
+X77.300 Y-0.375
+X77.350 Y-0.370
+X77.400 Y-0.364
+X77.450 Y-0.359
+X77.500 Y-0.354
+X77.550 Y-0.348
+X77.600 Y-0.342
+X77.650 Y-0.337
+X77.700 Y-0.331
+X77.750 Y-0.325
+X77.800 Y-0.319
+X77.850 Y-0.313
+X77.900 Y-0.306
+X77.950 Y-0.300
+X78.000 Y-0.294
+X78.050 Y-0.288
+X78.100 Y-0.281
+X78.150 Y-0.275
+X78.200 Y-0.268
+X78.250 Y-0.261
+X78.300 Y-0.255
+X78.350 Y-0.248
+X78.400 Y-0.241
+X78.450 Y-0.234
+X78.500 Y-0.227
+X78.550 Y-0.220
+X78.600 Y-0.213
+X78.650 Y-0.206
+X78.700 Y-0.199
+X78.750 Y-0.191
+X78.800 Y-0.184
+X78.850 Y-0.177
+X78.900 Y-0.169
+X78.950 Y-0.162
+X79.000 Y-0.155
+X79.050 Y-0.147
+X79.100 Y-0.139
+X79.150 Y-0.132
+X79.200 Y-0.124
+X79.250 Y-0.117
+X79.300 Y-0.109
+X79.350 Y-0.101
+X79.400 Y-0.094
+X79.450 Y-0.086
+X79.500 Y-0.078
+X79.550 Y-0.070
+X79.600 Y-0.063
+X79.650 Y-0.055
+X79.700 Y-0.047
+X79.750 Y-0.039
+X79.800 Y-0.031
+X79.850 Y-0.024
+X79.900 Y-0.016
+X79.950 Y-0.008
+X80.000 Y-0.000
+G0 X0 Y0
+M2
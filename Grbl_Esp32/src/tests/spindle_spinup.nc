@@ -0,0 +1,15 @@
+$Spindle/Delay/SpinUp=2
+$Spindle/Delay/SpinDown=1
+G21
+G90
+M3 S10000 ; spin up, the moves are planned meanwhile
+G1 X20 F600
+X40
+M5 ; stops after the moves, the return waits for the spin down
+G0 X0
+M3 S12000
+G4 P0.5 ; the dwell starts once the spindle is up to speed
+M5
+G4 P0
+M3 S8000
+$J=G91 X5 F600 ; the jog waits for the spin up too
@@ -0,0 +1,32 @@
+; Segment buffer underruns for $MS. check.sh runs this with -l 100000, which keeps the segment
+; prep waiting for 100 ms after each line, longer than the queued 10 ms segments last. A slow
+; 2 s move, then short moves behind it: the segment buffer runs dry while the planner still
+; holds blocks.
+$MS=RST
+G21 G90 G17
+G0 X0 Y0
+G1 F300
+X10
+X10.1
+X10.2
+X10.3
+X10.4
+X10.5
+X10.6
+X10.7
+X10.8
+X10.9
+X11.0
+X11.1
+X11.2
+X11.3
+X11.4
+X11.5
+X11.6
+X11.7
+X11.8
+X11.9
+X12.0
+G4 P0
+$MS
+M2
@@ -0,0 +1,206 @@
+/*
+  ModbusTest.cpp - checks the Modbus RTU framing of the VFD spindles
+
+  Spindles/Modbus.cpp is linked on its own against a scripted RS485 line:
+  the fake Uart below hands out bytes at the ticks a VFD would send them,
+  and waiting for them moves a fake tick clock, so read_frame() can be
+  timed exactly without a real port. The table CRC is checked against the
+  bitwise CRC it replaced.
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "src/Spindles/Modbus.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Spindles;
+
+// ---------------------------------------------------------------------------
+// The line. Each byte arrives at its tick; nothing happens in between.
+
+struct Arrival {
+    TickType_t tick;
+    uint8_t    data;
+};
+
+static TickType_t           now;
+static std::vector<Arrival> line;
+static size_t               next_byte;
+
+TickType_t xTaskGetTickCount() {
+    return now;
+}
+
+static void script(TickType_t start, TickType_t spacing, const std::vector<uint8_t>& bytes) {
+    for (uint8_t b : bytes) {
+        line.push_back({ start, b });
+        start += spacing;
+    }
+}
+
+static void reset_line() {
+    now       = 0;
+    next_byte = 0;
+    line.clear();
+}
+
+Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1), _rx_events(false), _event_queue(NULL) {}
+
+int Uart::available() {
+    int n = 0;
+    for (size_t i = next_byte; i < line.size() && line[i].tick <= now; i++) {
+        n++;
+    }
+    return n;
+}
+
+// Sleeps until the next byte arrives or the timeout runs out
+bool Uart::waitForRx(TickType_t timeout) {
+    if (next_byte < line.size() && line[next_byte].tick <= now + timeout) {
+        if (line[next_byte].tick > now) {
+            now = line[next_byte].tick;
+        }
+        return true;
+    }
+    now += timeout;
+    return false;
+}
+
+size_t Uart::readBytes(char* buffer, size_t length, TickType_t timeout) {
+    size_t n = 0;
+    while (n < length && available() > 0) {
+        buffer[n++] = line[next_byte++].data;
+    }
+    return n;
+}
+
+size_t Uart::readBytes(char* buffer, size_t length) {
+    return readBytes(buffer, length, 0);
+}
+
+int Uart::read() {
+    return available() > 0 ? line[next_byte++].data : -1;
+}
+
+int Uart::peek() {
+    return available() > 0 ? line[next_byte].data : -1;
+}
+
+size_t Uart::write(uint8_t data) {
+    return 1;
+}
+
+size_t Uart::write(const uint8_t* buffer, size_t length) {
+    return length;
+}
+
+static Uart rs485(2);
+
+// ---------------------------------------------------------------------------
+// Checks
+
+static int failures;
+
+static void check(bool ok, const char* name) {
+    printf("%s%s\n", ok ? "ok      " : "FAILED  ", name);
+    if (!ok) {
+        failures++;
+    }
+}
+
+// The bit at a time CRC the table replaced
+static uint16_t bitwise_crc16(const uint8_t* buf, int msg_len) {
+    uint16_t crc = 0xFFFF;
+    for (int pos = 0; pos < msg_len; pos++) {
+        crc ^= buf[pos];
+        for (int i = 8; i != 0; i--) {
+            if ((crc & 0x0001) != 0) {
+                crc >>= 1;
+                crc ^= 0xA001;
+            } else {
+                crc >>= 1;
+            }
+        }
+    }
+    return crc;
+}
+
+static void check_crc() {
+    // A read of 10 holding registers from slave 1, as sent on the wire: 01 03 00 00 00 0A C5 CD
+    const uint8_t request[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x0A };
+    bool          ok        = Modbus::crc16(request, sizeof(request)) == 0xCDC5;
+
+    uint8_t buf[256];
+    srand(1);
+    for (int n = 0; n < 2000 && ok; n++) {
+        int length = n % (sizeof(buf) + 1);
+        for (int i = 0; i < length; i++) {
+            buf[i] = rand();
+        }
+        ok = Modbus::crc16(buf, length) == bitwise_crc16(buf, length);
+    }
+    check(ok, "vfd modbus crc (table against bitwise)");
+}
+
+// Frames at 9600 baud on a 1 ms tick: about one byte per tick and a gap of 5 ticks
+const TickType_t timeout = 1000;
+const TickType_t gap     = 5;
+
+static void check_frames() {
+    uint8_t  buffer[16];
+    uint16_t n;
+
+    // A complete answer ends with its last byte, without waiting out the gap
+    reset_line();
+    script(20, 1, { 0x01, 0x03, 0x02, 0x0B, 0xB8, 0xBF, 0x06 });
+    n = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    check(n == 7 && now == 26 && buffer[0] == 0x01 && buffer[6] == 0x06, "vfd modbus frame (complete answer)");
+
+    // An exception answer is shorter than expected and ends at the gap after it
+    reset_line();
+    script(20, 1, { 0x01, 0x83, 0x02, 0xC0, 0xF1 });
+    n = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    check(n == 5 && now == 24 + gap && buffer[1] == 0x83 && Modbus::crc16(buffer, 3) == (buffer[3] | buffer[4] << 8),
+          "vfd modbus frame (exception answer ends at the gap)");
+
+    // Pauses shorter than the gap are part of the same frame
+    reset_line();
+    script(20, 1, { 0x01, 0x03, 0x02 });
+    script(20 + 2 + gap - 1, 1, { 0x0B, 0xB8, 0xBF, 0x06 });
+    n = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    check(n == 7, "vfd modbus frame (pause within the gap)");
+
+    // A silence of the gap ends the frame; what follows is left for the next read
+    reset_line();
+    script(20, 1, { 0x01, 0x83, 0x02 });
+    script(22 + gap + 1, 1, { 0xC0, 0xF1 });
+    n          = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    bool ended = n == 3 && now == 22 + gap;
+    n          = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    check(ended && n == 2 && buffer[0] == 0xC0, "vfd modbus frame (silence ends the frame)");
+
+    // No answer at all waits for the whole timeout
+    reset_line();
+    n = Modbus::read_frame(rs485, buffer, 7, timeout, gap);
+    check(n == 0 && now == timeout, "vfd modbus frame (no answer times out)");
+}
+
+int main() {
+    check_crc();
+    check_frames();
+    return failures ? 1 : 0;
+}
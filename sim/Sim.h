@@ -0,0 +1,78 @@
+#pragma once
+
+/*
+  Sim.h - interface between the host simulator and the shimmed platform
+
+  The simulator runs the firmware main loop, the segment preparation and the
+  stepper ISR on a single host thread. Simulated time is kept in step timer
+  ticks (fStepperTimer) and only advances when the virtual step timer fires or
+  when the firmware waits (delay(), esp_timer_get_time() polling).
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdint>
+#include <cstdio>
+
+namespace Sim {
+    struct Stats {
+        uint64_t lines;         // G-code lines read from the input file
+        uint64_t errors;        // Lines that were answered with error:
+        uint64_t blocks;        // Blocks accepted by plan_buffer_line()
+        uint64_t segments;      // Segments loaded by the stepper ISR
+        uint64_t isr_ticks;     // Stepper ISR invocations
+        uint64_t step_events;   // ISR ticks that raised at least one step pin
+        uint64_t dir_changes;   // Direction pin changes
+        uint64_t rpm_updates;   // spindle->set_rpm() calls from the ISR
+        uint64_t power_updates;  // spindle->set_power_level() calls from the ISR
+        uint64_t prep_calls;    // st_prep_buffer() calls
+        double   parse_ns;      // Host time in gc_execute_line() excluding planner, prep and ISR
+        double   plan_ns;       // Host time in plan_buffer_line()
+        double   prep_ns;       // Host time in st_prep_buffer()
+        double   prep_max_ns;   // Worst single st_prep_buffer() call
+        double   isr_ns;        // Host time in the stepper ISR
+        double   wall_ns;       // Host time for the whole run
+        uint64_t trace_hash;    // FNV-1a hash of (time, step bits, dir bits) for every step event
+        int64_t  steps[8];      // Signed step count seen at the motor layer, per axis
+        double   path_error;    // Largest distance of the tool from the programmed path (-g)
+    };
+
+    extern Stats stats;
+    extern FILE* trace;       // Optional CSV of every step event
+    extern bool  rmt_bursts;  // Let the stepper ISR send RMT bursts (-b)
+
+    // Simulated time in step timer ticks
+    uint64_t now();
+
+    // Advance simulated time, servicing the step timer on the way
+    void advance(uint64_t ticks);
+
+    // Service the step timer until the ISR loads a new segment or goes idle.
+    // Called after every segment preparation so that the ISR drains exactly
+    // what the main loop produced, as it would on the real machine.
+    void run_until_next_segment();
+
+    bool step_timer_running();
+
+    // Host clock for the profiling counters
+    double host_ns();
+
+    // Input file fed to the serial client
+    void set_input(FILE* in, bool echo, bool terminal);
+    void poll_input();
+    bool input_done();
+
+    // Runs the file given with -d or -c as an SD card job
+    void start_sd_job();
+}
@@ -0,0 +1,414 @@
+/*
+  SimPlatform.cpp - Arduino, FreeRTOS and ESP-IDF services for the host simulator
+
+  Everything here is deterministic: the only clock the firmware sees is the
+  simulated one, so two runs of the same file produce identical step traces.
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Sim.h"
+
+#include <Arduino.h>
+#include <driver/timer.h>
+#include <nvs.h>
+#include <WiFi.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "src/Stepper.h"
+
+// ---------------------------------------------------------------------------
+// Simulated time and the virtual step timer
+
+namespace Sim {
+    static uint64_t sim_ticks  = 0;  // Simulated time in fStepperTimer ticks
+    static uint64_t poll_ticks = 0;  // Extra time accumulated by esp_timer_get_time() polling
+
+    struct StepTimer {
+        void (*isr)(void*) = nullptr;
+        bool     running   = false;
+        uint64_t alarm     = 0;  // Alarm value, i.e. the ISR period in ticks
+        uint64_t next_fire = 0;  // Simulated time of the next ISR
+        uint64_t loads     = 0;  // Number of alarm writes, one per segment loaded by the ISR
+    };
+    static StepTimer step_timer;
+
+    uint64_t now() { return sim_ticks + poll_ticks; }
+
+    bool step_timer_running() { return step_timer.running; }
+
+    static uint64_t period() { return step_timer.alarm ? step_timer.alarm : 1; }
+
+    static void fire() {
+        sim_ticks = step_timer.next_fire;
+        double t0 = host_ns();
+        step_timer.isr(nullptr);
+        stats.isr_ns += host_ns() - t0;
+        stats.isr_ticks++;
+        step_timer.next_fire += period();
+    }
+
+    void advance(uint64_t ticks) {
+        uint64_t target = sim_ticks + ticks;
+        while (step_timer.running && step_timer.next_fire <= target) {
+            fire();
+        }
+        sim_ticks = target;
+    }
+
+    void run_until_next_segment() {
+        uint64_t loads = step_timer.loads;
+        while (step_timer.running && step_timer.loads == loads) {
+            fire();
+        }
+    }
+
+    double host_ns() {
+        using namespace std::chrono;
+        return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+int64_t esp_timer_get_time() {
+    // Busy-wait loops poll this clock, so every read has to move time forward.
+    Sim::poll_ticks += ticksPerMicrosecond;
+    return Sim::now() / ticksPerMicrosecond;
+}
+
+timg_dev_t TIMERG0;
+
+esp_err_t timer_init(timer_group_t group_num, timer_idx_t timer_num, const timer_config_t* config) {
+    Sim::step_timer.running = config->counter_en == TIMER_START;
+    return ESP_OK;
+}
+
+esp_err_t timer_set_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t load_val) {
+    Sim::step_timer.next_fire = Sim::sim_ticks + Sim::period();
+    return ESP_OK;
+}
+
+esp_err_t timer_set_alarm_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t alarm_value) {
+    Sim::step_timer.alarm = alarm_value;
+    Sim::step_timer.loads++;
+    Sim::stats.segments++;
+    return ESP_OK;
+}
+
+esp_err_t timer_enable_intr(timer_group_t group_num, timer_idx_t timer_num) {
+    return ESP_OK;
+}
+
+esp_err_t timer_isr_register(
+    timer_group_t group_num, timer_idx_t timer_num, void (*fn)(void*), void* arg, int intr_alloc_flags, timer_isr_handle_t* handle) {
+    Sim::step_timer.isr = fn;
+    return ESP_OK;
+}
+
+esp_err_t timer_start(timer_group_t group_num, timer_idx_t timer_num) {
+    if (!Sim::step_timer.running) {
+        Sim::step_timer.running   = true;
+        Sim::step_timer.next_fire = Sim::sim_ticks + Sim::period();
+    }
+    return ESP_OK;
+}
+
+esp_err_t timer_pause(timer_group_t group_num, timer_idx_t timer_num) {
+    Sim::step_timer.running = false;
+    return ESP_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Arduino core
+
+HardwareSerial Serial(0);
+EspClass       ESP;
+WiFiClass      WiFi;
+
+unsigned long millis() {
+    return Sim::now() / (ticksPerMicrosecond * 1000);
+}
+
+unsigned long micros() {
+    return Sim::now() / ticksPerMicrosecond;
+}
+
+void delay(uint32_t ms) {
+    Sim::advance((uint64_t)ms * 1000 * ticksPerMicrosecond);
+}
+
+void delayMicroseconds(uint32_t us) {
+    Sim::advance((uint64_t)us * ticksPerMicrosecond);
+}
+
+// Pins.cpp provides pinMode() and friends and forwards GPIO pins to these.
+// Nothing is wired up, so an input reads its pull-up or pull-down level,
+// which keeps door, hold and limit switches in their idle state.
+static uint8_t gpio_mode[64];
+static uint8_t gpio_level[64];
+
+extern "C" void __pinMode(uint8_t pin, uint8_t mode) {
+    gpio_mode[pin & 63] = mode;
+}
+
+extern "C" void __digitalWrite(uint8_t pin, uint8_t val) {
+    gpio_level[pin & 63] = val;
+}
+
+extern "C" int __digitalRead(uint8_t pin) {
+    uint8_t mode = gpio_mode[pin & 63];
+    if (mode & OUTPUT) {
+        return gpio_level[pin & 63];
+    }
+    return (mode & PULLUP) ? HIGH : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode) {}
+void detachInterrupt(uint8_t pin) {}
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits) {
+    return freq;
+}
+void     ledcWrite(uint8_t channel, uint32_t duty) {}
+void     ledcAttachPin(uint8_t pin, uint8_t channel) {}
+void     ledcDetachPin(uint8_t pin) {}
+uint32_t ledcRead(uint8_t channel) {
+    return 0;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+long random(long howbig) {
+    return howbig ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig) {
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+uint32_t getApbFrequency() {
+    return fTimers;
+}
+
+void esp_restart() {
+    exit(0);
+}
+
+uint32_t esp_get_free_heap_size() {
+    return 0;
+}
+
+const char* esp_err_to_name(esp_err_t code) {
+    return code == ESP_OK ? "ESP_OK" : "ESP_FAIL";
+}
+
+// ---------------------------------------------------------------------------
+// FreeRTOS. The simulator is single threaded, so tasks are never started and
+// queues and semaphores always succeed without blocking.
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t   pvTaskCode,
+                                   const char*      pcName,
+                                   uint32_t         usStackDepth,
+                                   void*            pvParameters,
+                                   UBaseType_t      uxPriority,
+                                   TaskHandle_t*    pvCreatedTask,
+                                   const BaseType_t xCoreID) {
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode,
+                       const char*    pcName,
+                       uint32_t       usStackDepth,
+                       void*          pvParameters,
+                       UBaseType_t    uxPriority,
+                       TaskHandle_t*  pvCreatedTask) {
+    return pdPASS;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay) {
+    delay(xTicksToDelay * portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t* const pxPreviousWakeTime, const TickType_t xTimeIncrement) {
+    *pxPreviousWakeTime += xTimeIncrement;
+}
+
+TickType_t xTaskGetTickCount() {
+    return millis() / portTICK_PERIOD_MS;
+}
+
+uint32_t xPortGetFreeHeapSize() {
+    return 0;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask) {
+    return 0;
+}
+
+void vTaskDelete(TaskHandle_t xTask) {}
+
+BaseType_t xPortGetCoreID() {
+    return CONFIG_ARDUINO_RUNNING_CORE;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait) {
+    return 0;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken) {}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify) {
+    return pdPASS;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize) {
+    return nullptr;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait) {
+    return pdPASS;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t xQueue, const void* pvItemToQueue, BaseType_t* pxHigherPriorityTaskWoken) {
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait) {
+    return pdFALSE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return nullptr;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return nullptr;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t* pxHigherPriorityTaskWoken) {
+    return pdTRUE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return nullptr;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex) {
+    return pdTRUE;
+}
+
+// ---------------------------------------------------------------------------
+// NVS. One flat in-memory store; settings start from their defaults on every run.
+
+static std::map<std::string, std::vector<uint8_t>> nvs_store;
+
+static esp_err_t nvs_get(const char* key, void* out, size_t* length) {
+    auto it = nvs_store.find(key);
+    if (it == nvs_store.end()) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    size_t size = it->second.size();
+    if (length) {
+        if (out && *length < size) {
+            *length = size;
+            return ESP_ERR_NVS_INVALID_LENGTH;
+        }
+        *length = size;
+    }
+    if (out) {
+        memcpy(out, it->second.data(), size);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t nvs_set(const char* key, const void* value, size_t length) {
+    auto p         = (const uint8_t*)value;
+    nvs_store[key] = std::vector<uint8_t>(p, p + length);
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode open_mode, nvs_handle* out_handle) {
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_i8(nvs_handle handle, const char* key, int8_t* out_value) {
+    return nvs_get(key, out_value, nullptr);
+}
+
+esp_err_t nvs_set_i8(nvs_handle handle, const char* key, int8_t value) {
+    return nvs_set(key, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_i32(nvs_handle handle, const char* key, int32_t* out_value) {
+    return nvs_get(key, out_value, nullptr);
+}
+
+esp_err_t nvs_set_i32(nvs_handle handle, const char* key, int32_t value) {
+    return nvs_set(key, &value, sizeof(value));
+}
+
+esp_err_t nvs_get_str(nvs_handle handle, const char* key, char* out_value, size_t* length) {
+    return nvs_get(key, out_value, length);
+}
+
+esp_err_t nvs_set_str(nvs_handle handle, const char* key, const char* value) {
+    return nvs_set(key, value, strlen(value) + 1);
+}
+
+esp_err_t nvs_get_blob(nvs_handle handle, const char* key, void* out_value, size_t* length) {
+    return nvs_get(key, out_value, length);
+}
+
+esp_err_t nvs_set_blob(nvs_handle handle, const char* key, const void* value, size_t length) {
+    return nvs_set(key, value, length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle handle, const char* key) {
+    return nvs_store.erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_erase_all(nvs_handle handle) {
+    nvs_store.clear();
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle handle) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_stats(const char* part_name, nvs_stats_t* nvs_stats) {
+    nvs_stats->used_entries    = nvs_store.size();
+    nvs_stats->free_entries    = 1000;
+    nvs_stats->total_entries   = nvs_stats->used_entries + nvs_stats->free_entries;
+    nvs_stats->namespace_count = 1;
+    return ESP_OK;
+}
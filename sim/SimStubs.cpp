@@ -0,0 +1,149 @@
+/*
+  SimStubs.cpp - firmware pieces that the host simulator replaces
+
+  The spindle is modelled by a single class that accepts every state and
+  reports laser mode from $32, so laser files exercise the same stepper
+  code paths as on a real laser machine.
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Sim.h"
+
+#include "src/Grbl.h"
+#include "src/I2SOut.h"
+
+namespace Spindles {
+    class Sim : public Spindle {
+    public:
+        void     init() override { is_reversable = true; }
+        uint32_t set_rpm(uint32_t rpm) override {
+            ::Sim::stats.rpm_updates++;
+            sys.spindle_speed = rpm;
+            return rpm;
+        }
+        void set_state(SpindleState state, uint32_t rpm) override {
+            if (_current_state != state && !inLaserMode()) {
+                auto setting = state == SpindleState::Disable ? spindle_delay_spindown : spindle_delay_spinup;
+                spin_delay(uint32_t(1000.0 * setting->get()));
+            }
+            _current_state = state;
+            set_rpm(state == SpindleState::Disable ? 0 : rpm);
+        }
+        // The main loop spins without advancing the clock, so let the time of a spin-up pass here
+        bool at_speed() override {
+            if (Spindle::at_speed()) {
+                return true;
+            }
+            delay(1);
+            return Spindle::at_speed();
+        }
+        SpindleState get_state() override { return _current_state; }
+        bool         inLaserMode() override { return laser_mode->get(); }
+        uint32_t     power_levels() override { return laser_full_power->get(); }
+        void         set_power_level(uint32_t level) override { ::Sim::stats.power_updates++; }
+        void         stop() override { _current_state = SpindleState::Disable; }
+        void         config_message() override {}
+    };
+
+    void Spindle::select() {
+        static Sim sim;
+        spindle = &sim;
+        spindle->init();
+    }
+
+    bool Spindle::inLaserMode() { return false; }
+
+    uint32_t Spindle::power_levels() { return 0; }
+
+    void Spindle::set_power_level(uint32_t level) {}
+
+    void Spindle::sync(SpindleState state, uint32_t rpm) {
+        if (sys.state == State::CheckMode) {
+            return;
+        }
+        protocol_buffer_synchronize();  // Empty planner buffer to ensure spindle is set when programmed.
+        set_state(state, rpm);
+    }
+
+    void Spindle::deinit() { stop(); }
+
+    bool Spindle::at_speed() { return millis() - _spin_start >= _spin_time; }
+
+    void Spindle::spin_delay(uint32_t milliseconds) {
+        _spin_start = millis();
+        _spin_time  = milliseconds;
+    }
+}
+
+Spindles::Spindle* spindle;
+
+// The web UI settings need the WiFi and file system stacks
+namespace WebUI {
+    void make_web_settings() {}
+}
+
+// I2S output. The expander pins are plain memory and the simulator always
+// steps with the timer ISR, so the streaming side is never entered.
+static uint32_t i2s_port_data = 0;
+
+int i2s_out_init() {
+    return 0;
+}
+
+uint8_t i2s_out_read(uint8_t pin) {
+    return bitnum_istrue(i2s_port_data, pin);
+}
+
+void i2s_out_write(uint8_t pin, uint8_t val) {
+    if (val) {
+        bitnum_true(i2s_port_data, pin);
+    } else {
+        bit_false(i2s_port_data, bit(pin));
+    }
+}
+
+uint32_t i2s_out_push_sample(uint32_t usec) {
+    return 0;
+}
+
+int i2s_out_set_passthrough() {
+    return 0;
+}
+
+int i2s_out_set_stepping() {
+    return 0;
+}
+
+void i2s_out_delay() {}
+
+int i2s_out_set_pulse_period(uint32_t usec) {
+    return 0;
+}
+
+int i2s_out_set_pulse_callback(i2s_out_pulse_func_t func) {
+    return 0;
+}
+
+i2s_out_pulser_status_t i2s_out_get_pulser_status() {
+    return PASSTHROUGH;
+}
+
+int i2s_out_reset() {
+    return 0;
+}
+
+// The SD card is the host file system, see include/FS.h
+SDFS     SD;
+SPIClass SPI;
@@ -0,0 +1,646 @@
+/*
+  Simulator.cpp - streams a G-code file through the real Grbl_ESP32 motion core
+
+  The firmware main loop runs unmodified: lines are read from the serial
+  client, parsed by gc_execute_line(), planned by plan_buffer_line(), turned
+  into segments by st_prep_buffer() and stepped out by the stepper ISR.
+  The motor layer is replaced by a recorder that counts every step and
+  direction change, so the final position can be checked against the
+  firmware's own sys_position and two builds can be compared step by step.
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Sim.h"
+
+#include "src/Grbl.h"
+
+#include <array>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace Sim {
+    Stats stats;
+    FILE* trace      = nullptr;
+    bool  rmt_bursts = false;
+
+    static FILE*    input      = nullptr;
+    static bool     input_eof  = false;
+    static bool     echo       = false;
+    static bool     terminal   = false;
+    static uint64_t idle_polls = 0;
+    static const char* sd_job     = nullptr;  // File to run as an SD card job (-d, -c)
+    static bool        sd_compile = false;
+    static uint64_t    line_ticks = 0;  // Machine time each line keeps the main loop from prepping (-l)
+
+    // The programmed path for -g: the end points of every line motion and arc chord given to
+    // mc_cartesian_line(), and the segment of it the tool was last nearest to.
+    static float                                      path_tolerance = 0;
+    static std::vector<std::array<float, MAX_N_AXIS>> path;
+    static size_t                                     path_index = 0;
+
+    void set_input(FILE* in, bool echo_output, bool terminal_echo) {
+        input    = in;
+        echo     = echo_output || terminal_echo;
+        terminal = terminal_echo;
+        if (echo) {
+            setvbuf(stdout, NULL, _IOLBF, 0);
+        }
+    }
+
+    // True while the serial client holds a line the main loop has not taken
+    static bool line_pending() { return client_get_rx_buffer_available(CLIENT_SERIAL) != RX_BUFFER_SIZE; }
+
+    bool input_done() { return input_eof && !line_pending(); }
+
+    static void fnv(uint64_t v) {
+        const uint64_t prime = 1099511628211ULL;
+        for (int i = 0; i < 8; i++) {
+            stats.trace_hash = (stats.trace_hash ^ (v & 0xff)) * prime;
+            v >>= 8;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Motor layer. Records step and direction events instead of driving pins.
+
+static uint8_t motor_dir_mask = 0;
+
+void init_motors() {}
+void motors_read_settings() {}
+
+uint8_t motors_set_homing_mode(uint8_t homing_mask, bool isHoming) {
+    return homing_mask;
+}
+
+void motors_set_disable(bool disable, uint8_t mask) {}
+
+bool motors_direction(uint8_t dir_mask) {
+    if (dir_mask == motor_dir_mask) {
+        return false;
+    }
+    motor_dir_mask = dir_mask;
+    Sim::stats.dir_changes++;
+    return true;
+}
+
+// Distance from point to the line segment from start to end
+static float segment_distance(const float* start, const float* end, const float* point, int n_axis) {
+    float length_sqr = 0, dot = 0;
+    for (int axis = 0; axis < n_axis; axis++) {
+        float delta = end[axis] - start[axis];
+        length_sqr += delta * delta;
+        dot += delta * (point[axis] - start[axis]);
+    }
+    float t = length_sqr > 0 ? constrain(dot / length_sqr, 0.0f, 1.0f) : 0;
+    float distance_sqr = 0;
+    for (int axis = 0; axis < n_axis; axis++) {
+        float delta = start[axis] + t * (end[axis] - start[axis]) - point[axis];
+        distance_sqr += delta * delta;
+    }
+    return sqrtf(distance_sqr);
+}
+
+// Measures how far the tool is from the programmed path. The tool moves on along the path, so only
+// the segments a fused G64 block can span, from the one it was last nearest to, are searched.
+static void track_path() {
+    auto& path = Sim::path;
+    if (path.size() < 2) {
+        return;
+    }
+    auto    n_axis = number_axis->get();
+    int32_t steps[MAX_N_AXIS];
+    float   tool[MAX_N_AXIS];
+    for (int axis = 0; axis < n_axis; axis++) {
+        steps[axis] = Sim::stats.steps[axis];
+    }
+    system_convert_array_steps_to_mpos(tool, steps);
+    size_t last    = MIN(path.size() - 1, Sim::path_index + PATH_BLEND_MAX_VERTICES + 1);
+    float  nearest = INFINITY;
+    for (size_t i = Sim::path_index; i < last; i++) {
+        float distance = segment_distance(path[i].data(), path[i + 1].data(), tool, n_axis);
+        if (distance < nearest) {
+            nearest         = distance;
+            Sim::path_index = i;
+        }
+    }
+    if (nearest > Sim::stats.path_error) {
+        Sim::stats.path_error = nearest;
+    }
+}
+
+static void record_step(uint8_t step_mask, uint64_t t) {
+    if (!step_mask) {
+        return;
+    }
+    Sim::stats.step_events++;
+    for (int axis = 0; axis < MAX_N_AXIS; axis++) {
+        if (bitnum_istrue(step_mask, axis)) {
+            Sim::stats.steps[axis] += bitnum_istrue(motor_dir_mask, axis) ? -1 : 1;
+        }
+    }
+    if (Sim::path_tolerance > 0) {
+        track_path();
+    }
+    Sim::fnv(t);
+    Sim::fnv(((uint64_t)motor_dir_mask << 8) | step_mask);
+    if (Sim::trace) {
+        fprintf(Sim::trace, "%.3f,%u,%u\n", (double)t / ticksPerMicrosecond, step_mask, motor_dir_mask);
+    }
+}
+
+void motors_step(uint8_t step_mask) {
+    record_step(step_mask, Sim::now());
+}
+
+void motors_unstep() {}
+
+bool motors_can_step_burst() {
+    return Sim::rmt_bursts;
+}
+
+// Each tick of a burst is recorded at the time the RMT would emit it
+void motors_step_burst(const uint8_t* step_bits, uint32_t ticks, uint32_t period) {
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        record_step(step_bits[tick], Sim::now() + (uint64_t)tick * period);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Serial port. Serial.cpp runs unmodified; the simulator plays the part of
+// clientCheckTask() and of a sender that pastes one line at a time.
+
+size_t Uart::write(uint8_t data) {
+    if (Sim::echo) {
+        fputc(data, stdout);
+    }
+    return 1;
+}
+
+size_t Uart::write(const uint8_t* buffer, size_t length) {
+    if (Sim::echo) {
+        fwrite(buffer, 1, length, stdout);
+    }
+    return length;
+}
+
+size_t Uart::write(const char* text) {
+    return write((const uint8_t*)text, strlen(text));
+}
+
+Uart::Uart(int uart_num) : _uart_num(uart_port_t(uart_num)), _pushback(-1), _rx_events(false), _event_queue(NULL) {}
+bool Uart::setPins(int tx_pin, int rx_pin, int rts_pin, int cts_pin) {
+    return true;
+}
+void Uart::enableRxEvents() {}
+void Uart::begin(unsigned long baud, Data dataBits, Stop stopBits, Parity parity) {}
+bool Uart::waitForRx(TickType_t timeout) {
+    return false;
+}
+int  Uart::available() {
+    return 0;
+}
+int Uart::read() {
+    return -1;
+}
+int Uart::peek() {
+    return -1;
+}
+size_t Uart::readBytes(char* buffer, size_t length) {
+    return 0;
+}
+
+Uart Uart0(0);
+
+// Hands the next input line to the serial client once the main loop has
+// consumed the previous one. Realtime characters are acted upon immediately,
+// exactly as clientCheckTask() does. Lines that hold nothing but realtime
+// characters are sent out of band, like a sender would, so that M0 followed
+// by ~ resumes the program instead of leaving an empty line in the buffer.
+void Sim::poll_input() {
+    // A suspended main loop does not read, but a terminal keeps sending, and
+    // its realtime characters still act at once.
+    bool type_ahead = terminal && sys.suspend.value;
+    if (input_eof || (line_pending() && !type_ahead)) {
+        return;
+    }
+    char line[LINE_BUFFER_SIZE];
+    if (!fgets(line, sizeof(line), input)) {
+        input_eof = true;
+        return;
+    }
+    stats.lines++;
+    if (terminal) {
+        // Local echo, as a terminal shows the line before the firmware's response
+        fputs(line, stdout);
+        if (!strchr(line, '\n')) {
+            fputc('\n', stdout);
+        }
+    }
+    char* out = line;
+    bool  realtime_only = false;
+    for (char* p = line; *p; p++) {
+        uint8_t c = *p;
+        if (is_realtime_command(c)) {
+            execute_realtime_command(static_cast<Cmd>(c), CLIENT_SERIAL);
+            realtime_only = out == line;
+        } else {
+            *out++ = c;
+            if (c != '\r' && c != '\n') {
+                realtime_only = false;
+            }
+        }
+    }
+    *out = '\0';
+    if (realtime_only && !terminal) {
+        return;
+    }
+    for (char* p = line; p < out; p++) {
+        client_receive_char(CLIENT_SERIAL, uint8_t(*p));
+    }
+    if (out == line || out[-1] != '\n') {
+        client_receive_char(CLIENT_SERIAL, '\n');
+    }
+}
+
+// Starts the SD card job the way [ESP220] does. This runs on the first pass of
+// the main loop, after run_once() has reset the parser state the compiled job
+// is checked against.
+void Sim::start_sd_job() {
+    const char* path = sd_job;
+    sd_job           = nullptr;
+    SD_client        = CLIENT_SERIAL;
+    SD_auth_level    = WebUI::AuthenticationLevel::LEVEL_ADMIN;
+    if (sd_compile) {
+        Error status = sd_compile_file(SD, path, CLIENT_SERIAL);
+        if (status != Error::Ok) {
+            fprintf(stderr, "compiling %s: error:%d %s\n", path, int(status), errorString(status));
+        }
+    }
+    bool compiled = sd_open_compiled(SD, path);
+    if (!compiled && !openFile(SD, path)) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return;
+    }
+    fprintf(stderr, "running %s %s\n", path, compiled ? "compiled" : "as text");
+    SD_ready_next = true;
+}
+
+// ---------------------------------------------------------------------------
+// Instrumentation hooks, inserted with the linker's --wrap option
+
+// The linker routes calls to X through wrap_X and exposes the original as real_X.
+// The firmware is C++, so the labels carry the mangled names listed in the Makefile.
+void    real_st_prep_buffer() asm("__real__Z14st_prep_bufferv");
+uint8_t real_plan_buffer_line(float* target, plan_line_data_t* pl_data) asm("__real__Z16plan_buffer_linePfP16plan_line_data_t");
+Error   real_gc_execute_line(char* line, uint8_t client) asm("__real__Z15gc_execute_linePch");
+void    real_report_status_message(Error status_code, uint8_t client) asm("__real__Z21report_status_message5Errorh");
+
+void    wrap_st_prep_buffer() asm("__wrap__Z14st_prep_bufferv");
+uint8_t wrap_plan_buffer_line(float* target, plan_line_data_t* pl_data) asm("__wrap__Z16plan_buffer_linePfP16plan_line_data_t");
+Error   wrap_gc_execute_line(char* line, uint8_t client) asm("__wrap__Z15gc_execute_linePch");
+void    wrap_report_status_message(Error status_code, uint8_t client) asm("__wrap__Z21report_status_message5Errorh");
+Error   real_client_read_line(uint8_t client, char* line) asm("__real__Z16client_read_linehPc");
+Error   wrap_client_read_line(uint8_t client, char* line) asm("__wrap__Z16client_read_linehPc");
+bool    real_mc_cartesian_line(float* target, plan_line_data_t* pl_data, float* position)
+    asm("__real__Z17mc_cartesian_linePfP16plan_line_data_tS_");
+bool    wrap_mc_cartesian_line(float* target, plan_line_data_t* pl_data, float* position)
+    asm("__wrap__Z17mc_cartesian_linePfP16plan_line_data_tS_");
+#ifdef PLANNER_ARCS
+uint8_t real_plan_buffer_arc(float* target, plan_line_data_t* pl_data, plan_arc_t* arc)
+    asm("__real__Z15plan_buffer_arcPfP16plan_line_data_tP10plan_arc_t");
+uint8_t wrap_plan_buffer_arc(float* target, plan_line_data_t* pl_data, plan_arc_t* arc)
+    asm("__wrap__Z15plan_buffer_arcPfP16plan_line_data_tP10plan_arc_t");
+#endif
+
+// The main loop polls every client once per pass. This is where the input
+// is fed and where the run ends once everything read has been executed.
+Error wrap_client_read_line(uint8_t client, char* line) {
+    if (client != CLIENT_SERIAL) {
+        return real_client_read_line(client, line);
+    }
+    if (Sim::sd_job) {
+        Sim::start_sd_job();
+    }
+    Sim::poll_input();
+    Error status = real_client_read_line(client, line);
+    if (status == Error::Ok && Sim::input_done() && get_sd_state(false) != SDState::BusyPrinting) {
+        if (sys.state == State::Idle && !Sim::step_timer_running() && plan_get_current_block() == NULL) {
+            sys.abort = true;
+        } else if (++Sim::idle_polls > 100000000) {
+            fprintf(stderr, "Stalled in state %d at end of input\n", int(sys.state));
+            sys.abort = true;
+        }
+    }
+    return status;
+}
+
+void wrap_st_prep_buffer() {
+    double t0 = Sim::host_ns();
+    real_st_prep_buffer();
+    double dt = Sim::host_ns() - t0;
+    Sim::stats.prep_calls++;
+    Sim::stats.prep_ns += dt;
+    if (dt > Sim::stats.prep_max_ns) {
+        Sim::stats.prep_max_ns = dt;
+    }
+    // Let the ISR consume one segment so the next call has work to do, and
+    // let the serial input run while the main loop is busy or suspended.
+    Sim::run_until_next_segment();
+    // A terminal user types the next line after seeing the response, so only
+    // type ahead while the machine is suspended (M0, feed hold).
+    if (!Sim::terminal || sys.suspend.value) {
+        Sim::poll_input();
+    }
+}
+
+uint8_t wrap_plan_buffer_line(float* target, plan_line_data_t* pl_data) {
+    double  t0     = Sim::host_ns();
+    uint8_t status = real_plan_buffer_line(target, pl_data);
+    Sim::stats.plan_ns += Sim::host_ns() - t0;
+    if (status == PLAN_OK) {
+        Sim::stats.blocks++;
+    }
+    return status;
+}
+
+#ifdef PLANNER_ARCS
+uint8_t wrap_plan_buffer_arc(float* target, plan_line_data_t* pl_data, plan_arc_t* arc) {
+    double  t0     = Sim::host_ns();
+    uint8_t status = real_plan_buffer_arc(target, pl_data, arc);
+    Sim::stats.plan_ns += Sim::host_ns() - t0;
+    if (status == PLAN_OK) {
+        Sim::stats.blocks++;
+    }
+    return status;
+}
+#endif
+
+// Records the programmed path for -g before G64 path blending gets to fuse it
+bool wrap_mc_cartesian_line(float* target, plan_line_data_t* pl_data, float* position) {
+    if (Sim::path_tolerance > 0 && sys.state != State::CheckMode) {
+        std::array<float, MAX_N_AXIS> point = {};
+        if (Sim::path.empty()) {
+            memcpy(point.data(), position, sizeof(point));
+            Sim::path.push_back(point);
+        }
+        memcpy(point.data(), target, sizeof(point));
+        Sim::path.push_back(point);
+    }
+    return real_mc_cartesian_line(target, pl_data, position);
+}
+
+Error wrap_gc_execute_line(char* line, uint8_t client) {
+    double t0     = Sim::host_ns();
+    double nested = Sim::stats.plan_ns + Sim::stats.prep_ns + Sim::stats.isr_ns;
+    Error  status = real_gc_execute_line(line, client);
+    nested        = Sim::stats.plan_ns + Sim::stats.prep_ns + Sim::stats.isr_ns - nested;
+    Sim::stats.parse_ns += Sim::host_ns() - t0 - nested;
+    // The stepper runs on from the segments already prepped, and may run dry
+    if (Sim::line_ticks) {
+        Sim::advance(Sim::line_ticks);
+    }
+    return status;
+}
+
+void wrap_report_status_message(Error status_code, uint8_t client) {
+    if (status_code != Error::Ok) {
+        Sim::stats.errors++;
+        uint64_t line = get_sd_state(false) == SDState::BusyPrinting ? sd_get_current_line_number() : Sim::stats.lines;
+        fprintf(stderr, "line %llu: error:%d %s\n", (unsigned long long)line, int(status_code), errorString(status_code));
+    }
+    real_report_status_message(status_code, client);
+}
+
+// Runs the G-code lines of the file through the parser in check mode, as $C
+// does, and reports the parser's throughput. Motion is checked but not planned,
+// and the timer is read once per pass, so only the parser is measured.
+static int bench_parser(FILE* in, int passes) {
+    std::vector<std::string> lines;
+    char                     line[LINE_BUFFER_SIZE];
+    while (fgets(line, sizeof(line), in)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] != '$') {  // $ lines go to the settings parser
+            lines.push_back(line);
+        }
+    }
+    gc_init();
+    sys.state       = State::CheckMode;
+    uint64_t errors = 0;
+    double   best   = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        double t0 = Sim::host_ns();
+        for (auto& text : lines) {
+            memcpy(line, text.c_str(), text.size() + 1);  // The parser edits the line in place
+            errors += real_gc_execute_line(line, CLIENT_SERIAL) != Error::Ok;
+        }
+        double ns = Sim::host_ns() - t0;
+        if (pass == 0 || ns < best) {
+            best = ns;
+        }
+    }
+    printf("lines            %llu (%llu errors) x %d passes\n",
+           (unsigned long long)lines.size(),
+           (unsigned long long)(errors / passes),
+           passes);
+    printf("parse time       %.3f us/line (best pass)\n", lines.size() ? best / lines.size() / 1e3 : 0);
+    printf("lines/s          %.0f (parse)\n", lines.size() / (best / 1e9));
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+
+static void usage(const char* name) {
+    fprintf(stderr,
+            "usage: %s [-v|-e] [-r|-b] [-d|-c] [-p passes] [-t trace.csv] [-g mm] [-l us] [-s '$command']... file.nc\n"
+            "  -v  echo firmware output (ok, messages) to stdout\n"
+            "  -e  like -v, showing each input line before its response as a terminal does\n"
+            "  -d  run the file as an SD card job, from its .gcb if that is up to date\n"
+            "  -c  like -d, compiling the file to a .gcb next to it first\n"
+            "  -r  step with RMT timing (no pulse wait in the ISR) instead of the timed GPIO ISR\n"
+            "  -b  like -r, with USE_RMT_STEP_BURSTS bursts\n"
+            "  -p  only parse the file, in check mode, passes times and report the parser's speed\n"
+            "  -t  write every step event as time_us,step_bits,dir_bits\n"
+            "  -g  fail if the tool strays further than mm from the programmed line motions\n"
+            "  -l  keep segment prep waiting for us of machine time after each G-code line\n"
+            "  -s  execute a $ setting or command, e.g. -s '$32=1' or -s '$X', before streaming\n",
+            name);
+    exit(2);
+}
+
+static double per_second(uint64_t count, double ns) {
+    return ns > 0 ? count / (ns / 1e9) : 0;
+}
+
+int main(int argc, char** argv) {
+    const char* trace_name = nullptr;
+    const char* settings[32];
+    int         n_settings = 0;
+    bool        echo       = false;
+    bool        terminal   = false;
+    bool        rmt        = false;
+    int         opt;
+    bool        sd         = false;
+    int         passes     = 0;
+    while ((opt = getopt(argc, argv, "verbdcp:t:g:l:s:")) != -1) {
+        switch (opt) {
+            case 'v':
+                echo = true;
+                break;
+            case 'e':
+                terminal = true;
+                break;
+            case 'c':
+                Sim::sd_compile = true;
+                // fall through
+            case 'd':
+                sd = true;
+                break;
+            case 'b':
+                Sim::rmt_bursts = true;
+                // fall through
+            case 'r':
+                rmt = true;
+                break;
+            case 'p':
+                passes = atoi(optarg);
+                if (passes < 1) {
+                    usage(argv[0]);
+                }
+                break;
+            case 't':
+                trace_name = optarg;
+                break;
+            case 'g':
+                Sim::path_tolerance = atof(optarg);
+                if (Sim::path_tolerance <= 0) {
+                    usage(argv[0]);
+                }
+                break;
+            case 'l':
+                Sim::line_ticks = (uint64_t)atol(optarg) * ticksPerMicrosecond;
+                break;
+            case 's':
+                if (n_settings < 32) {
+                    settings[n_settings++] = optarg;
+                }
+                break;
+            default:
+                usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1) {
+        usage(argv[0]);
+    }
+    FILE* in = fopen(argv[optind], "r");
+    if (!in) {
+        perror(argv[optind]);
+        return 1;
+    }
+    if (sd) {
+        // The serial client stays quiet while the job runs from the "card"
+        fclose(in);
+        in          = fopen("/dev/null", "r");
+        Sim::sd_job = argv[optind];
+    }
+    if (trace_name) {
+        Sim::trace = fopen(trace_name, "w");
+        if (!Sim::trace) {
+            perror(trace_name);
+            return 1;
+        }
+        fputs("time_us,step_bits,dir_bits\n", Sim::trace);
+    }
+    Sim::set_input(in, echo, terminal);
+    Sim::stats.trace_hash = 14695981039346656037ULL;
+
+    // I2S stepping needs hardware. RMT stepping only differs from the timer ISR in not waiting
+    // out the step pulse, which the motor recorder doesn't need.
+    current_stepper = rmt ? ST_RMT : ST_TIMED;
+    grbl_init();
+    for (int i = 0; i < n_settings; i++) {
+        char line[LINE_BUFFER_SIZE];
+        strncpy(line, settings[i], sizeof(line) - 1);
+        line[sizeof(line) - 1] = '\0';
+        Error status           = system_execute_line(line, uint8_t(CLIENT_SERIAL), WebUI::AuthenticationLevel::LEVEL_ADMIN);
+        if (status != Error::Ok) {
+            fprintf(stderr, "%s: error:%d %s\n", settings[i], int(status), errorString(status));
+            return 1;
+        }
+    }
+
+    if (passes) {
+        return bench_parser(in, passes);
+    }
+
+    double t0 = Sim::host_ns();
+    run_once();
+    Sim::stats.wall_ns = Sim::host_ns() - t0;
+
+    if (Sim::trace) {
+        fclose(Sim::trace);
+    }
+
+    auto&    s       = Sim::stats;
+    auto     n_axis  = number_axis->get();
+    double   machine = (double)Sim::now() / fStepperTimer;
+    uint64_t n_segs  = s.segments;
+    printf("lines            %llu (%llu errors)\n", (unsigned long long)s.lines, (unsigned long long)s.errors);
+    printf("blocks           %llu\n", (unsigned long long)s.blocks);
+    printf("segments         %llu\n", (unsigned long long)n_segs);
+    printf("step events      %llu in %llu ISR ticks, %llu direction changes\n",
+           (unsigned long long)s.step_events,
+           (unsigned long long)s.isr_ticks,
+           (unsigned long long)s.dir_changes);
+    printf("spindle updates  %llu\n", (unsigned long long)s.rpm_updates);
+    if (s.power_updates) {
+        printf("laser updates    %llu\n", (unsigned long long)s.power_updates);
+    }
+    printf("machine time     %.3f s\n", machine);
+    printf("host time        %.3f s (parse %.3f, plan %.3f, prep %.3f, isr %.3f)\n",
+           s.wall_ns / 1e9,
+           s.parse_ns / 1e9,
+           s.plan_ns / 1e9,
+           s.prep_ns / 1e9,
+           s.isr_ns / 1e9);
+    printf("blocks/s         %.0f (parse + plan)\n", per_second(s.blocks, s.parse_ns + s.plan_ns));
+    printf("segments/s       %.0f (prep)\n", per_second(n_segs, s.prep_ns));
+    printf("prep time        avg %.3f us/call, %.3f us/segment, worst %.3f us\n",
+           s.prep_calls ? s.prep_ns / s.prep_calls / 1e3 : 0,
+           n_segs ? s.prep_ns / n_segs / 1e3 : 0,
+           s.prep_max_ns / 1e3);
+
+    float mpos[MAX_N_AXIS];
+    system_convert_array_steps_to_mpos(mpos, sys_position);
+    bool exact = true;
+    printf("sys_position    ");
+    for (int axis = 0; axis < n_axis; axis++) {
+        printf(" %c:%d", "XYZABC"[axis], sys_position[axis]);
+        exact = exact && s.steps[axis] == sys_position[axis];
+    }
+    printf("\nmpos            ");
+    for (int axis = 0; axis < n_axis; axis++) {
+        printf(" %c:%.3f", "XYZABC"[axis], mpos[axis]);
+    }
+    printf("\nmotor steps      %s\n", exact ? "match sys_position" : "MISMATCH");
+    printf("trace hash       %016llx\n", (unsigned long long)s.trace_hash);
+    bool on_path = true;
+    if (Sim::path_tolerance > 0) {
+        on_path = s.path_error <= Sim::path_tolerance;
+        printf("path error       %.4f mm (%s %.4f)\n", s.path_error, on_path ? "within" : "EXCEEDS", Sim::path_tolerance);
+    }
+    return exact && on_path ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*
+  SpindleCurveTest.cpp - checks the $Spindle/PWM/Curve calibration table
+
+  Spindles/SpindleCurve.cpp is linked on its own. A curve is compiled for
+  an rpm range and PWM period, and duty() is compared with the straight
+  lines between its points: at the points, halfway between them, outside
+  the range and over a sweep of every rpm.
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "src/Spindles/SpindleCurve.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Spindles;
+
+static int failures;
+
+static void check(bool ok, const char* name) {
+    printf("%s%s\n", ok ? "ok      " : "FAILED  ", name);
+    if (!ok) {
+        failures++;
+    }
+}
+
+// A 16 bit PWM period, and a range of 500 to 26000 rpm, which puts a table entry every 100 rpm.
+// The points of the curve fall on entries, so duty() meets the lines up to the rounding.
+const uint32_t period  = 65536;
+const uint32_t min_rpm = 500;
+const uint32_t max_rpm = 26000;
+const char*    points  = "5000:18,12000:42,24000:100";
+
+static bool near(uint32_t duty, float percent) {
+    return labs(long(duty) - long(period * percent / 100.0f + 0.5f)) <= 2;
+}
+
+// The output never drops as the rpm rises over the whole range and past both ends
+static bool rises(const Curve& curve) {
+    uint32_t last = 0;
+    for (uint32_t rpm = 0; rpm <= max_rpm + 1000; rpm++) {
+        uint32_t duty = curve.duty(rpm);
+        if (duty < last) {
+            return false;
+        }
+        last = duty;
+    }
+    return true;
+}
+
+int main() {
+    Curve curve;
+    curve.compile(points, min_rpm, max_rpm, period);
+    check(curve.active(), "spindle curve (compiles)");
+
+    check(near(curve.duty(5000), 18) && near(curve.duty(12000), 42) && near(curve.duty(24000), 100), "spindle curve (at the points)");
+
+    check(near(curve.duty(8500), 30) && near(curve.duty(18000), 71), "spindle curve (halfway between the points)");
+
+    // Below the first point the output stays at its percent, down to and below the min rpm
+    check(near(curve.duty(0), 18) && near(curve.duty(min_rpm), 18) && near(curve.duty(min_rpm + 100), 18),
+          "spindle curve (at and below the min rpm)");
+
+    // Past the last point it stays at 100%, up to and above the max rpm
+    check(near(curve.duty(max_rpm), 100) && near(curve.duty(max_rpm + 1), 100) && near(curve.duty(100000), 100),
+          "spindle curve (at and above the max rpm)");
+
+    // Points between table entries, a flat stretch and a small period, as on an 8 bit PWM
+    Curve uneven;
+    uneven.compile("1000:5,3333:20,7777:20.5,18000:90", 0, 24000, 255);
+    check(rises(curve) && rises(uneven), "spindle curve (never drops as the rpm rises)");
+
+    Curve none;
+    none.compile("", min_rpm, max_rpm, period);
+    check(!none.active(), "spindle curve (none without points)");
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,23 @@
+#!/bin/sh
+# Measures G-code parser throughput on parser.nc and raster_tree.nc, and
+# compares the parser's responses to parser.nc with the terminal log in
+# parser-result.txt. Host times vary; compare builds on the same computer.
+# PASSES sets how often each file is parsed; the fastest pass counts.
+
+cd "$(dirname "$0")"
+TESTS=../Grbl_Esp32/src/tests
+PASSES=${PASSES:-50}
+
+for nc in parser raster_tree; do
+    rate=$(./grbl_sim -p "$PASSES" "$TESTS/$nc.nc" 2>/dev/null | sed -n 's/^lines\/s *\([0-9]*\).*/\1/p')
+    printf "%-12s %10s lines/s\n" "$nc" "$rate"
+done
+
+# The log was taken on a real machine with a different configuration, so a few
+# responses differ (M4, M62/M63 ports, messages of later versions), and the lines
+# added to parser.nc since then are missing from it. Show them.
+LOG=$(mktemp)
+tr -d '\r' < "$TESTS/parser-result.txt" | sed -n '/^Grbl /,$p' > "$LOG"
+./grbl_sim -e "$TESTS/parser.nc" 2>/dev/null | tr -d '\r' | sed -n '/^Grbl /,/^lines /p' | sed '$d' | diff "$LOG" -
+rm -f "$LOG"
+exit 0
@@ -0,0 +1,111 @@
+#!/bin/sh
+# Streams the files in Grbl_Esp32/src/tests through the simulator and compares
+# the deterministic part of each report (counts, final position and the step
+# trace hash) against expected/. Run with --update to accept new results.
+
+cd "$(dirname "$0")"
+TESTS=../Grbl_Esp32/src/tests
+FILES='raster_tree raster_tree_g7 arcs_arrows parser parsetest spindle_testing spindle_spinup user_io path_blending short_segments'
+FIELDS='^(lines|blocks|segments|step events|spindle updates|laser updates|machine time|sys_position|motor steps|trace hash) '
+status=0
+
+# Streams every file through ./grbl_sim$1 and compares with expected/$1/, with $1 the variant
+# of the build (see VARIANTS in the Makefile), or empty for the default build
+check_files() {
+    for nc in $FILES; do
+        name="$nc${1:+ ($1)}"
+        expected="expected/${1:+$1/}$nc.txt"
+        actual=$(./grbl_sim${1:+_$1} "$TESTS/$nc.nc" 2>/dev/null | grep -E "$FIELDS")
+        if [ "$UPDATE" = 1 ]; then
+            mkdir -p "$(dirname "$expected")"
+            echo "$actual" > "$expected"
+            echo "updated $name"
+        elif echo "$actual" | diff -u "$expected" - > /dev/null; then
+            echo "ok      $name"
+        else
+            echo "FAILED  $name"
+            echo "$actual" | diff -u "$expected" -
+            status=1
+        fi
+    done
+}
+
+[ "$1" = "--update" ] && UPDATE=1
+check_files
+
+# The parser's responses to every line of parser.nc, as a terminal shows them
+actual=$(./grbl_sim -e "$TESTS/parser.nc" 2>/dev/null | tr -d '\r' | sed -n '/^Grbl /,/^lines /p' | sed '$d')
+if [ "$1" = "--update" ]; then
+    echo "$actual" > expected/parser-terminal.txt
+    echo "updated parser (terminal)"
+elif echo "$actual" | diff -u expected/parser-terminal.txt - > /dev/null; then
+    echo "ok      parser (terminal)"
+else
+    echo "FAILED  parser (terminal)"
+    echo "$actual" | diff -u expected/parser-terminal.txt -
+    status=1
+fi
+
+# G64 path blending must keep the tool within its P0.05 tolerance of the programmed chords,
+# plus one step (0.01 mm) on each of X and Y
+if [ "$1" != "--update" ]; then
+    if result=$(./grbl_sim -g 0.065 "$TESTS/path_blending.nc" 2>&1); then
+        echo "ok      path_blending (path tolerance)"
+    else
+        echo "FAILED  path_blending (path tolerance)"
+        echo "$result" | grep -E "^(path error|motor steps) "
+        status=1
+    fi
+fi
+
+# A segment prep held up for 100 ms after each line lets the segment buffer run dry, and $MS
+# must count the underruns
+actual=$(./grbl_sim -v -l 100000 "$TESTS/underrun.nc" 2>/dev/null | tr -d '\r' |
+    grep -E -e "$FIELDS" -e '^\[MS:(Underruns|MinSegments|PlannerDepth)')
+if [ "$1" = "--update" ]; then
+    echo "$actual" > expected/underrun.txt
+    echo "updated underrun (\$MS)"
+elif echo "$actual" | diff -u expected/underrun.txt - > /dev/null; then
+    echo "ok      underrun (\$MS)"
+else
+    echo "FAILED  underrun (\$MS)"
+    echo "$actual" | diff -u expected/underrun.txt -
+    status=1
+fi
+
+# A compiled SD card job must step exactly like the same file run as text
+SD_DIR=$(mktemp -d)
+for nc in arcs_arrows spindle_testing; do
+    cp "$TESTS/$nc.nc" "$SD_DIR/"
+    text=$(./grbl_sim -d "$SD_DIR/$nc.nc" 2>/dev/null | grep -E "$FIELDS")
+    compiled=$(./grbl_sim -c "$SD_DIR/$nc.nc" 2>"$SD_DIR/$nc.err" | grep -E "$FIELDS")
+    if ! grep -q "compiled$" "$SD_DIR/$nc.err"; then
+        echo "FAILED  $nc (compiled SD job)"
+        cat "$SD_DIR/$nc.err"
+        status=1
+    elif [ "$text" = "$compiled" ]; then
+        echo "ok      $nc (compiled SD job)"
+    else
+        echo "FAILED  $nc (compiled SD job)"
+        echo "$text" > "$SD_DIR/$nc.txt"
+        echo "$compiled" | diff -u "$SD_DIR/$nc.txt" -
+        status=1
+    fi
+done
+rm -rf "$SD_DIR"
+
+# The deep look-ahead planner, alone and with S-curve acceleration
+for variant in deep deep_scurve; do
+    check_files $variant
+done
+
+# The VFD spindles' Modbus CRC and response framing, against a scripted RS485 line
+if [ "$1" != "--update" ]; then
+    ./modbus_test || status=1
+fi
+
+# The $Spindle/PWM/Curve table against the lines between its points
+if [ "$1" != "--update" ]; then
+    ./spindle_curve_test || status=1
+fi
+exit $status
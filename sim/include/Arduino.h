@@ -0,0 +1,123 @@
+#pragma once
+
+/*
+  Arduino.h - host shim of the Arduino-ESP32 core for the Grbl_ESP32 simulator
+
+  Only the small subset of the Arduino API that the motion core headers and
+  translation units reference is provided. Anything that touches hardware is
+  either a no-op or is routed to the simulator (see sim/SimPlatform.cpp).
+
+  Grbl is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Grbl is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with Grbl.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp32-hal.h"
+#include "binary.h"
+
+#include "Print.h"
+#include "Stream.h"
+#include "WString.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define NOP() asm volatile("nop")
+
+#ifndef PI
+#    define PI 3.1415926535897932384626433832795
+#endif
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x02
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define bit(b) (1UL << (b))
+#define radians(deg) ((deg)*M_PI / 180.0)
+#define digitalPinToInterrupt(p) (p)
+
+template <class T, class L, class H>
+inline auto constrain(T amt, L low, H high) -> decltype(amt + low + high) {
+    return amt < low ? low : (amt > high ? high : amt);
+}
+
+unsigned long millis();
+unsigned long micros();
+void          delay(uint32_t ms);
+void          delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalRead(uint8_t pin);
+
+void attachInterrupt(uint8_t pin, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+double   ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits);
+void     ledcWrite(uint8_t channel, uint32_t duty);
+void     ledcAttachPin(uint8_t pin, uint8_t channel);
+void     ledcDetachPin(uint8_t pin);
+uint32_t ledcRead(uint8_t channel);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+class HardwareSerial : public Stream {
+public:
+    HardwareSerial(int uart_nr) {}
+    void   begin(unsigned long baud, uint32_t config = 0, int8_t rxPin = -1, int8_t txPin = -1) {}
+    int    available() override { return 0; }
+    int    read() override { return -1; }
+    int    peek() override { return -1; }
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    const char* getSdkVersion() { return "host"; }
+    uint32_t    getFreeHeap() { return 0; }
+    void        restart() { esp_restart(); }
+};
+
+extern EspClass ESP;
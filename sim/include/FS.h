@@ -0,0 +1,70 @@
+#pragma once
+
+// FS.h - host shim of the Arduino filesystem types for the Grbl_ESP32 simulator.
+// Files are host files, opened by their path as given.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+    class File {
+    public:
+        File() {}
+        File(FILE* f, const char* path) : _f(f, fclose), _name(path) {}
+
+        operator bool() const { return _f != nullptr; }
+
+        size_t write(uint8_t c) { return write(&c, 1); }
+        size_t write(const uint8_t* buf, size_t size) { return _f ? fwrite(buf, 1, size, _f.get()) : 0; }
+        int    read() { return _f ? fgetc(_f.get()) : -1; }
+        size_t read(uint8_t* buf, size_t size) { return _f ? fread(buf, 1, size, _f.get()) : 0; }
+        int    peek() {
+            int c = read();
+            if (c != EOF) {
+                ungetc(c, _f.get());
+            }
+            return c;
+        }
+        int         available() { return _f ? int(size() - position()) : 0; }
+        bool        seek(uint32_t pos) { return _f && fseek(_f.get(), pos, SEEK_SET) == 0; }
+        size_t      position() const { return _f ? ftell(_f.get()) : 0; }
+        size_t      size() const {
+            if (!_f) {
+                return 0;
+            }
+            long pos = ftell(_f.get());
+            fseek(_f.get(), 0, SEEK_END);
+            long end = ftell(_f.get());
+            fseek(_f.get(), pos, SEEK_SET);
+            return end;
+        }
+        const char* name() const { return _name.c_str(); }
+        void        close() { _f.reset(); }
+        bool        isDirectory() { return false; }
+        File        openNextFile() { return File(); }
+
+    private:
+        std::shared_ptr<FILE> _f;
+        std::string           _name;
+    };
+
+    class FS {
+    public:
+        File open(const char* path, const char* mode = FILE_READ) {
+            // Binary mode; "w+" so a file being written can also be sized
+            std::string m = std::string(mode) + (mode[0] == 'w' ? "+b" : "b");
+            FILE*       f = fopen(path, m.c_str());
+            return f ? File(f, path) : File();
+        }
+        bool exists(const char* path) { return open(path); }
+        bool remove(const char* path) { return ::remove(path) == 0; }
+    };
+}
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,3 @@
+#pragma once
+
+// Preferences.h - host shim for the Grbl_ESP32 simulator. Grbl_ESP32 stores its settings in NVS.
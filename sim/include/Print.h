@@ -0,0 +1,35 @@
+#pragma once
+
+// Print.h - minimal host shim of the Arduino Print class for the Grbl_ESP32 simulator
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t write(const char* str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    size_t print(const char* s) { return write(s); }
+    size_t println(const char* s) { return write(s) + write("\r\n"); }
+    size_t printf(const char* format, ...) {
+        char    buf[256];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        return write(buf);
+    }
+    virtual void flush() {}
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+// SD.h - host shim for the Grbl_ESP32 simulator. The card is the host file system.
+
+#include "FS.h"
+#include "SPI.h"
+
+class SDFS : public fs::FS {
+public:
+    bool     begin(uint8_t ssPin, SPIClass& spi, uint32_t frequency, const char* mountpoint, uint8_t max_files) { return true; }
+    void     end() {}
+    uint64_t cardSize() { return 1; }
+};
+
+extern SDFS SD;
@@ -0,0 +1,9 @@
+#pragma once
+
+// SPI.h - host shim for the Grbl_ESP32 simulator. SPI peripherals are not simulated.
+
+#define SS 5
+
+class SPIClass {};
+
+extern SPIClass SPI;
@@ -0,0 +1,21 @@
+#pragma once
+
+// Stream.h - minimal host shim of the Arduino Stream class for the Grbl_ESP32 simulator
+
+#include "Print.h"
+
+class Stream : public Print {
+public:
+    virtual int    available() = 0;
+    virtual int    read()      = 0;
+    virtual int    peek()      = 0;
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        int    c;
+        while (n < length && (c = read()) >= 0) {
+            buffer[n++] = (char)c;
+        }
+        return n;
+    }
+    void setTimeout(unsigned long timeout) {}
+};
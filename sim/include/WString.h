@@ -0,0 +1,134 @@
+#pragma once
+
+// WString.h - minimal host shim of the Arduino String class for the Grbl_ESP32 simulator
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    explicit String(int v) : _s(std::to_string(v)) {}
+    explicit String(unsigned int v) : _s(std::to_string(v)) {}
+    explicit String(long v) : _s(std::to_string(v)) {}
+    explicit String(unsigned long v) : _s(std::to_string(v)) {}
+    explicit String(float v, unsigned int decimals = 2) { set_float(v, decimals); }
+    explicit String(double v, unsigned int decimals = 2) { set_float(v, decimals); }
+
+    const char*  c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    char         operator[](unsigned int i) const { return _s[i]; }
+    char&        operator[](unsigned int i) { return _s[i]; }
+    char         charAt(unsigned int i) const { return _s[i]; }
+    int          toInt() const { return atoi(_s.c_str()); }
+    float        toFloat() const { return atof(_s.c_str()); }
+    bool         equals(const String& s) const { return _s == s._s; }
+    bool         startsWith(const String& s) const { return _s.compare(0, s._s.size(), s._s) == 0; }
+    bool         endsWith(const String& s) const {
+        return _s.size() >= s._s.size() && _s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0;
+    }
+    int indexOf(char c, unsigned int from = 0) const {
+        auto p = _s.find(c, from);
+        return p == std::string::npos ? -1 : int(p);
+    }
+    int indexOf(const String& s, unsigned int from = 0) const {
+        auto p = _s.find(s._s, from);
+        return p == std::string::npos ? -1 : int(p);
+    }
+    int lastIndexOf(char c) const {
+        auto p = _s.rfind(c);
+        return p == std::string::npos ? -1 : int(p);
+    }
+    String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < _s.size() && to > from ? String(_s.substr(from, to - from)) : String();
+    }
+    void toUpperCase() {
+        for (auto& c : _s) {
+            c = toupper(c);
+        }
+    }
+    void toLowerCase() {
+        for (auto& c : _s) {
+            c = tolower(c);
+        }
+    }
+    void trim() {
+        auto b = _s.find_first_not_of(" \t\r\n");
+        auto e = _s.find_last_not_of(" \t\r\n");
+        _s     = b == std::string::npos ? "" : _s.substr(b, e - b + 1);
+    }
+    void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const {
+        if (!buf || !bufsize) {
+            return;
+        }
+        unsigned int n = index < _s.size() ? _s.size() - index : 0;
+        if (n > bufsize - 1) {
+            n = bufsize - 1;
+        }
+        memcpy(buf, _s.c_str() + index, n);
+        buf[n] = '\0';
+    }
+    void replace(const String& from, const String& to) {
+        if (from._s.empty()) {
+            return;
+        }
+        for (size_t p = 0; (p = _s.find(from._s, p)) != std::string::npos; p += to._s.size()) {
+            _s.replace(p, from._s.size(), to._s);
+        }
+    }
+
+    bool concat(const String& s) {
+        _s += s._s;
+        return true;
+    }
+    bool concat(const char* s) {
+        _s += s;
+        return true;
+    }
+    bool concat(char c) {
+        _s += c;
+        return true;
+    }
+
+    String& operator+=(const String& s) {
+        _s += s._s;
+        return *this;
+    }
+    String& operator+=(const char* s) {
+        _s += s;
+        return *this;
+    }
+    String& operator+=(char c) {
+        _s += c;
+        return *this;
+    }
+    String& operator+=(int v) {
+        _s += std::to_string(v);
+        return *this;
+    }
+    bool operator==(const String& s) const { return _s == s._s; }
+    bool operator==(const char* s) const { return _s == s; }
+    bool operator!=(const String& s) const { return _s != s._s; }
+    bool operator!=(const char* s) const { return _s != s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+    friend String operator+(const String& a, char b) { return String(a._s + b); }
+    friend String operator+(const String& a, int b) { return String(a._s + std::to_string(b)); }
+
+private:
+    void set_float(double v, unsigned int decimals) {
+        char buf[40];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        _s = buf;
+    }
+
+    std::string _s;
+};
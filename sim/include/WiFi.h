@@ -0,0 +1,44 @@
+#pragma once
+
+// WiFi.h - host shim for the Grbl_ESP32 simulator. The radio is never started;
+// grbl_init() only switches it off and Settings.cpp needs IPAddress.
+
+#include <cstdint>
+#include <cstdio>
+
+#include "WString.h"
+
+class IPAddress {
+public:
+    IPAddress(uint32_t addr = 0) : _addr(addr) {}
+    operator uint32_t() const { return _addr; }
+    bool fromString(const char* s) {
+        unsigned a, b, c, d;
+        if (sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+            return false;
+        }
+        _addr = a | (b << 8) | (c << 16) | (d << 24);
+        return true;
+    }
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr & 0xff, (_addr >> 8) & 0xff, (_addr >> 16) & 0xff, _addr >> 24);
+        return String(buf);
+    }
+
+private:
+    uint32_t _addr;
+};
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+class WiFiClass {
+public:
+    void persistent(bool persistent) {}
+    bool disconnect(bool wifioff = false) { return true; }
+    bool enableSTA(bool enable) { return true; }
+    bool enableAP(bool enable) { return true; }
+    bool mode(wifi_mode_t m) { return true; }
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,3 @@
+#pragma once
+
+// Wire.h - host shim for the Grbl_ESP32 simulator. I2C peripherals are not simulated.
@@ -0,0 +1,7 @@
+#pragma once
+
+// dac.h - host shim for the Grbl_ESP32 simulator
+
+#include "../esp32-hal.h"
+
+typedef enum { DAC_CHANNEL_1 = 1, DAC_CHANNEL_2 = 2 } dac_channel_t;
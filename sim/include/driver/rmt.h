@@ -0,0 +1,7 @@
+#pragma once
+
+// rmt.h - host shim for the Grbl_ESP32 simulator. RMT stepping is not simulated.
+
+#include "../esp32-hal.h"
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_MAX = 8 } rmt_channel_t;
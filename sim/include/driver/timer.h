@@ -0,0 +1,55 @@
+#pragma once
+
+// timer.h - host shim of the ESP32 general purpose timer driver for the Grbl_ESP32 simulator.
+// The simulator owns a single virtual step timer; see SimPlatform.cpp.
+
+#include "../esp32-hal.h"
+
+typedef enum { TIMER_GROUP_0 = 0, TIMER_GROUP_1 = 1 } timer_group_t;
+typedef enum { TIMER_0 = 0, TIMER_1 = 1 } timer_idx_t;
+typedef enum { TIMER_COUNT_DOWN = 0, TIMER_COUNT_UP = 1 } timer_count_dir_t;
+typedef enum { TIMER_PAUSE = 0, TIMER_START = 1 } timer_start_t;
+typedef enum { TIMER_ALARM_DIS = 0, TIMER_ALARM_EN = 1 } timer_alarm_t;
+typedef enum { TIMER_INTR_LEVEL = 0 } timer_intr_mode_t;
+typedef enum { TIMER_AUTORELOAD_DIS = 0, TIMER_AUTORELOAD_EN = 1 } timer_autoreload_t;
+
+typedef struct {
+    timer_alarm_t      alarm_en;
+    timer_start_t      counter_en;
+    timer_intr_mode_t  intr_type;
+    timer_count_dir_t  counter_dir;
+    bool               auto_reload;
+    uint32_t           divider;
+} timer_config_t;
+
+typedef void* timer_isr_handle_t;
+
+esp_err_t timer_init(timer_group_t group_num, timer_idx_t timer_num, const timer_config_t* config);
+esp_err_t timer_set_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t load_val);
+esp_err_t timer_set_alarm_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t alarm_value);
+esp_err_t timer_enable_intr(timer_group_t group_num, timer_idx_t timer_num);
+esp_err_t timer_isr_register(timer_group_t       group_num,
+                             timer_idx_t         timer_num,
+                             void (*fn)(void*),
+                             void*               arg,
+                             int                 intr_alloc_flags,
+                             timer_isr_handle_t* handle);
+esp_err_t timer_start(timer_group_t group_num, timer_idx_t timer_num);
+esp_err_t timer_pause(timer_group_t group_num, timer_idx_t timer_num);
+
+// Register image touched directly by the stepper ISR
+typedef struct {
+    struct {
+        struct {
+            uint32_t alarm_en;
+        } config;
+        uint32_t cnt_low;  // Always 0: the simulated ISR runs exactly on its alarm and takes no time
+        uint32_t update;
+    } hw_timer[2];
+    struct {
+        uint32_t t0;
+        uint32_t t1;
+    } int_clr_timers;
+} timg_dev_t;
+
+extern timg_dev_t TIMERG0;
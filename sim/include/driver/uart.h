@@ -0,0 +1,16 @@
+#pragma once
+
+// uart.h - host shim of the ESP32 UART driver types for the Grbl_ESP32 simulator
+
+#include "../esp32-hal.h"
+#include "../freertos/FreeRTOS.h"
+
+typedef int uart_port_t;
+
+typedef enum { UART_DATA_5_BITS = 0, UART_DATA_6_BITS, UART_DATA_7_BITS, UART_DATA_8_BITS } uart_word_length_t;
+typedef enum { UART_STOP_BITS_1 = 1, UART_STOP_BITS_1_5, UART_STOP_BITS_2 } uart_stop_bits_t;
+typedef enum { UART_PARITY_DISABLE = 0, UART_PARITY_EVEN = 2, UART_PARITY_ODD = 3 } uart_parity_t;
+
+inline esp_err_t uart_flush(uart_port_t uart_num) {
+    return ESP_OK;
+}
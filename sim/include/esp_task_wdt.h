@@ -0,0 +1,15 @@
+#pragma once
+
+// esp_task_wdt.h - host shim for the Grbl_ESP32 simulator. The task watchdog is not modeled.
+
+#include "esp32-hal.h"
+#include "freertos/FreeRTOS.h"
+
+extern "C" {
+inline esp_err_t esp_task_wdt_add(TaskHandle_t handle) {
+    return ESP_OK;
+}
+inline esp_err_t esp_task_wdt_reset() {
+    return ESP_OK;
+}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+// FreeRTOS.h - host shim of the ESP-IDF FreeRTOS types for the Grbl_ESP32 simulator.
+// The simulator is single threaded, so critical sections and tasks are no-ops.
+
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void*    TaskHandle_t;
+typedef void*    QueueHandle_t;
+typedef void*    xQueueHandle;
+typedef void*    SemaphoreHandle_t;
+typedef void*    EventGroupHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED \
+    { 0, 0 }
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+#define portYIELD_FROM_ISR()
+#define taskYIELD()
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portTICK_RATE_MS portTICK_PERIOD_MS
+#define portMAX_DELAY 0xffffffffUL
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) / portTICK_PERIOD_MS)
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
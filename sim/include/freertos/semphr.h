@@ -0,0 +1,14 @@
+#pragma once
+
+// semphr.h - host shim of the FreeRTOS semaphore API for the Grbl_ESP32 simulator
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t xSemaphore);
+BaseType_t        xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t        xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime);
+BaseType_t        xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex);
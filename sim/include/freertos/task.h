@@ -0,0 +1,33 @@
+#pragma once
+
+// task.h - host shim of the FreeRTOS task API for the Grbl_ESP32 simulator
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t      pvTaskCode,
+                                   const char*         pcName,
+                                   uint32_t            usStackDepth,
+                                   void*               pvParameters,
+                                   UBaseType_t         uxPriority,
+                                   TaskHandle_t*       pvCreatedTask,
+                                   const BaseType_t    xCoreID);
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode,
+                       const char*    pcName,
+                       uint32_t       usStackDepth,
+                       void*          pvParameters,
+                       UBaseType_t    uxPriority,
+                       TaskHandle_t*  pvCreatedTask);
+void        vTaskDelay(const TickType_t xTicksToDelay);
+void        vTaskDelayUntil(TickType_t* const pxPreviousWakeTime, const TickType_t xTimeIncrement);
+TickType_t  xTaskGetTickCount();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask);
+void        vTaskDelete(TaskHandle_t xTask);
+BaseType_t  xPortGetCoreID();
+uint32_t    ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+void        vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken);
+BaseType_t  xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+
+uint32_t xPortGetFreeHeapSize();
+
+#define vTaskEnterCritical(mux) portENTER_CRITICAL(mux)
+#define vTaskExitCritical(mux) portEXIT_CRITICAL(mux)
@@ -0,0 +1,5 @@
+#pragma once
+
+// sdkconfig.h - host shim for the Grbl_ESP32 simulator
+
+#define CONFIG_ARDUINO_RUNNING_CORE 1